@@ -59,6 +59,8 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                Par          : Particle data
 //                ParaVar      : Variables for parallelization
 //                LB           : Variables for load-balance
+//                Slab         : Per-level storage of the patch field arrays (for OPT__PATCH_SLAB)
+//                               --> NULL if OPT__PATCH_SLAB is off
 //                ResPower2    : ceil(  log2( effective resolution at lv )  ) --> mainly used by LOAD_BALANCE
 //                NUpdateLv    : Number of updates at each level in one global time-step
 //                               --> Do not take into account the number of patches and particles at each level
@@ -70,6 +72,9 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                pnew     : Allocate one patch
 //                pdelete  : Deallocate one patch
 //                Lvdelete : Deallocate all patches in the given level
+//                SlabInit    : Allocate the slab objects for OPT__PATCH_SLAB
+//                SlabCompact : Compact the slabs of the given level
+//                SlabView    : Return the base address and stride of a field stored contiguously in a slab
 //-------------------------------------------------------------------------------------------------------
 struct AMR_t
 {
@@ -102,6 +107,7 @@ struct AMR_t
    double PotSgTime   [NLEVEL][2];
 #  endif
    int    NPatchComma [NLEVEL][28];
+   PatchSlab_t *Slab  [NLEVEL][NSLAB];
    double dh          [NLEVEL];
    int    ResPower2   [NLEVEL];
    double BoxEdgeL    [3];
@@ -163,6 +169,10 @@ struct AMR_t
       for (int m=0; m<28; m++)
          NPatchComma[lv][m] = 0;
 
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int t=0; t<NSLAB; t++)
+         Slab[lv][t] = NULL;
+
 #     ifdef PARTICLE
       Par = NULL;
 #     endif
@@ -196,6 +206,14 @@ struct AMR_t
       const bool ReusePatchMemory_No = false;
       for (int lv=0; lv<NLEVEL; lv++)  Lvdelete( lv, ReusePatchMemory_No );
 
+//    slabs must be deleted after all patches have returned their field arrays
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int t=0; t<NSLAB; t++)
+      {
+         delete Slab[lv][t];
+         Slab[lv][t] = NULL;
+      }
+
 #     ifdef PARTICLE
       if ( Par != NULL )
       {
@@ -231,6 +249,7 @@ struct AMR_t
    // Note        :  1. Each patch contains two patch pointers --> SANDGLASS (Sg) = 0 / 1
    //                2. Sg = 0 : Store both data and relation (father,son.sibling,corner,flag,flux)
    //                   Sg = 1 : Store only data
+   //                3. Equivalent to preserve( lv, 1 ) followed by pnew_reserved()
    //
    // Parameter   :  lv          : Target refinement level
    //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
@@ -243,11 +262,70 @@ struct AMR_t
               const bool FluData, const bool MagData, const bool PotData )
    {
 
-      const int NewPID = num[lv];
+      const int NewPID = preserve( lv, 1 );
+
+      pnew_reserved( lv, NewPID, scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData );
+
+   } // METHOD : pnew
+
+
+
+   //===================================================================================
+   // Method      :  preserve
+   // Description :  Reserve a contiguous range of patch indices at the target level
+   //
+   // Note        :  1. Patches in the reserved range must be allocated by pnew_reserved() before use
+   //                2. Useful for allocating many patches in parallel
+   //                   --> Reserve all patch indices here first and then invoke pnew_reserved() by
+   //                       multiple OpenMP threads, which gives the same patch indices as invoking pnew()
+   //                       sequentially
+   //                3. Not thread-safe
+   //
+   // Parameter   :  lv   : Target refinement level
+   //                NNew : Number of patch indices to be reserved
+   //
+   // Return      :  The first reserved patch index
+   //===================================================================================
+   int preserve( const int lv, const int NNew )
+   {
+
+      const int NewPID0 = num[lv];
 
-      if ( NewPID > MAX_PATCH-1 )
+      if ( NewPID0 + NNew > MAX_PATCH )
          Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
+      num[lv] += NNew;
+
+      return NewPID0;
+
+   } // METHOD : preserve
+
+
+
+   //===================================================================================
+   // Method      :  pnew_reserved
+   // Description :  Allocate a single patch with a patch index reserved by preserve()
+   //
+   // Note        :  1. Thread-safe as long as different threads work on different patch indices
+   //                2. Reuse the inactive patch at NewPID if there is one (for OPT__REUSE_MEMORY)
+   //
+   // Parameter   :  lv          : Target refinement level
+   //                NewPID      : Reserved patch index
+   //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
+   //                FaPID       : Patch ID of the parent patch at level "lv-1"
+   //                FluData     : true --> Allocate fluid[]
+   //                MagData     : true --> Allocate magnetic[]
+   //                PotData     : true --> Allocate pot[]
+   //===================================================================================
+   void pnew_reserved( const int lv, const int NewPID, const int scale_x, const int scale_y, const int scale_z,
+                       const int FaPID, const bool FluData, const bool MagData, const bool PotData )
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( NewPID < 0  ||  NewPID >= num[lv] )
+         Aux_Error( ERROR_INFO, "unreserved patch index (Lv %d, PID %d, num %d) !!\n", lv, NewPID, num[lv] );
+#     endif
+
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
       {
@@ -258,9 +336,9 @@ struct AMR_t
 #        endif
 
          patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
-                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
+                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL], Slab[lv] );
          patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
-                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
+                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL], Slab[lv] );
       }
 
 //    reactivate inactive patches
@@ -281,14 +359,12 @@ struct AMR_t
          const bool InitPtrAsNull_No = false;
 
          patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
-                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
+                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], Slab[lv], InitPtrAsNull_No );
          patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
-                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
+                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], Slab[lv], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
-      num[lv] ++;
-
-   } // METHOD : pnew
+   } // METHOD : pnew_reserved
 
 
 
@@ -409,6 +485,132 @@ struct AMR_t
    } // METHOD : Lvdelete
 
 
+
+   //===================================================================================
+   // Method      :  SlabInit
+   // Description :  Allocate the slab objects storing fluid[], magnetic[], pot[], and pot_ext[] at all levels
+   //
+   // Note        :  1. Invoked by Init_GAMER() when OPT__PATCH_SLAB is on
+   //                2. Must be called before allocating any patch
+   //                3. No slot is allocated here
+   //===================================================================================
+   void SlabInit()
+   {
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         Slab[lv][SLAB_FLU    ] = new PatchSlab_t( sizeof(real)*NCOMP_TOTAL*CUBE(PS1),         SLAB_CHUNK_MIN );
+#        ifdef MHD
+         Slab[lv][SLAB_MAG    ] = new PatchSlab_t( sizeof(real)*NCOMP_MAG*PS1P1*SQR(PS1),      SLAB_CHUNK_MIN );
+#        endif
+#        ifdef GRAVITY
+         Slab[lv][SLAB_POT    ] = new PatchSlab_t( sizeof(real)*CUBE(PS1),                     SLAB_CHUNK_MIN );
+#        ifdef STORE_POT_GHOST
+         Slab[lv][SLAB_POT_EXT] = new PatchSlab_t( sizeof(real)*CUBE(GRA_NXT),                 SLAB_CHUNK_MIN );
+#        endif
+#        endif
+      }
+
+   } // METHOD : SlabInit
+
+
+
+   //===================================================================================
+   // Method      :  SlabCompact
+   // Description :  Compact all slabs at the target level so that the field array of (Sg, PID) is
+   //                stored in the slot 2*PID+Sg
+   //
+   // Note        :  1. Invoked after the patches at lv have been reconstructed (e.g., after Refine())
+   //                2. Scan all allocated patches (including the inactive ones of OPT__REUSE_MEMORY) and
+   //                   skip the NULL field arrays
+   //                3. A slab is left untouched if some of its slots are not referenced by any patch
+   //                4. Do nothing if OPT__PATCH_SLAB is off
+   //
+   // Parameter   :  lv : Target refinement level
+   //===================================================================================
+   void SlabCompact( const int lv )
+   {
+
+      int NAlloc = 0;
+      while ( NAlloc < MAX_PATCH  &&  patch[0][lv][NAlloc] != NULL )    NAlloc ++;
+
+      void ***PtrList = NULL;
+
+      for (int t=0; t<NSLAB; t++)
+      {
+         if ( Slab[lv][t] == NULL )    continue;
+
+         if ( PtrList == NULL )  PtrList = new void** [2*NAlloc];
+
+         int NPtr = 0;
+
+         for (int PID=0; PID<NAlloc; PID++)
+         for (int Sg=0; Sg<2; Sg++)
+         {
+            void **Ptr = patch[Sg][lv][PID]->SlabPtr( t );
+
+            if ( Ptr != NULL  &&  *Ptr != NULL )   PtrList[ NPtr ++ ] = Ptr;
+         }
+
+         Slab[lv][t]->Compact( NPtr, PtrList );
+      }
+
+      delete [] PtrList;
+
+   } // METHOD : SlabCompact
+
+
+
+   //===================================================================================
+   // Method      :  SlabView
+   // Description :  Return the address of the target field of patch 0 if the fields of patches [0, NPatch)
+   //                are stored at a fixed stride in a slab
+   //
+   // Note        :  1. Valid until the next patch allocation or deallocation at lv
+   //                2. Field of patch PID is located at Base + PID*Stride
+   //                3. Typically valid right after SlabCompact() (stride = 2*slot size for interleaved Sg)
+   //
+   // Parameter   :  SlabType : SLAB_FLU/MAG/POT/POT_EXT
+   //                Sg       : Target sandglass
+   //                lv       : Target refinement level
+   //                NPatch   : Number of patches
+   //                Stride   : Stride between two consecutive patches in bytes (output)
+   //
+   // Return      :  Base address (NULL if the fields are not stored at a fixed stride)
+   //===================================================================================
+   char* SlabView( const int SlabType, const int Sg, const int lv, const int NPatch, long &Stride )
+   {
+
+      Stride = 0;
+
+      if ( Slab[lv][SlabType] == NULL  ||  NPatch <= 0 )    return NULL;
+
+      char *Base = (char*)*patch[Sg][lv][0]->SlabPtr( SlabType );
+
+      if ( Base == NULL )  return NULL;
+
+      Stride = ( NPatch > 1 ) ? (char*)*patch[Sg][lv][1]->SlabPtr( SlabType ) - Base : 0;
+
+      if ( NPatch > 1  &&  Stride <= 0 )
+      {
+         Stride = 0;
+         return NULL;
+      }
+
+      for (int PID=1; PID<NPatch; PID++)
+      {
+         if ( (char*)*patch[Sg][lv][PID]->SlabPtr( SlabType ) != Base + PID*Stride )
+         {
+            Stride = 0;
+            return NULL;
+         }
+      }
+
+      return Base;
+
+   } // METHOD : SlabView
+
+
 }; // struct AMR_t
 
 
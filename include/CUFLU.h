@@ -254,6 +254,28 @@
 #  define HLLD_WAVESPEED   HLL_WAVESPEED_DAVIS
 
 
+// batched Riemann solvers for the CPU fluid solvers (see CPU_RiemannSolver_Batch.cpp)
+// --> solve RSOLVER_NBATCH interfaces per call using the SoA layout so that the compiler can vectorize across interfaces
+// --> only support HLLC (hydro) and HLLE (hydro/MHD) with HLL_WAVESPEED_DAVIS for now; otherwise fall back to the scalar solvers
+#if (  defined SIMD  &&  !defined __CUDACC__  &&  !defined SRHD  &&  \
+       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  \
+       (  ( RSOLVER == HLLC  &&  HLLC_WAVESPEED == HLL_WAVESPEED_DAVIS  &&  !defined MHD )  ||  \
+          ( RSOLVER == HLLE  &&  HLLE_WAVESPEED == HLL_WAVESPEED_DAVIS )  )  )
+#  define RSOLVER_BATCH
+#  define RSOLVER_NBATCH   ( 4*SIMD_NLANE )
+#endif
+
+
+// compile-time EoS for the CPU fluid kernels (see EoS_Policy.h)
+// --> invoke the conversion routines of the built-in EoS directly instead of through the function pointers
+//     in EoS_t so that they can be inlined
+// --> user-specified EoS (EOS_USER) and GPU kernels still invoke them through the function pointers
+#if (  !defined __CUDACC__  &&  \
+       ( EOS == EOS_GAMMA || EOS == EOS_ISOTHERMAL || EOS == EOS_COSMIC_RAY || EOS == EOS_TAUBMATHEWS )  )
+#  define EOS_POLICY
+#endif
+
+
 // check unphysical results in the MHM half-step prediction
 #if ( FLU_SCHEME == MHM )
 #  define MHM_CHECK_PREDICT
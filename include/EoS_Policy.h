@@ -0,0 +1,59 @@
+#ifndef __EOS_POLICY_H__
+#define __EOS_POLICY_H__
+
+
+
+#include "CUFLU.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Macro       :  EOS_CALL
+// Description :  Invoke an EoS conversion routine in the fluid kernels
+//
+// Note        :  1. EOS_POLICY on (i.e., CPU kernels with a built-in EoS; see CUFLU.h):
+//                   --> Invoke the routine of the target EoS directly so that it can be inlined into the kernels
+//                   --> The conversion functions of the target EoS are compiled into the translation unit
+//                       including this header with EOS_CONVERSION_ONLY
+//                   --> The corresponding function pointer passed to the kernels is ignored
+//                2. EOS_POLICY off (i.e., GPU kernels or EOS_USER):
+//                   --> Invoke the routine through the function pointer as usual
+//                3. Since EOS is a compile-time option, the EoS routine is fixed at compile time and there is
+//                   no runtime dispatch at all
+//                4. Usage: EOS_CALL( DensEint2Pres, EoS_DensEint2Pres )( Dens, Eint, Passive, ... )
+//
+// Parameter   :  Func    : Name of the EoS conversion routine without the "EoS_" prefix and EoS suffix
+//                FuncPtr : Function pointer to be invoked when EOS_POLICY is off
+//-------------------------------------------------------------------------------------------------------
+#ifdef EOS_POLICY
+
+#  define EOS_CONVERSION_ONLY
+
+#  if   ( EOS == EOS_GAMMA )
+#     include "../src/EoS/Gamma/CPU_EoS_Gamma.cpp"
+#     define EOS_CALL( Func, FuncPtr )    EoS_##Func##_Gamma
+#  elif ( EOS == EOS_ISOTHERMAL )
+#     include "../src/EoS/Isothermal/CPU_EoS_Isothermal.cpp"
+#     define EOS_CALL( Func, FuncPtr )    EoS_##Func##_Isothermal
+#  elif ( EOS == EOS_COSMIC_RAY )
+#     include "../src/EoS/GammaCR/CPU_EoS_GammaCR.cpp"
+#     define EOS_CALL( Func, FuncPtr )    EoS_##Func##_GammaCR
+#  elif ( EOS == EOS_TAUBMATHEWS )
+#     include "../src/EoS/TaubMathews/CPU_EoS_TaubMathews.cpp"
+#     define EOS_CALL( Func, FuncPtr )    EoS_##Func##_TaubMathews
+#  else
+#     error : ERROR : unsupported EOS for EOS_POLICY !!
+#  endif
+
+#  undef EOS_CONVERSION_ONLY
+
+#else // #ifdef EOS_POLICY
+
+#  define EOS_CALL( Func, FuncPtr )       FuncPtr
+
+#endif // #ifdef EOS_POLICY ... else ...
+
+
+
+#endif // #ifndef __EOS_POLICY_H__
@@ -44,6 +44,9 @@ const auto plan_dft_c2c_3d              = fftwf_plan_dft_3d;
 const auto plan_dft_c2c_1d              = fftwf_plan_dft_1d;
 const auto plan_dft_c2r_1d              = fftwf_plan_dft_c2r_1d;
 const auto plan_dft_r2c_1d              = fftwf_plan_dft_r2c_1d;
+const auto plan_many_dft_r2c            = fftwf_plan_many_dft_r2c;
+const auto plan_many_dft_c2r            = fftwf_plan_many_dft_c2r;
+const auto plan_many_dft_c2c            = fftwf_plan_many_dft;
 const auto cleanup                      = fftwf_cleanup;
 #ifndef SERIAL
 using      real_mpi_plan_nd             = fftwf_plan;
@@ -87,6 +90,9 @@ const auto plan_dft_c2c_3d              = fftw_plan_dft_3d;
 const auto plan_dft_c2c_1d              = fftw_plan_dft_1d;
 const auto plan_dft_c2r_1d              = fftw_plan_dft_c2r_1d;
 const auto plan_dft_r2c_1d              = fftw_plan_dft_r2c_1d;
+const auto plan_many_dft_r2c            = fftw_plan_many_dft_r2c;
+const auto plan_many_dft_c2r            = fftw_plan_many_dft_c2r;
+const auto plan_many_dft_c2c            = fftw_plan_many_dft;
 const auto cleanup                      = fftw_cleanup;
 #ifndef SERIAL
 using      real_mpi_plan_nd             = fftw_plan;
@@ -225,6 +231,59 @@ const auto destroy_complex_plan_nd = gamer_fftw::destroy_complex_mpi_plan_nd;
 #endif // #ifdef SERIAL ... # else
 #endif // # if ( SUPPORT_FFTW == FFTW3 )  ... # else
 
+
+
+#if ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  FFTW_Pencil_t
+// Description :  Data structure of the 2D pencil decomposition for the root-level FFT (OPT__FFTW_PENCIL)
+//
+// Note        :  1. MPI ranks form a NP[0]*NP[1] grid with MPI_Rank = Coord[1]*NP[0] + Coord[0]
+//                2. Three data layouts are adopted (the last index is contiguous in memory)
+//                   x-pencil (real)    : [z][y][x], x padded to 2*NxC, y split by NP[0], z split by NP[1]
+//                   y-pencil (complex) : [z][x][y], x split by NP[0], z split by NP[1]
+//                   z-pencil (complex) : [y][x][z], x split by NP[0], y split by NP[1]
+//                   --> Real-space data are stored in the x-pencil layout and k-space data in the z-pencil layout
+//                3. Initialized by Init_FFTW_Pencil() and freed by End_FFTW_Pencil()
+//
+// Data Member :  N          : FFT size including the zero-padding regions
+//                NxC        : Number of complex numbers along x after the real-to-complex FFT (= N[0]/2+1)
+//                NP         : Number of ranks along the two decomposed directions
+//                Coord      : Coordinates of this rank in the 2D rank grid
+//                Y_Start    : Starting y index of each Coord[0] in x-pencils       (size = NP[0]+1)
+//                Z_Start    : Starting z index of each Coord[1] in x/y-pencils     (size = NP[1]+1)
+//                XC_Start   : Starting complex x index of each Coord[0] in y/z-pencils (size = NP[0]+1)
+//                YK_Start   : Starting y index of each Coord[1] in z-pencils       (size = NP[1]+1)
+//                TotalSize  : Number of real elements to be allocated for each pencil array
+//                Plan_*     : FFTW plans of the batched 1D transforms along x/y/z (NULL if there is no local data)
+//                Comm_Row   : Ranks with the same Coord[1] --> x-pencils <-> y-pencils
+//                Comm_Col   : Ranks with the same Coord[0] --> y-pencils <-> z-pencils
+//-------------------------------------------------------------------------------------------------------
+struct FFTW_Pencil_t
+{
+
+   int  N[3];
+   int  NxC;
+   int  NP[2];
+   int  Coord[2];
+   int *Y_Start;
+   int *Z_Start;
+   int *XC_Start;
+   int *YK_Start;
+   long TotalSize;
+
+   gamer_fftw::plan Plan_R2C_x, Plan_C2R_x;
+   gamer_fftw::plan Plan_Forward_y, Plan_Backward_y;
+   gamer_fftw::plan Plan_Forward_z, Plan_Backward_z;
+
+#  ifndef SERIAL
+   MPI_Comm Comm_Row;
+   MPI_Comm Comm_Col;
+#  endif
+
+}; // struct FFTW_Pencil_t
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
+
 #endif  // #if ( SUPPORT_FFTW == FFTW2 || SUPPORT_FFTW == FFTW3 )
 
 #endif  // #ifndef __FFTW_H__
\ No newline at end of file
@@ -66,8 +66,10 @@ extern double     AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN;
 extern double     OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 extern bool       OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
 extern int        OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
-extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__DT_USER, OPT__DT_FLU_CACHE, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__PATCH_SLAB;
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
+extern bool       OPT__INT_CACHE;
 extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 extern bool       OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
@@ -76,6 +78,9 @@ extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID, OPT
 extern bool       OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
 extern bool       OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+extern bool       OPT__OUTPUT_HDF5_COLLECTIVE, OPT__OUTPUT_HDF5_AGGREGATE, OPT__OUTPUT_HDF5_ASYNC;
+extern bool       OPT__CPU_FUSED_SOLVER;
+extern double     OUTPUT_HDF5_ASYNC_MAX_MEM;
 extern char       OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
 extern int        OPT__UM_IC_FLOAT8;
 extern double     COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
@@ -163,9 +168,12 @@ extern double        NEWTON_G;
 extern int           POT_GPU_NPGROUP;
 extern bool          OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS;
 extern double        SOR_OMEGA;
-extern int           SOR_MAX_ITER, SOR_MIN_ITER;
+extern int           SOR_MAX_ITER, SOR_MIN_ITER, SOR_CHECK_INTERVAL;
 extern double        MG_TOLERATED_ERROR;
 extern int           MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
+extern bool          OPT__POI_LEVEL_MG;
+extern int           POI_LEVEL_MG_MAX_ITER, POI_LEVEL_MG_NPRE_SMOOTH, POI_LEVEL_MG_NPOST_SMOOTH;
+extern double        POI_LEVEL_MG_TOLERATED_ERROR;
 extern char          EXT_POT_TABLE_NAME[MAX_STRING];
 extern double        EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
 extern int           EXT_POT_TABLE_NPOINT[3], EXT_POT_TABLE_FLOAT8;
@@ -200,11 +208,12 @@ extern double     LB_INPUT__WLI_MAX;                  // LB->WLI_Max loaded from
 #ifdef PARTICLE
 extern double     LB_INPUT__PAR_WEIGHT;               // LB->Par_Weight loaded from "Input__Parameter"
 #endif
-extern bool       OPT__RECORD_LOAD_BALANCE;
+extern bool       OPT__RECORD_LOAD_BALANCE, OPT__SPARSE_MPI_EXCHANGE, OPT__LB_MEASURED_COST;
 #endif
 extern bool       OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
 extern int        OPT__FFTW_STARTUP;
+extern bool       OPT__FFTW_PENCIL;
 #if ( SUPPORT_FFTW == FFTW3 )
 extern bool       FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #endif // # if ( SUPPORT_FFTW == FFTW3 )
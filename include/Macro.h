@@ -114,6 +114,12 @@
 #define RNG_CPP11    2
 
 
+// SIMD instruction sets for the vectorized CPU kernels
+#define SIMD_PORTABLE   1
+#define SIMD_AVX2       2
+#define SIMD_AVX512     3
+
+
 // NCOMP_FLUID : number of active components in each cell (for patch->fluid[])
 //               --> do not include passive components here, which is set by NCOMP_PASSIVE
 // NFLUX_FLUID : number of active components in patch->flux[]
@@ -536,6 +542,9 @@
 #  define  PTYPE_DARK_MATTER     (real_par)2
 #  define  PTYPE_STAR            (real_par)3
 
+// number of particles processed at a time by Par_MassAssignment()
+#  define  PAR_MA_NBLOCK         64
+
 # ifdef GRAVITY
 #  define MASSIVE_PARTICLES
 # endif
@@ -840,6 +849,34 @@
 #endif
 
 
+// SIMD vector width (in bytes) and the corresponding number of "real" lanes for the vectorized CPU kernels
+// --> SIMD_PORTABLE relies on the compiler auto-vectorization and assumes a 256-bit vector
+// --> the instruction set must also be enabled by CXXFLAG (e.g., -mavx2 or -march=native)
+#ifdef SIMD
+#  if   ( SIMD == SIMD_AVX512 )
+#     define SIMD_VECTOR_BYTES   64
+#  elif ( SIMD == SIMD_AVX2  ||  SIMD == SIMD_PORTABLE )
+#     define SIMD_VECTOR_BYTES   32
+#  else
+#     error : ERROR : unsupported SIMD (SIMD_PORTABLE/SIMD_AVX2/SIMD_AVX512) !!
+#  endif
+
+#  ifdef FLOAT8
+#     define SIMD_NLANE          ( SIMD_VECTOR_BYTES/8 )
+#  else
+#     define SIMD_NLANE          ( SIMD_VECTOR_BYTES/4 )
+#  endif
+
+#  ifndef __CUDACC__
+#  if   ( SIMD == SIMD_AVX512  &&  !defined __AVX512F__ )
+#     error : ERROR : SIMD == SIMD_AVX512 but AVX-512 is not enabled by the compiler (e.g., add -mavx512f or -march=native to CXXFLAG) !!
+#  elif ( SIMD == SIMD_AVX2  &&  !defined __AVX2__ )
+#     error : ERROR : SIMD == SIMD_AVX2 but AVX2 is not enabled by the compiler (e.g., add -mavx2 -mfma or -march=native to CXXFLAG) !!
+#  endif
+#  endif
+#endif // #ifdef SIMD
+
+
 // sibling index offset for the non-periodic B.C.
 #define SIB_OFFSET_NONPERIODIC   ( -100 )
 
@@ -850,12 +887,24 @@
 #endif
 
 
-// flag used in "Buf_RecordBoundaryFlag" and "Flag_Buffer" (must be negative)
+// number of integers recorded for each flagged boundary patch in "Buf_RecordBoundaryFlag" and "Flag_Buffer"
+// --> [0] = position in BounP_PosList[], [1] = bitmask of the flagged layers > 0
 #ifndef SERIAL
-#  define BUFFER_IS_FLAGGED      ( -999 )
+#  define NFLAG_PER_BOUNP        2
 #endif
 
 
+// patch fields stored in the per-level slabs of OPT__PATCH_SLAB (see PatchSlab.h)
+#define SLAB_FLU                 0
+#define SLAB_MAG                 1
+#define SLAB_POT                 2
+#define SLAB_POT_EXT             3
+#define NSLAB                    4
+
+// minimum number of patches allocated in a new slab chunk
+#define SLAB_CHUNK_MIN           256
+
+
 // marker indicating that the array "pot_ext" has NOT been properly set
 #if ( defined GRAVITY  &&  defined STORE_POT_GHOST )
 #  define POT_EXT_NEED_INIT      __FLT_MAX__
@@ -53,7 +53,7 @@ class Par_EquilibriumIC
       void Read_Filenames( const char *filename_para);
       void Load_Physical_Params(const FP filenames,const int cloud_idx, const long NPar_AllRank);
       void Init();
-      void Par_SetEquilibriumIC(real_par *Mass_AllRank, real_par *Pos_AllRank[3], real_par *Vel_AllRank[3],const long Par_Idx);
+      void Par_SetEquilibriumIC(real_par *Mass_ThisRank, real_par *Pos_ThisRank[3], real_par *Vel_ThisRank[3],const long ParID0, const long NPar);
 
 
       PhysP params;
@@ -64,7 +64,7 @@ class Par_EquilibriumIC
       // Derive physical attributes for particles
       double Set_Mass( double x );
       double Set_Density( double x );
-      double Set_Velocity(const double x);
+      double Set_Velocity(const double x, const long ParID, long &RanCount);
 
       // Initialize physical parameter tables
       void Init_Mass();
@@ -83,7 +83,8 @@ class Par_EquilibriumIC
       int Aux_Countcolumn( const char *filename );
       int GetParams( const char *filename,const char *keyword,const int para_num,const char *para_type,vector <string> &container);
       void Check_InputFileName();
-      void RanVec_FixRadius( const double r, double RanVec[] );
+      void RanVec_FixRadius( const double r, double RanVec[], const long ParID, long &RanCount );
+      double Random( const long ParID, long &RanCount, const double Min, const double Max );
 
       // Solve Eddington's equation
       double potential(const double x);
@@ -114,8 +115,11 @@ class Par_EquilibriumIC
       double *Table_Gravity_Field;
       double *Table_Gravity_Potential;
 
-      // Random number generator
-      RandomNumber_t *Random_Num_Gen ;
+      // Mass profile for sampling the particle radius
+      double  TotM;
+      double  ParM;
+      double *Table_MassProf_r;
+      double *Table_MassProf_M;
 };
 
 
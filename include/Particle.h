@@ -51,6 +51,10 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                                          the velocity gradient is large
 //                RemoveCell              : remove particles RemoveCell-base-level-cells away from the boundary
 //                                          (for non-periodic BC only)
+//                SortInterval            : Reorder and compact the particle repository every SortInterval root-level
+//                                          steps (<=0 --> off) --> see Par_SortParticle()
+//                SparseExchange          : Exchange particles only with the ranks involved instead of all ranks
+//                                          (LOAD_BALANCE only) --> see Par_LB_SendParticleData()
 //                GhostSize               : Number of ghost zones required for interpolation scheme
 //                Attribute               : Pointer arrays to different particle attributes (Mass, Pos, Vel, ...)
 //                InactiveParList         : List of inactive particle IDs
@@ -127,6 +131,8 @@ struct Particle_t
    bool          PredictPos;
    bool          TracerVelCorr;
    double        RemoveCell;
+   int           SortInterval;
+   bool          SparseExchange;
    int           GhostSize;
    int           GhostSizeTracer;
    real_par     *Attribute[PAR_NATT_TOTAL];
@@ -196,6 +202,8 @@ struct Particle_t
       PredictPos          = true;
       TracerVelCorr       = false;
       RemoveCell          = -999.9;
+      SortInterval        = -1;
+      SparseExchange      = false;
       GhostSize           = -1;
       GhostSizeTracer     = -1;
 
@@ -5,6 +5,7 @@
 
 #include <stdio.h>
 #include "Macro.h"
+#include "PatchSlab.h"
 
 #ifdef PARTICLE
 #  include <math.h>
@@ -107,6 +108,10 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      --> For both active and inactive patches, field arrays may be allocated or == NULL
 //                                  --> However, currently the flux arrays (i.e., flux, flux_tmp, and flux_bitrep) are guaranteed
 //                                      to be NULL for inactive patches
+//                Slab            : Per-level slabs providing the storage of fluid[], magnetic[], pot[], and pot_ext[]
+//                                  (for OPT__PATCH_SLAB)
+//                                  --> Pointing to AMR_t::Slab[lv]
+//                                  --> Field arrays are allocated with new if the corresponding slab is NULL
 //                EdgeL/R         : Left and right edge of the patch
 //                                  --> Note that we always apply periodicity to EdgeL/R. So for an external patch its
 //                                      recorded "EdgeL/R" will still lie inside the simulation domain and will be
@@ -122,6 +127,10 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      3D corner coordinates
 //                                  --> This number is independent of periodicity (because of the padded patches)
 //                LB_Idx          : Space-filling-curve index for load balance
+//                LB_Cost         : Measured workload of this patch averaged over several root-level steps
+//                                  --> Used by OPT__LB_MEASURED_COST; negative --> not measured yet
+//                LB_CostNew      : Measured workload of this patch accumulated in the current root-level step
+//                                  --> Negative --> this patch is created during the current root-level step
 //                NPar            : Number of particles belonging to this leaf patch
 //                NPar_Type       : Number of different types of particles belonging to this leaf patch
 //                ParListSize     : Size of the array ParList (ParListSize can be >= NPar)
@@ -176,6 +185,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                sdelete         : Deallocate de_status[]
 //                dnew            : Allocate rho_ext[]
 //                ddelete         : Deallocate rho_ext[]
+//                SlabFree        : Return a field array to the corresponding slab
+//                SlabPtr         : Return the address of the field pointer stored in a given slab
 //                AddParticle     : Add particles to the particle list
 //                RemoveParticle  : Remove particles from the particle list
 //-------------------------------------------------------------------------------------------------------
@@ -226,11 +237,16 @@ struct patch_t
    int    son;
    bool   flag;
    bool   Active;
+   PatchSlab_t **Slab;
    double EdgeL[3];
    double EdgeR[3];
 
    ulong  PaddedCr1D;
    long   LB_Idx;
+#  ifdef LOAD_BALANCE
+   double LB_Cost;
+   double LB_CostNew;
+#  endif
 
 #  ifdef PARTICLE
    int    NPar;
@@ -271,16 +287,17 @@ struct patch_t
    //                BoxScale    : Simulation box scale
    //                BoxEdgeL    : Simulation box left edge
    //                dh_min      : Cell size at the maximum level
+   //                SlabSet     : Slabs of the target level (for OPT__PATCH_SLAB)
    //===================================================================================
    patch_t( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
             const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-            const double BoxEdgeL[], const double dh_min )
+            const double BoxEdgeL[], const double dh_min, PatchSlab_t *SlabSet[] )
    {
 
 //    always initialize field pointers (e.g., fluid, pot, ...) as NULL if they are not allocated here
       const bool InitPtrAsNull_Yes = true;
       Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, BoxScale,
-                BoxEdgeL, dh_min, InitPtrAsNull_Yes );
+                BoxEdgeL, dh_min, SlabSet, InitPtrAsNull_Yes );
 
    } // METHOD : patch_t
 
@@ -306,6 +323,7 @@ struct patch_t
    //                BoxScale      : Simulation box scale
    //                BoxEdgeL      : Simulation box left edge
    //                dh_min        : Cell size at the maximum level
+   //                SlabSet       : Slabs of the target level (for OPT__PATCH_SLAB)
    //                InitPtrAsNull : Whether or not to initialize the field arrays
    //                                (i.e., fluid, pot, pot_ext, rho_ext, de_status) as NULL
    //                                --> It is used mainly for OPT__REUSE_MEMORY, where we don't want to set these
@@ -321,7 +339,7 @@ struct patch_t
    //===================================================================================
    void Activate( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
                   const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-                  const double BoxEdgeL[], const double dh_min, const bool InitPtrAsNull )
+                  const double BoxEdgeL[], const double dh_min, PatchSlab_t *SlabSet[], const bool InitPtrAsNull )
    {
 
       corner[0] = scale_x;
@@ -331,6 +349,7 @@ struct patch_t
       son       = -1;
       flag      = false;
       Active    = true;
+      Slab      = SlabSet;
 
       for (int s=0; s<26; s++ )  sibling[s] = -1;     // -1 <--> NO sibling
 
@@ -352,6 +371,10 @@ struct patch_t
 
       PaddedCr1D = Mis_Idx3D2Idx1D( BoxNScale_Padded, Cr_Padded );   // independent of periodicity
       LB_Idx     = LB_Corner2Index( lv, corner, CHECK_OFF );         // always assumes periodicity
+#     ifdef LOAD_BALANCE
+      LB_Cost    = -1.0;                                             // -1.0 : not measured yet
+      LB_CostNew = -1.0;
+#     endif
 
 //    set the patch edge
       const int PScale = PS1*( 1<<(TOP_LEVEL-lv) );
@@ -671,14 +694,18 @@ struct patch_t
    // Method      :  hnew
    // Description :  Allocate fluid[]
    //
-   // Note        :  Do nothing if fluid[] has been allocated
+   // Note        :  1. Do nothing if fluid[] has been allocated
+   //                2. Take a slot from Slab[SLAB_FLU] for OPT__PATCH_SLAB
    //===================================================================================
    void hnew()
    {
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+         if ( Slab != NULL  &&  Slab[SLAB_FLU] != NULL )
+            fluid = ( real (*)[PS1][PS1][PS1] )Slab[SLAB_FLU]->Alloc();
+         else
+            fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
          fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -693,7 +720,7 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      if ( !SlabFree( SLAB_FLU, fluid ) )    delete [] fluid;
       fluid = NULL;
 
 #     ifdef MASSIVE_PARTICLES
@@ -710,14 +737,18 @@ struct patch_t
    // Method      :  mnew
    // Description :  Allocate magnetic[]
    //
-   // Note        :  Do nothing if magnetic[] has been allocated
+   // Note        :  1. Do nothing if magnetic[] has been allocated
+   //                2. Take a slot from Slab[SLAB_MAG] for OPT__PATCH_SLAB
    //===================================================================================
    void mnew()
    {
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         if ( Slab != NULL  &&  Slab[SLAB_MAG] != NULL )
+            magnetic = ( real (*)[ PS1P1*SQR(PS1) ] )Slab[SLAB_MAG]->Alloc();
+         else
+            magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -732,7 +763,7 @@ struct patch_t
    void mdelete()
    {
 
-      delete [] magnetic;
+      if ( !SlabFree( SLAB_MAG, magnetic ) )    delete [] magnetic;
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -745,15 +776,26 @@ struct patch_t
    // Method      :  gnew
    // Description :  Allocate pot[] (and pot_ext[] for STORE_POT_GHOST)
    //
-   // Note        :  Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   // Note        :  1. Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   //                2. Take slots from Slab[SLAB_POT/SLAB_POT_EXT] for OPT__PATCH_SLAB
    //===================================================================================
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      const bool UseSlab = ( Slab != NULL  &&  Slab[SLAB_POT] != NULL );
+
+      if ( pot == NULL )
+      {
+         if ( UseSlab )    pot = ( real (*)[PS1][PS1] )Slab[SLAB_POT]->Alloc();
+         else              pot = new real [PS1][PS1][PS1];
+      }
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )
+      {
+         if ( UseSlab )    pot_ext = ( real (*)[GRA_NXT][GRA_NXT] )Slab[SLAB_POT_EXT]->Alloc();
+         else              pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      }
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
@@ -771,11 +813,11 @@ struct patch_t
    void gdelete()
    {
 
-      delete [] pot;
+      if ( !SlabFree( SLAB_POT, pot ) )   delete [] pot;
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
-      delete [] pot_ext;
+      if ( !SlabFree( SLAB_POT_EXT, pot_ext ) )    delete [] pot_ext;
       pot_ext = NULL;
 #     endif
 
@@ -818,6 +860,57 @@ struct patch_t
 
 
 
+   //===================================================================================
+   // Method      :  SlabFree
+   // Description :  Return a field array to Slab[SlabType]
+   //
+   // Note        :  Used by hdelete(), mdelete(), and gdelete()
+   //
+   // Return      :  true  --> the array has been returned to the slab
+   //                false --> the array is not stored in the slab and must be deallocated with delete []
+   //===================================================================================
+   bool SlabFree( const int SlabType, void *Ptr )
+   {
+
+      if ( Slab == NULL  ||  Slab[SlabType] == NULL )    return false;
+
+      return Slab[SlabType]->Free( Ptr );
+
+   } // METHOD : SlabFree
+
+
+
+   //===================================================================================
+   // Method      :  SlabPtr
+   // Description :  Return the address of the field pointer stored in Slab[SlabType]
+   //
+   // Note        :  1. Used by AMR_t::SlabCompact() and AMR_t::SlabView()
+   //                2. Return NULL if the target field is not compiled
+   //
+   // Parameter   :  SlabType : SLAB_FLU/MAG/POT/POT_EXT
+   //===================================================================================
+   void** SlabPtr( const int SlabType )
+   {
+
+      switch ( SlabType )
+      {
+         case SLAB_FLU     :  return (void**)&fluid;
+#        ifdef MHD
+         case SLAB_MAG     :  return (void**)&magnetic;
+#        endif
+#        ifdef GRAVITY
+         case SLAB_POT     :  return (void**)&pot;
+#        ifdef STORE_POT_GHOST
+         case SLAB_POT_EXT :  return (void**)&pot_ext;
+#        endif
+#        endif
+         default           :  return NULL;
+      }
+
+   } // METHOD : SlabPtr
+
+
+
 #  ifdef PARTICLE
 #  ifdef GRAVITY
    //===================================================================================
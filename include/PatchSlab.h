@@ -0,0 +1,361 @@
+#ifndef __PATCHSLAB_H__
+#define __PATCHSLAB_H__
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "Macro.h"
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PatchSlab_t
+// Description :  Fixed-stride storage of one patch field (e.g., fluid[]) for all patches at one level
+//
+// Note        :  1. Used by OPT__PATCH_SLAB
+//                   --> patch_t::hnew/mnew/gnew take slots from the slab instead of allocating each
+//                       array with new
+//                2. Slots are grown in chunks, which never move, so that field pointers remain valid
+//                   when new patches are allocated
+//                3. Compact() moves all used slots to a single allocation in the given order
+//                   --> Invoked by AMR_t::SlabCompact() after each regrid so that patch PID is located
+//                       at a fixed stride from patch 0
+//                4. Alloc() and Free() are thread-safe
+//
+// Data Member :  SlotSize   : Size of one slot in bytes
+//                ChunkMin   : Minimum number of slots allocated in a new chunk
+//                NChunk     : Number of chunks
+//                Chunk      : Chunk pointers
+//                ChunkNSlot : Number of slots in each chunk
+//                ChunkSlot0 : Global slot index of the first slot in each chunk
+//                NSlot      : Total number of slots in all chunks
+//                NUsed      : Number of slots in use
+//                NFree      : Number of free slots
+//                FreeList   : Global indices of the free slots (stack, with the smallest index on the top)
+//
+// Method      :  PatchSlab_t : Constructor
+//               ~PatchSlab_t : Destructor
+//                Alloc       : Get a free slot
+//                Free        : Return a slot
+//                Compact     : Move all used slots to a single allocation in the given order
+//-------------------------------------------------------------------------------------------------------
+struct PatchSlab_t
+{
+
+// data members
+// ===================================================================================
+   long   SlotSize;
+   int    ChunkMin;
+   int    NChunk;
+   char **Chunk;
+   int   *ChunkNSlot;
+   int   *ChunkSlot0;
+   int    NSlot;
+   int    NUsed;
+   int    NFree;
+   int   *FreeList;
+
+
+
+   //===================================================================================
+   // Constructor :  PatchSlab_t
+   // Description :  Constructor of the structure "PatchSlab_t"
+   //
+   // Note        :  No slot is allocated here
+   //
+   // Parameter   :  SlotSize_In : Size of one slot in bytes
+   //                ChunkMin_In : Minimum number of slots allocated in a new chunk
+   //===================================================================================
+   PatchSlab_t( const long SlotSize_In, const int ChunkMin_In )
+   {
+
+      SlotSize   = SlotSize_In;
+      ChunkMin   = ChunkMin_In;
+      NChunk     = 0;
+      Chunk      = NULL;
+      ChunkNSlot = NULL;
+      ChunkSlot0 = NULL;
+      NSlot      = 0;
+      NUsed      = 0;
+      NFree      = 0;
+      FreeList   = NULL;
+
+   } // METHOD : PatchSlab_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~PatchSlab_t
+   // Description :  Destructor of the structure "PatchSlab_t"
+   //
+   // Note        :  Deallocate all chunks
+   //===================================================================================
+   ~PatchSlab_t()
+   {
+
+      for (int c=0; c<NChunk; c++)  free( Chunk[c] );
+
+      free( Chunk );
+      free( ChunkNSlot );
+      free( ChunkSlot0 );
+      free( FreeList );
+
+   } // METHOD : ~PatchSlab_t
+
+
+
+   //===================================================================================
+   // Method      :  Alloc
+   // Description :  Get a free slot
+   //
+   // Note        :  1. Allocate a new chunk with max( ChunkMin, NSlot/4 ) slots if there is no free slot
+   //                2. Thread-safe
+   //
+   // Return      :  Pointer to the slot
+   //===================================================================================
+   void* Alloc()
+   {
+
+      void *Ptr = NULL;
+
+#     pragma omp critical( PatchSlab )
+      {
+         if ( NFree == 0 )    AddChunk( MAX( ChunkMin, NSlot/4 ) );
+
+         Ptr = SlotAddress( FreeList[ --NFree ] );
+         NUsed ++;
+      }
+
+      return Ptr;
+
+   } // METHOD : Alloc
+
+
+
+   //===================================================================================
+   // Method      :  Free
+   // Description :  Return the slot of the input pointer
+   //
+   // Note        :  1. Do nothing if the pointer is NULL or does not lie in this slab
+   //                   --> The caller should deallocate it with delete [] in the latter case
+   //                2. Thread-safe
+   //
+   // Parameter   :  Ptr : Pointer to be freed
+   //
+   // Return      :  true/false --> the pointer is/is not a slot of this slab
+   //===================================================================================
+   bool Free( void *Ptr )
+   {
+
+      bool Owned = false;
+
+      if ( Ptr == NULL )   return Owned;
+
+#     pragma omp critical( PatchSlab )
+      {
+         const int Slot = SlotIndex( Ptr );
+
+         if ( Slot >= 0 )
+         {
+            FreeList[ NFree ++ ] = Slot;
+            NUsed --;
+            Owned = true;
+         }
+      }
+
+      return Owned;
+
+   } // METHOD : Free
+
+
+
+   //===================================================================================
+   // Method      :  Compact
+   // Description :  Move all used slots to a single allocation so that the i-th pointer in PtrList[]
+   //                is stored in the i-th slot
+   //
+   // Note        :  1. PtrList[] stores the addresses of the field pointers (e.g., &patch->fluid), which
+   //                   are updated here
+   //                2. Do nothing and return false if PtrList[] does not cover all used slots
+   //                3. Slots are swapped in place if there is already a single chunk large enough
+   //                   --> Only misplaced slots are moved, which is cheap after a regrid that appends
+   //                       or removes a few patch groups
+   //                4. Otherwise all chunks are merged into a new allocation with NPtr/8 extra slots
+   //                5. Not thread-safe
+   //
+   // Parameter   :  NPtr    : Number of pointers in PtrList[]
+   //                PtrList : Addresses of the field pointers to be compacted
+   //
+   // Return      :  true/false --> compacted/skipped
+   //===================================================================================
+   bool Compact( const int NPtr, void **PtrList[] )
+   {
+
+      if ( NPtr != NUsed )    return false;
+      if ( NChunk == 0 )      return true;
+
+//    1. in-place swap within a single chunk
+      if ( NChunk == 1  &&  NSlot >= NPtr )
+      {
+         int  *Slot  = new int [NPtr];
+         int  *Owner = new int [NSlot];
+         char *Tmp   = new char [SlotSize];
+
+         for (int j=0; j<NSlot; j++)   Owner[j] = -1;
+
+         for (int i=0; i<NPtr; i++)
+         {
+            Slot[i] = SlotIndex( *PtrList[i] );
+
+            if ( Slot[i] < 0 )
+            {
+               delete [] Slot;
+               delete [] Owner;
+               delete [] Tmp;
+
+               return false;
+            }
+
+            Owner[ Slot[i] ] = i;
+         }
+
+         for (int i=0; i<NPtr; i++)
+         {
+            if ( Slot[i] == i )  continue;
+
+//          swap the contents of slot i and the current slot of item i
+            const int j = Slot[i];
+            const int k = Owner[i];    // current owner of slot i (-1 if free)
+
+            memcpy( Tmp,            Chunk[0]+i*SlotSize, SlotSize );
+            memcpy( Chunk[0]+i*SlotSize, Chunk[0]+j*SlotSize, SlotSize );
+            memcpy( Chunk[0]+j*SlotSize, Tmp,            SlotSize );
+
+            Slot [i] = i;
+            Owner[i] = i;
+            Owner[j] = k;
+            if ( k >= 0 )  Slot[k] = j;
+         }
+
+         delete [] Slot;
+         delete [] Owner;
+         delete [] Tmp;
+      }
+
+//    2. merge all chunks into a new allocation
+      else
+      {
+         const int NewNSlot = NPtr + MAX( ChunkMin, NPtr/8 );
+         char *NewChunk = (char*)malloc( NewNSlot*SlotSize );
+
+         if ( NewChunk == NULL )    Aux_Error( ERROR_INFO, "failed to allocate %ld bytes !!\n", NewNSlot*SlotSize );
+
+         for (int i=0; i<NPtr; i++)
+         {
+            if ( SlotIndex( *PtrList[i] ) < 0 )
+            {
+               free( NewChunk );
+               return false;
+            }
+
+            memcpy( NewChunk+i*SlotSize, *PtrList[i], SlotSize );
+         }
+
+         for (int c=0; c<NChunk; c++)  free( Chunk[c] );
+
+         NChunk = 0;
+         NSlot  = 0;
+         AppendChunk( NewChunk, NewNSlot );
+      }
+
+//    3. reset the field pointers and the free list
+      for (int i=0; i<NPtr; i++)    *PtrList[i] = Chunk[0] + i*SlotSize;
+
+      NFree = 0;
+      for (int j=NSlot-1; j>=NPtr; j--)   FreeList[ NFree ++ ] = j;
+
+      return true;
+
+   } // METHOD : Compact
+
+
+
+   //===================================================================================
+   // Method      :  SlotAddress / SlotIndex
+   // Description :  Convert between the global slot index and the slot address
+   //
+   // Note        :  SlotIndex() returns -1 if the pointer does not lie in any chunk
+   //===================================================================================
+   void* SlotAddress( const int Slot ) const
+   {
+
+      int c = NChunk - 1;
+      while ( ChunkSlot0[c] > Slot )   c --;
+
+      return Chunk[c] + (long)( Slot - ChunkSlot0[c] )*SlotSize;
+
+   } // METHOD : SlotAddress
+
+   int SlotIndex( const void *Ptr ) const
+   {
+
+      const char *P = (const char*)Ptr;
+
+      for (int c=0; c<NChunk; c++)
+      {
+         if ( P >= Chunk[c]  &&  P < Chunk[c] + (long)ChunkNSlot[c]*SlotSize )
+            return ChunkSlot0[c] + (int)( ( P - Chunk[c] ) / SlotSize );
+      }
+
+      return -1;
+
+   } // METHOD : SlotIndex
+
+
+
+   //===================================================================================
+   // Method      :  AddChunk / AppendChunk
+   // Description :  Allocate a new chunk / register an allocated chunk and push its slots to the free list
+   //
+   // Note        :  Slots are pushed in descending order so that Alloc() returns the smallest free index
+   //===================================================================================
+   void AddChunk( const int NNew )
+   {
+
+      char *NewChunk = (char*)malloc( NNew*SlotSize );
+
+      if ( NewChunk == NULL )    Aux_Error( ERROR_INFO, "failed to allocate %ld bytes !!\n", NNew*SlotSize );
+
+      AppendChunk( NewChunk, NNew );
+
+      for (int j=NSlot-1; j>=NSlot-NNew; j--)   FreeList[ NFree ++ ] = j;
+
+   } // METHOD : AddChunk
+
+   void AppendChunk( char *NewChunk, const int NNew )
+   {
+
+      Chunk      = (char**)realloc( Chunk,      (NChunk+1)*sizeof(char*) );
+      ChunkNSlot = (int*  )realloc( ChunkNSlot, (NChunk+1)*sizeof(int  ) );
+      ChunkSlot0 = (int*  )realloc( ChunkSlot0, (NChunk+1)*sizeof(int  ) );
+      FreeList   = (int*  )realloc( FreeList,   (NSlot+NNew)*sizeof(int) );
+
+      Chunk     [NChunk] = NewChunk;
+      ChunkNSlot[NChunk] = NNew;
+      ChunkSlot0[NChunk] = NSlot;
+
+      NChunk ++;
+      NSlot += NNew;
+
+   } // METHOD : AppendChunk
+
+
+}; // struct PatchSlab_t
+
+
+
+#endif // #ifndef __PATCHSLAB_H__
@@ -93,7 +93,7 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
                       const bool FracPassive, const int NFrac, const int FracIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff );
+                      const bool JeansMinPres, const real JeansMinPres_Coeff, const int Work_PG0 );
 void Hydro_NormalizePassive( const real GasDens, real Passive[], const int NNorm, const int NormIdx[] );
 #if ( MODEL == HYDRO )
 real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
@@ -199,6 +199,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                         const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency );
+void Prepare_PatchData_InitIntCache( const int lv );
+void Prepare_PatchData_FreeIntCache( const int lv );
 
 
 // Init
@@ -245,6 +247,18 @@ void Patch2Slab( real *VarS, real *SendBuf_Var, real *RecvBuf_Var, long *SendBuf
 void Slab2Patch( const real *VarS, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_SIdx,
                  int **List_PID, int **List_k, long *List_NSend, long *List_NRecv, const int local_nz, const int FFT_Size[],
                  const int NSendSlice, const long TVar, const bool InPlacePad );
+#if ( SUPPORT_FFTW == FFTW3 )
+struct FFTW_Pencil_t;
+void Init_FFTW_Pencil( FFTW_Pencil_t &Pencil, const int FFT_Size[], const int StartupFlag );
+void End_FFTW_Pencil( FFTW_Pencil_t &Pencil );
+void FFTW_Pencil_Forward( const FFTW_Pencil_t &Pencil, real *Data, real *Work );
+void FFTW_Pencil_Backward( const FFTW_Pencil_t &Pencil, real *Data, real *Work );
+void Patch2Pencil( real *VarP, const FFTW_Pencil_t &Pencil, long **RecvBuf_PIdx, int **List_PID, int **List_jk,
+                   long *List_NSendRow, long *List_NRecvRow, const double PrepTime, const long TVar,
+                   const bool ForPoisson, const bool AddExtraMass );
+void Pencil2Patch( const real *VarP, const FFTW_Pencil_t &Pencil, long *RecvBuf_PIdx, int **List_PID, int **List_jk,
+                   long *List_NSendRow, long *List_NRecvRow, const int SaveSg, const long TVar );
+#endif
 #endif // #ifdef SUPPORT_FFTW
 void Microphysics_Init();
 void Microphysics_End();
@@ -279,6 +293,11 @@ double Mis_Scale2PhySize( const int Scale );
 double Mis_Cell2PhySize( const int NCell, const int lv );
 int    Mis_Scale2Cell( const int Scale, const int lv );
 int    Mis_Cell2Scale( const int NCell, const int lv );
+void   Mis_AcquireScratch();
+void   Mis_ReleaseScratch();
+void  *Mis_GetScratch( const ScratchSlot_t Slot, const long Size );
+void   Mis_GetScratchInfo( long &NByte, long &NAlloc );
+void   Mis_FreeScratch();
 double dt_InvokeSolver( const Solver_t TSolver, const int lv );
 void   dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
                        real h_Mag_Array_T[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG, const int *PID0_List );
@@ -303,6 +322,9 @@ void MPI_ExchangeData( const int TargetRank[2], const int SendSize[2], const int
                        real *SendBuffer[2], real *RecvBuffer[2] );
 void MPI_Exit();
 template <typename T> void MPI_Alltoallv_GAMER( T * SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_DataType, MPI_Comm comm );
+template <typename T> void MPI_Alltoallv_Sparse( T * SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_DataType );
+void MPI_Alltoallv_Sparse_NBX( char *SendBuf, const long *Send_NByte, const long *Send_NDisp, char *&RecvBuf, long *Recv_NByte, long *Recv_NDisp );
+void MPI_Alltoallv_Sparse_MemFree();
 #endif // #ifndef SERIAL
 
 
@@ -313,6 +335,7 @@ void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, cons
 void Output_DumpData_Total( const char *FileName );
 #ifdef SUPPORT_HDF5
 void Output_DumpData_Total_HDF5( const char *FileName );
+void Output_DumpData_Total_HDF5_Flush();
 #endif
 void Output_DumpManually( int &Dump_global );
 void Output_FlagMap( const int lv, const int xyz, const char *comment );
@@ -421,6 +444,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
                       const int NPG, const int *PID0_List );
 void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][RHO_NXT][RHO_NXT][RHO_NXT],
                       const int NPG, const int *PID0_List );
+void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[], const int NGhost,
+                      const int NPG, const int *PID0_List );
+void Poi_LevelSolver_MG( const int lv, const double PrepTime, const real Poi_Coeff, const int SaveSg );
 #ifdef STORE_POT_GHOST
 void Poi_StorePotWithGhostZone( const int lv, const int PotSg, const bool AllPatch );
 #endif
@@ -479,6 +505,8 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
                      long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight );
 void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
 double LB_EstimateLoadImbalance();
+void LB_RecordMeasuredCost( const int lv, const int NPG, const int *PID0_List, const double Cost );
+void LB_UpdateMeasuredCost();
 void LB_SetCutPoint( const int lv, long *CutPoint, const bool InputLBIdx0AndLoad, long *LBIdx0_AllRank_Input,
                      double *Load_AllRank_Input, const double ParWeight );
 void LB_Output_LBIdx( const int lv );
@@ -694,6 +722,7 @@ void Prepare_PatchData_FreeParticleDensityArray( const int lv );
 void Par_PredictPos( const long NPar, const long *ParList, real_par *ParPosX, real_par *ParPosY, real_par *ParPosZ,
                      const double TargetTime );
 void Par_Init_Attribute();
+void Par_SortParticle();
 void Par_AddParticleAfterInit( const long NNewPar, real_par *NewParAtt[PAR_NATT_TOTAL] );
 void Par_ScatterParticleData( const long NPar_ThisRank, const long NPar_AllRank, const long AttBitIdx,
                               real_par *Data_Send[PAR_NATT_TOTAL], real_par *Data_Recv[PAR_NATT_TOTAL] );
@@ -499,6 +499,23 @@ const ExtremaMode_t
    EXTREMA_MAX = 2;
 
 
+// scratch slots in Mis_GetScratch()
+typedef int ScratchSlot_t;
+const ScratchSlot_t
+   SCRATCH_PREP_CC       = 0,
+   SCRATCH_PREP_FC       = 1,
+   SCRATCH_PREP_INT_CC   = 2,
+   SCRATCH_PREP_INT_FC   = 3,
+   SCRATCH_PREP_INT_TIME = 4,
+   SCRATCH_PREP_FINT     = 5,
+   SCRATCH_INTGZ_CC      = 6,
+   SCRATCH_INTGZ_FC      = 7,
+   SCRATCH_INTGZ_MAG     = 8,
+   SCRATCH_PAR_ATT       = 9,
+   SCRATCH_PAR_SORT      = 10,
+   NSCRATCH              = 11;
+
+
 // function pointers
 typedef real (*EoS_GUESS_t)    ( const real Con[], real* const Constant, const double AuxArray_Flt[],
                                  const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] );
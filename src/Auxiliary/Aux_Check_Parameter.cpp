@@ -98,6 +98,9 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "please turn on SUPPORT_HDF5 in the Makefile for OPT__OUTPUT_TOTAL == 1 !!\n" );
 #  endif
 
+   if ( OPT__OUTPUT_HDF5_AGGREGATE  &&  !OPT__OUTPUT_HDF5_COLLECTIVE )
+      Aux_Error( ERROR_INFO, "OPT__OUTPUT_HDF5_AGGREGATE must work with OPT__OUTPUT_HDF5_COLLECTIVE !!\n" );
+
    if (  ( OPT__OUTPUT_PART == OUTPUT_YZ  ||  OPT__OUTPUT_PART == OUTPUT_Y  ||  OPT__OUTPUT_PART == OUTPUT_Z )  &&
          ( OUTPUT_PART_X < 0.0  ||  OUTPUT_PART_X >= amr->BoxSize[0] )  )
       Aux_Error( ERROR_INFO, "incorrect OUTPUT_PART_X (out of range [0<=X<%lf]) !!\n", amr->BoxSize[0] );
@@ -177,9 +180,6 @@ void Aux_Check_Parameter()
                  "OVERLAP_MPI", "OPT__OVERLAP_MPI" );
 #  endif
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
-
    if ( AUTO_REDUCE_DT )
    {
       if ( OPT__OVERLAP_MPI )
@@ -229,6 +229,9 @@ void Aux_Check_Parameter()
    if ( OPT__MEMORY_POOL  &&  !OPT__REUSE_MEMORY )
       Aux_Error( ERROR_INFO, "please turn on OPT__REUSE_MEMORY for OPT__MEMORY_POOL !!\n" );
 
+   if ( OPT__PATCH_SLAB  &&  !OPT__REUSE_MEMORY )
+      Aux_Error( ERROR_INFO, "please turn on OPT__REUSE_MEMORY for OPT__PATCH_SLAB !!\n" );
+
    if ( OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_NONE  &&  OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_EVERY_STEP  &&
         OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_BEFORE_DUMP )
       Aux_Error( ERROR_INFO, "incorrect option \"OPT__CORR_AFTER_ALL_SYNC = %d\" [0/1/2] !!\n", OPT__CORR_AFTER_ALL_SYNC );
@@ -287,6 +290,11 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "must enable either SERIAL or LOAD_BALANCE for OPT__INIT=3 !!\n" );
 #  endif
 
+#  if ( defined SUPPORT_FFTW  &&  SUPPORT_FFTW != FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+      Aux_Error( ERROR_INFO, "OPT__FFTW_PENCIL only supports SUPPORT_FFTW=FFTW3 !!\n" );
+#  endif
+
    if ( OPT__OUTPUT_USER_FIELD )
    {
       int NDerField = UserDerField_Num;
@@ -421,7 +429,7 @@ void Aux_Check_Parameter()
 
    if ( OPT__OVERLAP_MPI )
    {
-      Aux_Message( stderr, "WARNING : \"%s\" is still experimental and is not fully optimized !!\n",
+      Aux_Message( stderr, "WARNING : \"%s\" is still experimental and only applies to the fluid solver !!\n",
                    "OPT__OVERLAP_MPI" );
 
 #     ifdef OPENMP
@@ -1361,6 +1369,18 @@ void Aux_Check_Parameter()
    if ( MG_TOLERATED_ERROR < 0.0 )     Aux_Error( ERROR_INFO, "MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", MG_TOLERATED_ERROR );
 #  endif
 
+   if ( OPT__POI_LEVEL_MG )
+   {
+      if ( POI_LEVEL_MG_MAX_ITER < 0 )
+         Aux_Error( ERROR_INFO, "POI_LEVEL_MG_MAX_ITER (%d) < 0 !!\n", POI_LEVEL_MG_MAX_ITER );
+      if ( POI_LEVEL_MG_NPRE_SMOOTH < 0 )
+         Aux_Error( ERROR_INFO, "POI_LEVEL_MG_NPRE_SMOOTH (%d) < 0 !!\n", POI_LEVEL_MG_NPRE_SMOOTH );
+      if ( POI_LEVEL_MG_NPOST_SMOOTH < 0 )
+         Aux_Error( ERROR_INFO, "POI_LEVEL_MG_NPOST_SMOOTH (%d) < 0 !!\n", POI_LEVEL_MG_NPOST_SMOOTH );
+      if ( POI_LEVEL_MG_TOLERATED_ERROR < 0.0 )
+         Aux_Error( ERROR_INFO, "POI_LEVEL_MG_TOLERATED_ERROR (%14.7e) < 0.0 !!\n", POI_LEVEL_MG_TOLERATED_ERROR );
+   }
+
 #  if ( NLEVEL > 1 )
    int Trash_RefPot, NGhost_RefPot;
    Int_Table( OPT__REF_POT_INT_SCHEME, Trash_RefPot, NGhost_RefPot );
@@ -1386,6 +1406,15 @@ void Aux_Check_Parameter()
    }
 #  endif
 
+   if ( OPT__POI_LEVEL_MG  &&  !OPT__SELF_GRAVITY )
+      Aux_Message( stderr, "WARNING : OPT__POI_LEVEL_MG is useless when OPT__SELF_GRAVITY is disabled !!\n" );
+
+#  if ( POT_SCHEME == SOR  &&  defined GPU )
+   if ( SOR_CHECK_INTERVAL != 1 )
+      Aux_Message( stderr, "WARNING : SOR_CHECK_INTERVAL (%d) is useless for the GPU Poisson solver !!\n",
+                   SOR_CHECK_INTERVAL );
+#  endif
+
    if ( DT__GRAVITY < 0.0  ||  DT__GRAVITY > 1.0 )
       Aux_Message( stderr, "WARNING : DT__GRAVITY (%14.7e) is not within the normal range [0...1] !!\n",
                    DT__GRAVITY );
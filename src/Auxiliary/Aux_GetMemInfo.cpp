@@ -11,6 +11,8 @@
 //                   (1) VmSize/Peak : current/peak virtual  memory size
 //                   (2) VmRSS/HWM   : current/peak physical memory size
 //                2. Only the maximum values among all MPI ranks will be recorded
+//                3. Also record the size and the number of allocations of the per-thread scratch arenas
+//                   (see Mis_GetScratch())
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -26,6 +28,7 @@ void Aux_GetMemInfo()
    char   VmSize[MAX_STRING], VmPeak[MAX_STRING], VmRSS[MAX_STRING], VmHWM[MAX_STRING];
    bool   GetVmSize=false, GetVmPeak=false, GetVmRSS=false, GetVmHWM=false;
    double Vm_double[NInfo], Vm_max[NInfo], Vm_sum[NInfo];
+   long   Scr_NByte, Scr_NAlloc, Scr_Local[2], Scr_Max[2];
    size_t len=0;
 
 
@@ -91,6 +94,12 @@ void Aux_GetMemInfo()
    MPI_Reduce( Vm_double, Vm_max, NInfo, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
    MPI_Reduce( Vm_double, Vm_sum, NInfo, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
+   Mis_GetScratchInfo( Scr_NByte, Scr_NAlloc );
+   Scr_Local[0] = Scr_NByte;
+   Scr_Local[1] = Scr_NAlloc;
+
+   MPI_Reduce( Scr_Local, Scr_Max, 2, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD );
+
 
 // 3. record memory information
    if ( MPI_Rank == 0 )
@@ -109,19 +118,23 @@ void Aux_GetMemInfo()
          fprintf( File_Record, "# Phy_Max  : maximum physical memory size of a single process at the present\n" );
          fprintf( File_Record, "# Phy_Sum  : total   physical memory size of all processes    at the present\n" );
          fprintf( File_Record, "# Phy_Peak : maximum physical memory size of a single process during the entire simulation\n" );
+         fprintf( File_Record, "# Scr_Peak : maximum scratch  memory size of a single process during the entire simulation\n" );
+         fprintf( File_Record, "# Scr_NAll : maximum number of scratch memory allocations of a single process so far\n" );
          fprintf( File_Record, "#------------------------------------------------------------------------------------------\n\n" );
-         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s\n",
+         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s%20s%14s\n",
                   "Time", "Step", " ",
                   "Vir_Max (MB)", "Vir_Sum (MB)", "Vir_Peak (MB)",
-                  "Phy_Max (MB)", "Phy_Sum (MB)", "Phy_Peak (MB)" );
+                  "Phy_Max (MB)", "Phy_Sum (MB)", "Phy_Peak (MB)",
+                  "Scr_Peak (MB)", "Scr_NAll" );
          fclose( File_Record );
       }
 
       FILE *File_Record = fopen( FileName_Record, "a" );
-      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f\n",
+      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f%14ld\n",
                Time[0], Step,
                Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0,
-               Vm_max[2]/1024.0, Vm_sum[2]/1024.0, Vm_max[3]/1024.0 );
+               Vm_max[2]/1024.0, Vm_sum[2]/1024.0, Vm_max[3]/1024.0,
+               Scr_Max[0]/1048576.0, Scr_Max[1] );
       fclose( File_Record );
 
    } // if ( MPI_Rank == 0 )
@@ -831,6 +831,8 @@ void Aux_TakeNote()
       fprintf( Note, "Par->GhostSizeTracer           % d\n",      amr->Par->GhostSizeTracer     );
       fprintf( Note, "Par->TracerVelCorr             % d\n",      amr->Par->TracerVelCorr       );
       fprintf( Note, "OPT__FREEZE_PAR                % d\n",      OPT__FREEZE_PAR               );
+      fprintf( Note, "Par->SortInterval              % d\n",      amr->Par->SortInterval        );
+      fprintf( Note, "Par->SparseExchange            % d\n",      amr->Par->SparseExchange      );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 #     endif
@@ -877,6 +879,7 @@ void Aux_TakeNote()
       fprintf( Note, "DT__SYNC_PARENT_LV             % 14.7e\n",  DT__SYNC_PARENT_LV          );
       fprintf( Note, "DT__SYNC_CHILDREN_LV           % 14.7e\n",  DT__SYNC_CHILDREN_LV        );
       fprintf( Note, "OPT__DT_USER                   % d\n",      OPT__DT_USER                );
+      fprintf( Note, "OPT__DT_FLU_CACHE              % d\n",      OPT__DT_FLU_CACHE           );
       fprintf( Note, "OPT__DT_LEVEL                  % d\n",      OPT__DT_LEVEL               );
       fprintf( Note, "AUTO_REDUCE_DT                 % d\n",      AUTO_REDUCE_DT              );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR          % 14.7e\n",  AUTO_REDUCE_DT_FACTOR       );
@@ -950,6 +953,7 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY              % d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL               % d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__PATCH_SLAB                % d\n",      OPT__PATCH_SLAB           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -972,6 +976,8 @@ void Aux_TakeNote()
       fprintf( Note, "LB_PAR_WEIGHT                  % 14.7e\n",  amr->LB->Par_Weight       );
 #     endif
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE       % d\n",      OPT__RECORD_LOAD_BALANCE  );
+      fprintf( Note, "OPT__SPARSE_MPI_EXCHANGE       % d\n",      OPT__SPARSE_MPI_EXCHANGE  );
+      fprintf( Note, "OPT__LB_MEASURED_COST          % d\n",      OPT__LB_MEASURED_COST     );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER      % d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -1139,6 +1145,7 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "FLU_GPU_NPGROUP                % d\n",      FLU_GPU_NPGROUP          );
       fprintf( Note, "GPU_NSTREAM                    % d\n",      GPU_NSTREAM              );
+      fprintf( Note, "OPT__CPU_FUSED_SOLVER          % d\n",      OPT__CPU_FUSED_SOLVER    );
       fprintf( Note, "OPT__FIXUP_FLUX                % d\n",      OPT__FIXUP_FLUX          );
 
 //    target scalars to be applied fix-up flux operations
@@ -1248,12 +1255,19 @@ void Aux_TakeNote()
       fprintf( Note, "SOR_OMEGA                      % 14.7e\n",  SOR_OMEGA               );
       fprintf( Note, "SOR_MAX_ITER                   % d\n",      SOR_MAX_ITER            );
       fprintf( Note, "SOR_MIN_ITER                   % d\n",      SOR_MIN_ITER            );
+      fprintf( Note, "SOR_CHECK_INTERVAL             % d\n",      SOR_CHECK_INTERVAL      );
 #     elif ( POT_SCHEME == MG )
       fprintf( Note, "MG_MAX_ITER                    % d\n",      MG_MAX_ITER             );
       fprintf( Note, "MG_NPRE_SMOOTH                 % d\n",      MG_NPRE_SMOOTH          );
       fprintf( Note, "MG_NPOST_SMOOTH                % d\n",      MG_NPOST_SMOOTH         );
       fprintf( Note, "MG_TOLERATED_ERROR             % 14.7e\n",  MG_TOLERATED_ERROR      );
 #     endif
+      fprintf( Note, "OPT__POI_LEVEL_MG              % d\n",      OPT__POI_LEVEL_MG       );
+      if ( OPT__POI_LEVEL_MG ) {
+      fprintf( Note, "POI_LEVEL_MG_MAX_ITER          % d\n",      POI_LEVEL_MG_MAX_ITER   );
+      fprintf( Note, "POI_LEVEL_MG_NPRE_SMOOTH       % d\n",      POI_LEVEL_MG_NPRE_SMOOTH  );
+      fprintf( Note, "POI_LEVEL_MG_NPOST_SMOOTH      % d\n",      POI_LEVEL_MG_NPOST_SMOOTH );
+      fprintf( Note, "POI_LEVEL_MG_TOLERATED_ERROR   % 14.7e\n",  POI_LEVEL_MG_TOLERATED_ERROR ); }
       fprintf( Note, "POT_GPU_NPGROUP                % d\n",      POT_GPU_NPGROUP         );
       fprintf( Note, "OPT__GRA_P5_GRADIENT           % d\n",      OPT__GRA_P5_GRADIENT    );
       fprintf( Note, "OPT__SELF_GRAVITY              % d\n",      OPT__SELF_GRAVITY       );
@@ -1309,6 +1323,7 @@ void Aux_TakeNote()
 
          default:                       fprintf( Note, "UNKNOWN\n" );
       } // switch ( OPT__FFTW_STARTUP )
+      fprintf( Note, "OPT__FFTW_PENCIL               % d\n",      OPT__FFTW_PENCIL          );
 #     endif // # ifdef SUPPORT_FFTW
 
 //    refinement region for OPT__UM_IC_NLEVEL>1
@@ -1337,6 +1352,7 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Interpolation Schemes\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__INT_TIME                  % d\n",      OPT__INT_TIME           );
+      fprintf( Note, "OPT__INT_CACHE                 % d\n",      OPT__INT_CACHE          );
 #     if ( MODEL == HYDRO )
       fprintf( Note, "OPT__INT_PRIM                  % d\n",      OPT__INT_PRIM           );
 #     endif
@@ -1429,6 +1445,10 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Data Dump\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__OUTPUT_TOTAL              % d\n",      OPT__OUTPUT_TOTAL           );
+      fprintf( Note, "OPT__OUTPUT_HDF5_COLLECTIVE    % d\n",      OPT__OUTPUT_HDF5_COLLECTIVE );
+      fprintf( Note, "OPT__OUTPUT_HDF5_AGGREGATE     % d\n",      OPT__OUTPUT_HDF5_AGGREGATE  );
+      fprintf( Note, "OPT__OUTPUT_HDF5_ASYNC         % d\n",      OPT__OUTPUT_HDF5_ASYNC      );
+      fprintf( Note, "OUTPUT_HDF5_ASYNC_MAX_MEM      % 21.14e\n", OUTPUT_HDF5_ASYNC_MAX_MEM   );
       fprintf( Note, "OPT__OUTPUT_PART               % d\n",      OPT__OUTPUT_PART            );
       fprintf( Note, "OPT__OUTPUT_USER               % d\n",      OPT__OUTPUT_USER            );
       fprintf( Note, "OPT__OUTPUT_TEXT_FORMAT_FLT     %s\n",      OPT__OUTPUT_TEXT_FORMAT_FLT );
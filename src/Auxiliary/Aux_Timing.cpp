@@ -294,8 +294,8 @@ void Aux_Record_Timing()
       fprintf( File, "Main Loop\n" );
       fprintf( File, "---------------------------------------------------------------------------------------" );
       fprintf( File, "---------------------------------------\n" );
-      fprintf( File, "%3s%9s%15s%13s%13s%15s%15s%15s%15s\n",
-               "", "Total", "Integration", "Output", "Auxiliary", "LoadBalance", "CorrSync", "libyt", "Sum" );
+      fprintf( File, "%3s%9s%15s%13s%13s%15s%15s%13s%15s%15s\n",
+               "", "Total", "Integration", "Output", "Auxiliary", "LoadBalance", "CorrSync", "ParSort", "libyt", "Sum" );
    } // if ( MPI_Rank == 0 )
 
 
@@ -327,9 +327,9 @@ void Aux_Record_Timing()
          }
 
          for (int v=0; v<3; v++)
-         fprintf( File, "%3s%9.4f%15.4f%13.4f%13.4f%15.4f%15.4f%15.4f%15.4f\n",
+         fprintf( File, "%3s%9.4f%15.4f%13.4f%13.4f%15.4f%15.4f%13.4f%15.4f%15.4f\n",
                   Comment_LB[v], Time_LB_Main[0][v], Time_LB_Main[2][v], Time_LB_Main[3][v],
-                  Time_LB_Main[4][v], Time_LB_Main[5][v], Time_LB_Main[6][v], Time_LB_Main[7][v],
+                  Time_LB_Main[4][v], Time_LB_Main[5][v], Time_LB_Main[6][v], Time_LB_Main[1][v], Time_LB_Main[7][v],
                   Time_LB_Main[1][v] + Time_LB_Main[2][v] + Time_LB_Main[3][v] +
                   Time_LB_Main[4][v] + Time_LB_Main[5][v] + Time_LB_Main[6][v] +
                   Time_LB_Main[7][v] );
@@ -346,12 +346,13 @@ void Aux_Record_Timing()
    {
       if ( MPI_Rank == 0 )
       {
-         fprintf( File, "%3s%9.4f%15.4f%13.4f%13.4f%15.4f%15.4f%15.4f%15.4f\n", "",
+         fprintf( File, "%3s%9.4f%15.4f%13.4f%13.4f%15.4f%15.4f%13.4f%15.4f%15.4f\n", "",
                   Timer_Main[0]->GetValue(), Timer_Main[2]->GetValue(), Timer_Main[3]->GetValue(),
                   Timer_Main[4]->GetValue(), Timer_Main[5]->GetValue(), Timer_Main[6]->GetValue(),
-                  Timer_Main[7]->GetValue(),
-                  Timer_Main[2]->GetValue() + Timer_Main[3]->GetValue() + Timer_Main[4]->GetValue() +
-                  Timer_Main[5]->GetValue() + Timer_Main[6]->GetValue() + Timer_Main[7]->GetValue() );
+                  Timer_Main[1]->GetValue(), Timer_Main[7]->GetValue(),
+                  Timer_Main[1]->GetValue() + Timer_Main[2]->GetValue() + Timer_Main[3]->GetValue() +
+                  Timer_Main[4]->GetValue() + Timer_Main[5]->GetValue() + Timer_Main[6]->GetValue() +
+                  Timer_Main[7]->GetValue() );
 
          fprintf( File, "\n\n" );
 
@@ -652,7 +653,7 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
    if ( OPT__TIMING_BALANCE )
    {
 //    _P : percentage; _IM : imbalance
-      double Everything[3], MPI_Grid[3], Aux[3], Corr[3], Output[3], LB[3], Par[3], MPI_Par[3], libyt[3];
+      double Everything[3], MPI_Grid[3], Aux[3], Corr[3], Output[3], LB[3], Par[3], MPI_Par[3], libyt[3], ParSort[3];
       double dt_P, Flu_P, Gra_P, Src_P, Che_P, SF_P, FB_P, FixUp_P, Flag_P, Refine_P, Sum_P, MPI_Grid_P, Aux_P, Corr_P, Output_P, LB_P, Par_P, MPI_Par_P, libyt_P;
       double dt_IB, Flu_IB, Gra_IB, Src_IB, Che_IB, SF_IB, FB_IB, FixUp_IB, Flag_IB, Refine_IB, Sum_IB, MPI_Grid_IB, Aux_IB, Corr_IB, Output_IB, LB_IB, Par_IB, MPI_Par_IB, libyt_IB;
 
@@ -671,6 +672,7 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
          LB        [v] = Time_LB_Main[5][v];
          Corr      [v] = Time_LB_Main[6][v];
          libyt     [v] = Time_LB_Main[7][v];
+         ParSort   [v] = Time_LB_Main[1][v];
 
 //       sum
          MPI_Grid[v] = 0.0;
@@ -682,7 +684,10 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
          MPI_Par[v] = 0.0;
          for (int k=21; k<27; k++)  MPI_Par[v] += Time_LB[0][k][v];
 
-         Sum_LB[0][v] += Output[v] + Aux[v] + LB[v] + Corr[v] + libyt[v];
+         Sum_LB[0][v] += Output[v] + Aux[v] + LB[v] + Corr[v] + libyt[v] + ParSort[v];
+
+//       particle sorting is not included in any AMR level
+         Par[v] += ParSort[v];
 
 //       2.1 time
          fprintf( File, "%3s%5s %11.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%9.4f%12.4f\n",
@@ -775,7 +780,7 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 
    else
    {
-      double Everything, MPI_Grid, Aux, Corr, Output, LB, Par, MPI_Par, libyt;
+      double Everything, MPI_Grid, Aux, Corr, Output, LB, Par, MPI_Par, libyt, ParSort;
       double dt_P, Flu_P, Gra_P, Src_P, Che_P, SF_P, FB_P, FixUp_P, Flag_P, Refine_P, Sum_P, MPI_Grid_P;
       double Aux_P, Corr_P, Output_P, LB_P, Par_P, MPI_Par_P, libyt_P;
 
@@ -785,6 +790,7 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
       LB         = Timer_Main[5]->GetValue();
       Corr       = Timer_Main[6]->GetValue();
       libyt      = Timer_Main[7]->GetValue();
+      ParSort    = Timer_Main[1]->GetValue();
 
 //    sum
       MPI_Grid = 0.0;
@@ -795,7 +801,10 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
       MPI_Par = 0.0;
       for (int x=0; x<=5; x++)   MPI_Par += ParMPI[0][x];
 
-      Sum[0] += Output + Aux + LB + Corr + libyt;
+      Sum[0] += Output + Aux + LB + Corr + libyt + ParSort;
+
+//    particle sorting is not included in any AMR level
+      Par += ParSort;
 
 //    percentage
       dt_P       = 100.0*dt         [0]/Everything;
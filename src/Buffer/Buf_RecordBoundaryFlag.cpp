@@ -11,8 +11,11 @@
 //                MPI_ExchangeBoundaryFlag()
 //
 // Note        :  1. Invoked by Flag_Real()
-//                2. No OpenMP directives are applied in this function since the counter
-//                   amr->ParaVar->BounFlag_NList[]
+//                2. Each flagged boundary patch is recorded as NFLAG_PER_BOUNP integers: its position in
+//                   BounP_PosList[] followed by a bitmask storing the flags of the layers > 0
+//                   --> Bit n is set if the sibling TABLE_06(s,n) is flagged
+//                3. OpenMP is applied to the 26 directions, each of which has its own counter
+//                   amr->ParaVar->BounFlag_NList[lv][s]
 //
 // Parameter   :  lv : Target refinement level to be flagged
 //-------------------------------------------------------------------------------------------------------
@@ -23,9 +26,8 @@ void Buf_RecordBoundaryFlag( const int lv )
    if ( lv < 0  ||  lv >= TOP_LEVEL )  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
 
-   int FlagPos, PID, SibPID, FlagLayer, Sib;
-
 // begin the main loop of Buf_RecordBoundaryFlag()
+#  pragma omp parallel for schedule( dynamic )
    for (int s=0; s<26; s++)
    {
 //    initialize the counter as zero
@@ -49,11 +51,14 @@ void Buf_RecordBoundaryFlag( const int lv )
 
 
 //    set up the FlagLayer
-      FlagLayer = TABLE_05( s );
+      const int FlagLayer = TABLE_05( s );
+
+      int  FlagPos, PID, SibPID, LayerMask;
+      int *FlagList = NULL;
 
 
 //    allocate the maximum necessary memory (which will be deallocated by MPI_ExchangeBoundaryFlag())
-      amr->ParaVar->BounFlag_PosList[lv][s] = new int [ FlagLayer*amr->ParaVar->BounP_NList[lv][s] ];
+      amr->ParaVar->BounFlag_PosList[lv][s] = new int [ NFLAG_PER_BOUNP*amr->ParaVar->BounP_NList[lv][s] ];
 
 
 //    fill up BounFlag_PosList[lv][s][]
@@ -68,27 +73,26 @@ void Buf_RecordBoundaryFlag( const int lv )
 
          if ( amr->patch[0][lv][PID]->flag )
          {
-//          record the flag of layer 0
-            amr->ParaVar->BounFlag_PosList[lv][s][ amr->ParaVar->BounFlag_NList[lv][s] ] = FlagPos;
+//          record the flags of layers > 0 as a bitmask (only when the layer 0 is flagged)
+            LayerMask = 0;
 
-//          record the flags of layers > 0 (only when the layer 0 is flagged)
             for (int n=1; n<FlagLayer; n++)
             {
-               Sib    = TABLE_06( s, n );
-               SibPID = amr->patch[0][lv][PID]->sibling[Sib];
+               SibPID = amr->patch[0][lv][PID]->sibling[ TABLE_06(s,n) ];
 
 #              ifdef GAMER_DEBUG
                if ( SibPID <= SIB_OFFSET_NONPERIODIC )   Aux_Error( ERROR_INFO, "incorrect SibPID = %d !!\n", SibPID );
 #              endif
 
-//             set BounFlag_PosList = BUFFER_IS_FLAGGED to indicate that this layer is flagged (only for layer > 0)
-               if ( SibPID >= 0  &&  amr->patch[0][lv][SibPID]->flag )
-                  amr->ParaVar->BounFlag_PosList[lv][s][ amr->ParaVar->BounFlag_NList[lv][s]+n ] = BUFFER_IS_FLAGGED;
-               else
-                  amr->ParaVar->BounFlag_PosList[lv][s][ amr->ParaVar->BounFlag_NList[lv][s]+n ] = -1;
+               if ( SibPID >= 0  &&  amr->patch[0][lv][SibPID]->flag )  LayerMask |= ( 1 << n );
             }
 
-            amr->ParaVar->BounFlag_NList[lv][s] += FlagLayer;
+//          record the position of layer 0 and the bitmask of layers > 0
+            FlagList    = amr->ParaVar->BounFlag_PosList[lv][s] + amr->ParaVar->BounFlag_NList[lv][s];
+            FlagList[0] = FlagPos;
+            FlagList[1] = LayerMask;
+
+            amr->ParaVar->BounFlag_NList[lv][s] += NFLAG_PER_BOUNP;
 
          } // if ( amr->patch[0][lv][PID]->flag )
       } // for (int ID=0; ID<amr->ParaVar->BounP_NList[lv][s]; ID++)
@@ -6,6 +6,14 @@
 
 #if ( MODEL == HYDRO )
 
+// EoS conversion functions are declared "static inline" when included by EoS_Policy.h (EOS_CONVERSION_ONLY)
+// --> avoid the unused-function warnings in the fluid kernels not invoking all of them
+#ifdef EOS_CONVERSION_ONLY
+#  define EOS_FUNC_STATIC  static inline
+#else
+#  define EOS_FUNC_STATIC  static
+#endif
+
 
 
 /********************************************************
@@ -20,6 +28,10 @@
    I.   Set EoS auxiliary arrays
    II.  Implement EoS conversion functions
    III. Set EoS initialization functions
+
+4. Only the EoS conversion functions (step II) except EoS_General_* are compiled when
+   EOS_CONVERSION_ONLY is defined
+   --> Used by EoS_Policy.h to inline them into the CPU fluid kernels
 ********************************************************/
 
 
@@ -50,7 +62,7 @@
 //
 // Return      :  AuxArray_Flt/Int[]
 //-------------------------------------------------------------------------------------------------------
-#ifndef __CUDACC__
+#if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 void EoS_SetAuxArray_Gamma( double AuxArray_Flt[], int AuxArray_Int[] )
 {
 
@@ -63,7 +75,7 @@ void EoS_SetAuxArray_Gamma( double AuxArray_Flt[], int AuxArray_Int[] )
    AuxArray_Flt[5] = 1.0 / AuxArray_Flt[4];
 
 } // FUNCTION : EoS_SetAuxArray_Gamma
-#endif // #ifndef __CUDACC__
+#endif // #if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 
 
 
@@ -94,9 +106,9 @@ void EoS_SetAuxArray_Gamma( double AuxArray_Flt[], int AuxArray_Int[] )
 // Return      :  Gas pressure
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Pres_Gamma( const real Dens, const real Eint, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Pres_Gamma( const real Dens, const real Eint, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -138,9 +150,9 @@ static real EoS_DensEint2Pres_Gamma( const real Dens, const real Eint, const rea
 // Return      :  Gas internal energy density
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2Eint_Gamma( const real Dens, const real Pres, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2Eint_Gamma( const real Dens, const real Pres, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -182,9 +194,9 @@ static real EoS_DensPres2Eint_Gamma( const real Dens, const real Pres, const rea
 // Return      :  Sound speed squared
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2CSqr_Gamma( const real Dens, const real Pres, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2CSqr_Gamma( const real Dens, const real Pres, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -228,9 +240,9 @@ static real EoS_DensPres2CSqr_Gamma( const real Dens, const real Pres, const rea
 // Return      :  Gas temperature in kelvin
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Temp_Gamma( const real Dens, const real Eint, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Temp_Gamma( const real Dens, const real Eint, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -275,9 +287,9 @@ static real EoS_DensEint2Temp_Gamma( const real Dens, const real Eint, const rea
 // Return      :  Gas pressure
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensTemp2Pres_Gamma( const real Dens, const real Temp, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensTemp2Pres_Gamma( const real Dens, const real Temp, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -320,9 +332,9 @@ static real EoS_DensTemp2Pres_Gamma( const real Dens, const real Temp, const rea
 // Return      :  Gas entropy
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Entr_Gamma( const real Dens, const real Eint, const real Passive[],
-                                     const double AuxArray_Flt[], const int AuxArray_Int[],
-                                     const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Entr_Gamma( const real Dens, const real Eint, const real Passive[],
+                                              const double AuxArray_Flt[], const int AuxArray_Int[],
+                                              const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -350,6 +362,7 @@ static real EoS_DensEint2Entr_Gamma( const real Dens, const real Eint, const rea
 
 
 
+#ifndef EOS_CONVERSION_ONLY
 //-------------------------------------------------------------------------------------------------------
 // Function    :  EoS_General_Gamma
 // Description :  General EoS converter: In_*[] -> Out[]
@@ -375,6 +388,7 @@ static void EoS_General_Gamma( const int Mode, real Out[], const real In_Flt[],
 // not used by this EoS
 
 } // FUNCTION : EoS_General_Gamma
+#endif // #ifndef EOS_CONVERSION_ONLY
 
 
 
@@ -382,6 +396,8 @@ static void EoS_General_Gamma( const int Mode, real Out[], const real In_Flt[],
 // III. Set EoS initialization functions
 // =============================================
 
+#ifndef EOS_CONVERSION_ONLY
+
 #ifdef __CUDACC__
 #  define FUNC_SPACE __device__ static
 #else
@@ -507,6 +523,10 @@ void EoS_Init_Gamma()
 
 #endif // #ifndef __CUDACC__
 
+#endif // #ifndef EOS_CONVERSION_ONLY
+
+
 
+#undef EOS_FUNC_STATIC
 
 #endif // #if ( MODEL == HYDRO )
@@ -6,6 +6,14 @@
 
 #if ( MODEL == HYDRO )
 
+// EoS conversion functions are declared "static inline" when included by EoS_Policy.h (EOS_CONVERSION_ONLY)
+// --> avoid the unused-function warnings in the fluid kernels not invoking all of them
+#ifdef EOS_CONVERSION_ONLY
+#  define EOS_FUNC_STATIC  static inline
+#else
+#  define EOS_FUNC_STATIC  static
+#endif
+
 #ifdef COSMIC_RAY
 
 #ifdef __CUDACC__
@@ -13,9 +21,9 @@ __device__ static real EoS_CREint2CRPres_GammaCR( const real E_CR,
                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
                                                   const real *const Table[EOS_NTABLE_MAX] );
 #else // #ifdef __CUDACC__
-static real EoS_CREint2CRPres_GammaCR( const real E_CR,
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] );
+EOS_FUNC_STATIC real EoS_CREint2CRPres_GammaCR( const real E_CR,
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] );
 #endif // #ifdef __CUDACC__ ... else ...
 
 
@@ -38,6 +46,10 @@ static real EoS_CREint2CRPres_GammaCR( const real E_CR,
 5. When an EoS conversion function fails, it is recommended
    to return NAN in order to trigger auto-correction such as
    "OPT__1ST_FLUX_CORR" and "AUTO_REDUCE_DT"
+
+6. Only the EoS conversion functions (step II) except EoS_General_* are compiled when
+   EOS_CONVERSION_ONLY is defined
+   --> Used by EoS_Policy.h to inline them into the CPU fluid kernels
 ********************************************************/
 
 
@@ -71,7 +83,7 @@ static real EoS_CREint2CRPres_GammaCR( const real E_CR,
 //
 // Return      :  AuxArray_Flt/Int[]
 //-------------------------------------------------------------------------------------------------------
-#ifndef __CUDACC__
+#if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 void EoS_SetAuxArray_GammaCR( double AuxArray_Flt[], int AuxArray_Int[] )
 {
 
@@ -87,7 +99,7 @@ void EoS_SetAuxArray_GammaCR( double AuxArray_Flt[], int AuxArray_Int[] )
    AuxArray_Flt[8] = 1.0 / AuxArray_Flt[7];
 
 } // FUNCTION : EoS_SetAuxArray_GammaCR
-#endif // #ifndef __CUDACC__
+#endif // #if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 
 
 
@@ -119,9 +131,9 @@ void EoS_SetAuxArray_GammaCR( double AuxArray_Flt[], int AuxArray_Int[] )
 // Return      :  Total pressure (gas + cosmic ray)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Pres_GammaCR( const real Dens, const real Eint, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX])
+EOS_FUNC_STATIC real EoS_DensEint2Pres_GammaCR( const real Dens, const real Eint, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX])
 {
 
 // check
@@ -166,9 +178,9 @@ static real EoS_DensEint2Pres_GammaCR( const real Dens, const real Eint, const r
 // Return      :  Total internal energy density (gas + cosmic ray)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2Eint_GammaCR( const real Dens, const real Pres, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2Eint_GammaCR( const real Dens, const real Pres, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -213,9 +225,9 @@ static real EoS_DensPres2Eint_GammaCR( const real Dens, const real Pres, const r
 // Return      :  Effective sound speed squared
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2CSqr_GammaCR( const real Dens, const real Pres, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2CSqr_GammaCR( const real Dens, const real Pres, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -263,9 +275,9 @@ static real EoS_DensPres2CSqr_GammaCR( const real Dens, const real Pres, const r
 // Return      :  Gas temperature in kelvin
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Temp_GammaCR( const real Dens, const real Eint, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Temp_GammaCR( const real Dens, const real Eint, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -311,9 +323,9 @@ static real EoS_DensEint2Temp_GammaCR( const real Dens, const real Eint, const r
 // Return      :  Total pressure (gas + cosmic ray)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensTemp2Pres_GammaCR( const real Dens, const real Temp, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensTemp2Pres_GammaCR( const real Dens, const real Temp, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -358,9 +370,9 @@ static real EoS_DensTemp2Pres_GammaCR( const real Dens, const real Temp, const r
 // Return      :  Gas entropy
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Entr_GammaCR( const real Dens, const real Eint, const real Passive[],
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Entr_GammaCR( const real Dens, const real Eint, const real Passive[],
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -390,6 +402,7 @@ static real EoS_DensEint2Entr_GammaCR( const real Dens, const real Eint, const r
 
 
 
+#ifndef EOS_CONVERSION_ONLY
 //-------------------------------------------------------------------------------------------------------
 // Function    :  EoS_General_GammaCR
 // Description :  General EoS converter: In[] -> Out[]
@@ -415,6 +428,7 @@ static void EoS_General_GammaCR( const int Mode, real Out[], const real In_Flt[]
 // not used by this EoS
 
 } // FUNCTION : EoS_General_GammaCR
+#endif // #ifndef EOS_CONVERSION_ONLY
 
 
 
@@ -431,9 +445,9 @@ static void EoS_General_GammaCR( const int Mode, real Out[], const real In_Flt[]
 // Return      :  Cosmic ray pressure
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_CREint2CRPres_GammaCR( const real E_CR,
-                                       const double AuxArray_Flt[], const int AuxArray_Int[],
-                                       const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_CREint2CRPres_GammaCR( const real E_CR,
+                                                const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -469,6 +483,8 @@ static real EoS_CREint2CRPres_GammaCR( const real E_CR,
 // III. Set EoS initialization functions
 // =============================================
 
+#ifndef EOS_CONVERSION_ONLY
+
 #ifdef __CUDACC__
 #  define FUNC_SPACE __device__ static
 #else
@@ -600,8 +616,12 @@ void EoS_Init_GammaCR()
 
 #endif // #ifndef __CUDACC__
 
+#endif // #ifndef EOS_CONVERSION_ONLY
+
 
 
 #endif // #ifdef COSMIC_RAY
 
+#undef EOS_FUNC_STATIC
+
 #endif // #if ( MODEL == HYDRO )
@@ -6,6 +6,14 @@
 
 #if ( MODEL == HYDRO )
 
+// EoS conversion functions are declared "static inline" when included by EoS_Policy.h (EOS_CONVERSION_ONLY)
+// --> avoid the unused-function warnings in the fluid kernels not invoking all of them
+#ifdef EOS_CONVERSION_ONLY
+#  define EOS_FUNC_STATIC  static inline
+#else
+#  define EOS_FUNC_STATIC  static
+#endif
+
 
 
 /********************************************************
@@ -20,6 +28,10 @@
    I.   Set EoS auxiliary arrays
    II.  Implement EoS conversion functions
    III. Set EoS initialization functions
+
+4. Only the EoS conversion functions (step II) except EoS_General_* are compiled when
+   EOS_CONVERSION_ONLY is defined
+   --> Used by EoS_Policy.h to inline them into the CPU fluid kernels
 ********************************************************/
 
 
@@ -44,7 +56,7 @@
 //
 // Return      :  AuxArray_Flt/Int[]
 //-------------------------------------------------------------------------------------------------------
-#ifndef __CUDACC__
+#if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 void EoS_SetAuxArray_Isothermal( double AuxArray_Flt[], int AuxArray_Int[] )
 {
 
@@ -71,7 +83,7 @@ void EoS_SetAuxArray_Isothermal( double AuxArray_Flt[], int AuxArray_Int[] )
 #  endif
 
 } // FUNCTION : EoS_SetAuxArray_Isothermal
-#endif // #ifndef __CUDACC__
+#endif // #if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 
 
 
@@ -102,9 +114,9 @@ void EoS_SetAuxArray_Isothermal( double AuxArray_Flt[], int AuxArray_Int[] )
 // Return      :  Gas pressure
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Pres_Isothermal( const real Dens, const real Eint, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Pres_Isothermal( const real Dens, const real Eint, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -141,9 +153,9 @@ static real EoS_DensEint2Pres_Isothermal( const real Dens, const real Eint, cons
 // Return      :  Gas internal energy density
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2Eint_Isothermal( const real Dens, const real Pres, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2Eint_Isothermal( const real Dens, const real Pres, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -179,9 +191,9 @@ static real EoS_DensPres2Eint_Isothermal( const real Dens, const real Pres, cons
 // Return      :  Sound speed squared
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2CSqr_Isothermal( const real Dens, const real Pres, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2CSqr_Isothermal( const real Dens, const real Pres, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -215,9 +227,9 @@ static real EoS_DensPres2CSqr_Isothermal( const real Dens, const real Pres, cons
 // Return      :  Gas temperature in kelvin
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Temp_Isothermal( const real Dens, const real Eint, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Temp_Isothermal( const real Dens, const real Eint, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -250,9 +262,9 @@ static real EoS_DensEint2Temp_Isothermal( const real Dens, const real Eint, cons
 // Return      :  Gas pressure
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensTemp2Pres_Isothermal( const real Dens, const real Temp, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensTemp2Pres_Isothermal( const real Dens, const real Temp, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // check
@@ -289,9 +301,9 @@ static real EoS_DensTemp2Pres_Isothermal( const real Dens, const real Temp, cons
 // Return      :  Gas entropy
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensEint2Entr_Isothermal( const real Dens, const real Eint, const real Passive[],
-                                          const double AuxArray_Flt[], const int AuxArray_Int[],
-                                          const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensEint2Entr_Isothermal( const real Dens, const real Eint, const real Passive[],
+                                                   const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                   const real *const Table[EOS_NTABLE_MAX] )
 {
 
 // EoS_DensEint2Entr is NOT supported yet for isothermal EoS
@@ -301,6 +313,7 @@ static real EoS_DensEint2Entr_Isothermal( const real Dens, const real Eint, cons
 
 
 
+#ifndef EOS_CONVERSION_ONLY
 //-------------------------------------------------------------------------------------------------------
 // Function    :  EoS_General_Isothermal
 // Description :  General EoS converter: In_*[] -> Out[]
@@ -326,6 +339,7 @@ static void EoS_General_Isothermal( const int Mode, real Out[], const real In_Fl
 // not used by this EoS
 
 } // FUNCTION : EoS_General_Isothermal
+#endif // #ifndef EOS_CONVERSION_ONLY
 
 
 
@@ -333,6 +347,8 @@ static void EoS_General_Isothermal( const int Mode, real Out[], const real In_Fl
 // III. Set EoS initialization functions
 // =============================================
 
+#ifndef EOS_CONVERSION_ONLY
+
 #ifdef __CUDACC__
 #  define FUNC_SPACE __device__ static
 #else
@@ -463,6 +479,10 @@ void EoS_Init_Isothermal()
 
 #endif // #ifndef __CUDACC__
 
+#endif // #ifndef EOS_CONVERSION_ONLY
+
+
 
+#undef EOS_FUNC_STATIC
 
 #endif // #if ( MODEL == HYDRO )
@@ -6,6 +6,14 @@
 
 #if ( MODEL == HYDRO  &&  defined SRHD )
 
+// EoS conversion functions are declared "static inline" when included by EoS_Policy.h (EOS_CONVERSION_ONLY)
+// --> avoid the unused-function warnings in the fluid kernels not invoking all of them
+#ifdef EOS_CONVERSION_ONLY
+#  define EOS_FUNC_STATIC  static inline
+#else
+#  define EOS_FUNC_STATIC  static
+#endif
+
 
 
 /********************************************************
@@ -27,6 +35,10 @@
 5. When an EoS conversion function fails, it is recommended
    to return NAN in order to trigger auto-correction such as
    "OPT__1ST_FLUX_CORR" and "AUTO_REDUCE_DT"
+
+6. Only the EoS conversion functions (step II) are compiled when
+   EOS_CONVERSION_ONLY is defined
+   --> Used by EoS_Policy.h to inline them into the CPU fluid kernels
 ********************************************************/
 
 
@@ -49,7 +61,7 @@
 //
 // Return      :  AuxArray_Flt/Int[]
 //-------------------------------------------------------------------------------------------------------
-#ifndef __CUDACC__
+#if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 void EoS_SetAuxArray_TaubMathews( double AuxArray_Flt[], int AuxArray_Int[] )
 {
 
@@ -58,7 +70,7 @@ void EoS_SetAuxArray_TaubMathews( double AuxArray_Flt[], int AuxArray_Int[] )
    AuxArray_Flt[1] = 1.0 / AuxArray_Flt[0];
 
 } // FUNCTION : EoS_SetAuxArray_TaubMathews
-#endif // #ifndef __CUDACC__
+#endif // #if ( !defined __CUDACC__  &&  !defined EOS_CONVERSION_ONLY )
 
 
 
@@ -86,8 +98,8 @@ void EoS_SetAuxArray_TaubMathews( double AuxArray_Flt[], int AuxArray_Int[] )
 // Return      :  GuessHTilde : Guessed reduced enthalpy
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_GuessHTilde_TaubMathews( const real Con[], real* const Constant, const double AuxArray_Flt[],
-                                         const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_GuessHTilde_TaubMathews( const real Con[], real* const Constant, const double AuxArray_Flt[],
+                                                  const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
 {
 
    real GuessHTilde, Discrimination;
@@ -156,9 +168,9 @@ static real EoS_GuessHTilde_TaubMathews( const real Con[], real* const Constant,
 // Return      :  Temp, DiffTemp
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static void EoS_HTilde2Temp_TaubMathews( const real HTilde, real* const Temp, real* const DiffTemp,
-                                         const real Passive[], const double AuxArray_Flt[],
-                                         const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC void EoS_HTilde2Temp_TaubMathews( const real HTilde, real* const Temp, real* const DiffTemp,
+                                                  const real Passive[], const double AuxArray_Flt[],
+                                                  const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
 {
 
   const real HTildeSqr = SQR(HTilde);
@@ -191,8 +203,8 @@ static void EoS_HTilde2Temp_TaubMathews( const real HTilde, real* const Temp, re
 // Return      :  Reduced energy density
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_Temp2HTilde_TaubMathews( const real Temp, const real Passive[], const double AuxArray_Flt[],
-                                         const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_Temp2HTilde_TaubMathews( const real Temp, const real Passive[], const double AuxArray_Flt[],
+                                                  const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
 {
 
    const real TempSqr = Temp*Temp;
@@ -225,9 +237,9 @@ static real EoS_Temp2HTilde_TaubMathews( const real Temp, const real Passive[],
 // Return      :  Sound speed squared
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE_NOINLINE
-static real EoS_DensPres2CSqr_TaubMathews( const real Dens, const real Pres, const real Passive[],
-                                           const double AuxArray_Flt[], const int AuxArray_Int[],
-                                           const real *const Table[EOS_NTABLE_MAX] )
+EOS_FUNC_STATIC real EoS_DensPres2CSqr_TaubMathews( const real Dens, const real Pres, const real Passive[],
+                                                    const double AuxArray_Flt[], const int AuxArray_Int[],
+                                                    const real *const Table[EOS_NTABLE_MAX] )
 {
 
    real Cs2, Temp, factor;
@@ -253,6 +265,8 @@ static real EoS_DensPres2CSqr_TaubMathews( const real Dens, const real Pres, con
 // III. Set EoS initialization functions
 // =============================================
 
+#ifndef EOS_CONVERSION_ONLY
+
 #ifdef __CUDACC__
 #  define FUNC_SPACE __device__ static
 #else
@@ -350,6 +364,10 @@ void EoS_Init_TaubMathews()
 
 #endif // #ifndef __CUDACC__
 
+#endif // #ifndef EOS_CONVERSION_ONLY
+
+
 
+#undef EOS_FUNC_STATIC
 
 #endif // #if ( MODEL == HYDRO && defined SRHD )
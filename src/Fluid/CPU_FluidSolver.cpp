@@ -167,6 +167,10 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                                      --> Should be set to the global variable "PassiveIntFrac_VarIdx"
 //                JeansMinPres        : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff  : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                Work_PG0            : Index of the first patch group in the work arrays of the MHM/MHM_RP/CTU schemes
+//                                      (e.g., h_PriVar)
+//                                      --> Nonzero only for OPT__CPU_FUSED_SOLVER, where each thread solves one patch group
+//                                          in its own slot of the work arrays
 //-------------------------------------------------------------------------------------------------------
 void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       real h_Flu_Array_Out[][FLU_NOUT][ CUBE(PS2) ],
@@ -186,7 +190,7 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
                       const bool FracPassive, const int NFrac, const int FracIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff )
+                      const bool JeansMinPres, const real JeansMinPres_Coeff, const int Work_PG0 )
 {
 
 // check
@@ -207,6 +211,17 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
 
 #  if   ( MODEL == HYDRO )
 
+#     if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+//    work arrays of the target patch groups
+//    --> h_Slope_PPM, h_FC_Mag_Half, and h_EC_Ele are NULL when PPM and MHD are disabled, respectively
+      real (*const PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ] = h_PriVar  + Work_PG0;
+      real (*const FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = h_FC_Var  + Work_PG0;
+      real (*const FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = h_FC_Flux + Work_PG0;
+      real (*const Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = ( h_Slope_PPM   == NULL ) ? NULL : h_Slope_PPM   + Work_PG0;
+      real (*const FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]       = ( h_FC_Mag_Half == NULL ) ? NULL : h_FC_Mag_Half + Work_PG0;
+      real (*const EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ]       = ( h_EC_Ele      == NULL ) ? NULL : h_EC_Ele      + Work_PG0;
+#     endif
+
 #     if   ( FLU_SCHEME == RTVD )
 
       CPU_FluidSolver_RTVD( h_Flu_Array_In, h_Flu_Array_Out, h_Flux_Array, h_Corner_Array, h_Pot_Array_USG,
@@ -216,7 +231,7 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
 
       CPU_FluidSolver_MHM ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
                             h_DE_Array_Out, h_Flux_Array, h_Ele_Array, h_Corner_Array, h_Pot_Array_USG,
-                            h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
+                            PriVar, Slope_PPM, FC_Var, FC_Flux, FC_Mag_Half, EC_Ele,
                             NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, MinMod_MaxIter, Time,
                             UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
                             DualEnergySwitch, NormPassive, NNorm, NormIdx, FracPassive, NFrac, FracIdx,
@@ -226,7 +241,7 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
 
       CPU_FluidSolver_CTU ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
                             h_DE_Array_Out, h_Flux_Array, h_Ele_Array, h_Corner_Array, h_Pot_Array_USG,
-                            h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
+                            PriVar, Slope_PPM, FC_Var, FC_Flux, FC_Mag_Half, EC_Ele,
                             NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, Time,
                             UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
                             DualEnergySwitch, NormPassive, NNorm, NormIdx, FracPassive, NFrac, FracIdx,
@@ -4,6 +4,13 @@
 // status of the fluid solver used by AUTO_REDUCE_DT
 int FluStatus_ThisRank;
 
+// maximum signal speed of the updated fluid data on this rank used by OPT__DT_FLU_CACHE
+// --> Flu_MaxSpeed_Valid[lv] is true only if Flu_MaxSpeed_ThisRank[lv] was measured on all the current patches at lv
+#if ( MODEL == HYDRO )
+real Flu_MaxSpeed_ThisRank[NLEVEL];
+bool Flu_MaxSpeed_Valid   [NLEVEL];
+#endif
+
 
 // defined in Flu_ManageFixUpTempArray.cpp
 void Flu_SwapFixUpTempArray( const int lv );
@@ -19,6 +26,9 @@ void Flu_InitFixUpTempArray( const int lv );
 // Note        :  1. Invoke InvokeSolver()
 //                2. Currently the updated data can only be stored in the different sandglass from the
 //                   input data
+//                3. For OPT__DT_FLU_CACHE, reset the maximum signal speed at lv before the update and validate it
+//                   after all patches at lv have been updated successfully
+//                   --> The maximum signal speed is measured by Flu_Close()
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -56,6 +66,16 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 #  endif
 
 
+// reset the maximum signal speed before updating the first batch of patches
+#  if ( MODEL == HYDRO )
+   if (  OPT__DT_FLU_CACHE  &&  ( !OverlapMPI || Overlap_Sync )  )
+   {
+      Flu_MaxSpeed_ThisRank[lv] = (real)0.0;
+      Flu_MaxSpeed_Valid   [lv] = false;
+   }
+#  endif
+
+
 // invoke the fluid solver
    FluStatus_ThisRank = GAMER_SUCCESS;
 
@@ -86,6 +106,11 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 
 //    swap the flux (and electric in MHD) pointers on the parent level if the fluid solver works successfully
       if ( AUTO_REDUCE_DT  &&  lv != 0 )  Flu_SwapFixUpTempArray( lv-1 );
+
+//    the maximum signal speed becomes valid after updating the last batch of patches
+#     if ( MODEL == HYDRO )
+      if (  OPT__DT_FLU_CACHE  &&  ( !OverlapMPI || !Overlap_Sync )  )  Flu_MaxSpeed_Valid[lv] = true;
+#     endif
    }
 
 
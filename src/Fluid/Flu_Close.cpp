@@ -8,6 +8,11 @@ extern int FluStatus_ThisRank;
 // whether or not to continue applying AUTO_REDUCE_DT (decalred in Flu_AdvanceDt.cpp)
 extern bool AutoReduceDt_Continue;
 
+// maximum signal speed used by OPT__DT_FLU_CACHE (declared in Flu_AdvanceDt.cpp)
+#if ( MODEL == HYDRO )
+extern real Flu_MaxSpeed_ThisRank[NLEVEL];
+#endif
+
 
 static void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                        const int NPG, const int *PID0_List, const real dt );
@@ -24,6 +29,8 @@ static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List
                                const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
                                const real dt );
+static real GetMaxSpeed( const int NPG, const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                         const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ] );
 #endif
 #ifdef MHD
 void StoreElectric( const int lv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
@@ -65,6 +72,7 @@ extern void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
 //                4. Get the minimum time-step information of the fluid solver
+//                5. Record the maximum signal speed of the updated data for OPT__DT_FLU_CACHE
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -192,6 +200,19 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int TID=0; TID<NPG; TID++)
 
+
+// record the maximum signal speed for estimating the next time-step at lv
+// --> use critical since Flu_Close() can be invoked by multiple threads simultaneously (e.g., OPT__CPU_FUSED_SOLVER)
+#  if ( MODEL == HYDRO  &&  !defined SRHD )
+   if ( OPT__DT_FLU_CACHE )
+   {
+      const real MaxSpeed = GetMaxSpeed( NPG, h_Flu_Array_F_Out, h_Mag_Array_F_Out );
+
+#     pragma omp critical( Flu_MaxSpeed )
+      Flu_MaxSpeed_ThisRank[lv] = FMAX( Flu_MaxSpeed_ThisRank[lv], MaxSpeed );
+   }
+#  endif
+
 } // FUNCTION : Flu_Close
 
 
@@ -1197,12 +1218,106 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    }
 
 // accumulate the total number of corrected cells in one global time-step if CorrectUnphysical() works
+// --> use atomic since different threads may close different patch groups simultaneously for OPT__CPU_FUSED_SOLVER
    else
    {
+#     pragma omp atomic
       NCorrUnphy[lv] += NCorrThisTime;
    }
 
 } // FUNCTION : CorrectUnphysical
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMaxSpeed
+// Description :  Get the maximum signal speed (i.e., bulk velocity + sound speed in hydro and bulk velocity
+//                + fast magnetosonic speed in MHD) of the updated fluid data for OPT__DT_FLU_CACHE
+//
+// Note        :  1. Invoked by Flu_Close()
+//                2. Must be consistent with CPU_dtSolver_HydroCFL()
+//                   --> Mis_GetTimeStep() then returns "Safety*dh/MaxSpeed" without invoking the dt solver
+//
+// Parameter   :  NPG               : Number of patch groups to be evaluated
+//                h_Flu_Array_F_Out : Host array storing the updated fluid data
+//                h_Mag_Array_F_Out : Host array storing the updated B field (for MHD only)
+//
+// Return      :  Maximum signal speed among all cells in h_Flu_Array_F_Out
+//-------------------------------------------------------------------------------------------------------
+real GetMaxSpeed( const int NPG, const real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                  const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ] )
+{
+
+   const bool CheckMinPres_Yes = true;
+
+   real MaxSpeed_AllThread = (real)0.0;
+
+#  pragma omp parallel
+   {
+      real MaxSpeed = (real)0.0;
+
+#     pragma omp for schedule( runtime )
+      for (int TID=0; TID<NPG; TID++)
+      {
+         for (int t=0; t<CUBE(PS2); t++)
+         {
+            real fluid[FLU_NOUT], _Rho, Pres, a2, Emag, Cx, Cy, Cz;
+
+            for (int v=0; v<FLU_NOUT; v++)   fluid[v] = h_Flu_Array_F_Out[TID][v][t];
+
+#           ifdef MHD
+            const int i = t % PS2;
+            const int j = t % SQR(PS2) / PS2;
+            const int k = t / SQR(PS2);
+
+            real B[3], Bx2, By2, Bz2, B2, Ca2_plus_a2, Ca2_min_a2_sqr, four_a2_over_Rho;
+
+            MHD_GetCellCenteredBField( B, h_Mag_Array_F_Out[TID][MAGX], h_Mag_Array_F_Out[TID][MAGY],
+                                       h_Mag_Array_F_Out[TID][MAGZ], PS2, PS2, PS2, i, j, k );
+
+            Bx2  = SQR( B[MAGX] );
+            By2  = SQR( B[MAGY] );
+            Bz2  = SQR( B[MAGZ] );
+            B2   = Bx2 + By2 + Bz2;
+            Emag = (real)0.5*B2;
+#           else
+            Emag = NULL_REAL;
+#           endif
+
+           _Rho  = (real)1.0 / fluid[DENS];
+            Pres = Hydro_Con2Pres( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY], fluid+NCOMP_FLUID,
+                                   CheckMinPres_Yes, MIN_PRES, Emag,
+                                   EoS_DensEint2Pres_CPUPtr, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                   EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+            a2   = EoS_DensPres2CSqr_CPUPtr( fluid[DENS], Pres, fluid+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int,
+                                             h_EoS_Table );
+
+#           ifdef MHD
+            Ca2_plus_a2      = B2*_Rho + a2;
+            Ca2_min_a2_sqr   = SQR( B2*_Rho - a2 );
+            four_a2_over_Rho = (real)4.0*a2*_Rho;
+            Cx               = SQRT(  (real)0.5*( Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(By2+Bz2) ) )  );
+            Cy               = SQRT(  (real)0.5*( Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+Bz2) ) )  );
+            Cz               = SQRT(  (real)0.5*( Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+By2) ) )  );
+#           else
+            Cx               = SQRT( a2 );
+            Cy               = Cx;
+            Cz               = Cx;
+#           endif
+
+            MaxSpeed = FMAX( MaxSpeed, Cx + FABS(fluid[MOMX])*_Rho );
+            MaxSpeed = FMAX( MaxSpeed, Cy + FABS(fluid[MOMY])*_Rho );
+            MaxSpeed = FMAX( MaxSpeed, Cz + FABS(fluid[MOMZ])*_Rho );
+         } // for (int t=0; t<CUBE(PS2); t++)
+      } // for (int TID=0; TID<NPG; TID++)
+
+#     pragma omp critical( GetMaxSpeed )
+      MaxSpeed_AllThread = FMAX( MaxSpeed_AllThread, MaxSpeed );
+   } // OpenMP parallel region
+
+   return MaxSpeed_AllThread;
+
+} // FUNCTION : GetMaxSpeed
+
 #endif // #ifndef SRHD
 
 
@@ -17,6 +17,11 @@ void End_GAMER()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// wait until the asynchronous data dump finishes
+#  ifdef SUPPORT_HDF5
+   Output_DumpData_Total_HDF5_Flush();
+#  endif
+
 #  ifdef TIMING
    Aux_DeleteTimer();
 #  endif
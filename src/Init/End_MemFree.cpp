@@ -3,6 +3,9 @@
 #ifdef LOAD_BALANCE
 void LB_GetBufferData_MemFree();
 #endif
+#if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+void Par_LB_SendParticleData_MemFree();
+#endif
 
 
 
@@ -74,6 +77,14 @@ void End_MemFree()
    LB_GetBufferData_MemFree();
 #  endif
 
+#  if ( defined PARTICLE  &&  defined LOAD_BALANCE )
+   Par_LB_SendParticleData_MemFree();
+#  endif
+
+#  ifndef SERIAL
+   MPI_Alltoallv_Sparse_MemFree();
+#  endif
+
 
 // 6. star formation random number generator
 #  ifdef STAR_FORMATION
@@ -94,6 +105,10 @@ void End_MemFree()
    delete [] UM_IC_RefineRegion;    UM_IC_RefineRegion = NULL;
 
 
+// 10. per-thread scratch arenas used by Prepare_PatchData()
+   Mis_FreeScratch();
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
@@ -8,6 +8,12 @@ root_fftw::real_plan_nd FFTW_Plan_PS;                       // PS  : plan for ca
 #ifdef GRAVITY
 root_fftw::real_plan_nd FFTW_Plan_Poi, FFTW_Plan_Poi_Inv;   // Poi : plan for the self-gravity Poisson solver
 #endif // #ifdef GRAVITY
+#if ( SUPPORT_FFTW == FFTW3 )
+FFTW_Pencil_t FFTW_Pencil_PS;                               // pencil decompositions for OPT__FFTW_PENCIL
+#ifdef GRAVITY
+FFTW_Pencil_t FFTW_Pencil_Poi;
+#endif // #ifdef GRAVITY
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
 
 
 
@@ -133,6 +139,21 @@ void Init_FFTW()
       default:                       Aux_Error( ERROR_INFO, "unrecognised FFTW startup option %d  !!\n", OPT__FFTW_STARTUP );
    } // switch ( OPT__FFTW_STARTUP )
 
+// create the pencil decompositions instead of the FFTW-MPI slab plans
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+   {
+      Init_FFTW_Pencil( FFTW_Pencil_PS, PS_FFT_Size, StartupFlag );
+#     ifdef GRAVITY
+      Init_FFTW_Pencil( FFTW_Pencil_Poi, Gravity_FFT_Size, StartupFlag );
+#     endif
+
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "done (pencil decomposition with %d x %d ranks)\n",
+                                           FFTW_Pencil_PS.NP[0], FFTW_Pencil_PS.NP[1] );
+      return;
+   }
+#  endif // # if ( SUPPORT_FFTW == FFTW3 )
+
 // allocate memory for arrays in fftw3
 #  if ( SUPPORT_FFTW == FFTW3 )
    PS   = (real*) root_fftw::fft_malloc(ComputePaddedTotalSize(PS_FFT_Size     ) * sizeof(real));
@@ -172,12 +193,25 @@ void End_FFTW()
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
 
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS      );
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+   {
+      End_FFTW_Pencil( FFTW_Pencil_PS );
+#     ifdef GRAVITY
+      End_FFTW_Pencil( FFTW_Pencil_Poi );
+#     endif
+   }
+
+   else
+#  endif // # if ( SUPPORT_FFTW == FFTW3 )
+   {
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_PS      );
 
-#  ifdef GRAVITY
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi     );
-   root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi_Inv );
-#  endif // #  ifdef GRAVITY
+#     ifdef GRAVITY
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi     );
+      root_fftw::destroy_real_plan_nd  ( FFTW_Plan_Poi_Inv );
+#     endif // #  ifdef GRAVITY
+   }
 
 #  if ( SUPPORT_FFTW == FFTW3 )
 #  ifdef OPENMP
@@ -0,0 +1,739 @@
+#include "GAMER.h"
+
+#if ( SUPPORT_FFTW == FFTW3 )
+
+static int  Index2Block( const int Idx, const int N, const int NBlock );
+static void CopyBlock( real *Arr, real *Blk, const int BlkN[], const long Stride[], const long Offset, const bool ToBlk );
+static void Transpose( const FFTW_Pencil_t &Pencil, const bool XY, const bool Forward, real *In, real *Buf );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_FFTW_Pencil
+// Description :  Set up the 2D pencil decomposition and create the FFTW plans of the batched 1D transforms
+//
+// Note        :  1. Invoked by Init_FFTW() when OPT__FFTW_PENCIL is on
+//                2. The rank grid NP[0]*NP[1] is chosen to be as square as possible with NP[0] <= NP[1]
+//                   --> Up to min( N[1]*N[2], NxC*N[2], NxC*N[1] ) ranks can participate in the FFT, compared to
+//                       N[2] ranks for the FFTW-MPI slab decomposition
+//                3. Only the serial FFTW library is required. All transposes are done by MPI_Alltoallv()
+//                   within the row and column communicators.
+//
+// Parameter   :  Pencil      : FFTW_Pencil_t object to be initialized
+//                FFT_Size    : Size of the FFT operation including the zero-padding regions
+//                StartupFlag : FFTW planner flag (e.g., FFTW_MEASURE)
+//-------------------------------------------------------------------------------------------------------
+void Init_FFTW_Pencil( FFTW_Pencil_t &Pencil, const int FFT_Size[], const int StartupFlag )
+{
+
+// 1. set the rank grid
+   for (int d=0; d<3; d++)    Pencil.N[d] = FFT_Size[d];
+
+   Pencil.NxC = Pencil.N[0]/2 + 1;
+
+   Pencil.NP[0] = 1;
+   for (int t=(int)sqrt((double)MPI_NRank); t>=1; t--)
+   {
+      if ( MPI_NRank % t == 0 )  {  Pencil.NP[0] = t;  break;  }
+   }
+   Pencil.NP[1] = MPI_NRank / Pencil.NP[0];
+
+   Pencil.Coord[0] = MPI_Rank % Pencil.NP[0];
+   Pencil.Coord[1] = MPI_Rank / Pencil.NP[0];
+
+
+// 2. set the starting indices of each rank
+   Pencil.Y_Start  = new int [ Pencil.NP[0]+1 ];
+   Pencil.XC_Start = new int [ Pencil.NP[0]+1 ];
+   Pencil.Z_Start  = new int [ Pencil.NP[1]+1 ];
+   Pencil.YK_Start = new int [ Pencil.NP[1]+1 ];
+
+   for (int r=0; r<=Pencil.NP[0]; r++)
+   {
+      Pencil.Y_Start [r] = int( (long)Pencil.N[1]*r/Pencil.NP[0] );
+      Pencil.XC_Start[r] = int( (long)Pencil.NxC *r/Pencil.NP[0] );
+   }
+
+   for (int r=0; r<=Pencil.NP[1]; r++)
+   {
+      Pencil.Z_Start [r] = int( (long)Pencil.N[2]*r/Pencil.NP[1] );
+      Pencil.YK_Start[r] = int( (long)Pencil.N[1]*r/Pencil.NP[1] );
+   }
+
+   const int c0       = Pencil.Coord[0];
+   const int c1       = Pencil.Coord[1];
+   const int local_ny = Pencil.Y_Start [c0+1] - Pencil.Y_Start [c0];
+   const int local_nx = Pencil.XC_Start[c0+1] - Pencil.XC_Start[c0];
+   const int local_nz = Pencil.Z_Start [c1+1] - Pencil.Z_Start [c1];
+   const int local_nk = Pencil.YK_Start[c1+1] - Pencil.YK_Start[c1];
+
+// x-pencils store real numbers, y/z-pencils store complex numbers
+   const long Size_x = (long)local_nz*local_ny*2*Pencil.NxC;
+   const long Size_y = (long)local_nz*local_nx*2*Pencil.N[1];
+   const long Size_z = (long)local_nk*local_nx*2*Pencil.N[2];
+
+   Pencil.TotalSize = MAX( Size_x, MAX( Size_y, Size_z ) );
+
+// MPI_Alltoallv() in Transpose() adopts int displacements
+   if ( Pencil.TotalSize > __INT_MAX__ )
+      Aux_Error( ERROR_INFO, "pencil size (%ld) > __INT_MAX__ (%d) for FFT --> Try using more MPI processes !!\n",
+                 Pencil.TotalSize, __INT_MAX__ );
+
+
+// 3. create the row and column communicators
+#  ifndef SERIAL
+   MPI_Comm_split( MPI_COMM_WORLD, c1, c0, &Pencil.Comm_Row );
+   MPI_Comm_split( MPI_COMM_WORLD, c0, c1, &Pencil.Comm_Col );
+#  endif
+
+
+// 4. create plans
+// --> the planner may overwrite the input arrays for StartupFlag != FFTW_ESTIMATE
+   real *Data = (real*) root_fftw::fft_malloc( sizeof(real)*MAX(Pencil.TotalSize,1L) );
+   real *Work = (real*) root_fftw::fft_malloc( sizeof(real)*MAX(Pencil.TotalSize,1L) );
+
+   gamer_fftw::fft_real    *Data_r = (gamer_fftw::fft_real*   )Data;
+   gamer_fftw::fft_complex *Data_c = (gamer_fftw::fft_complex*)Data;
+   gamer_fftw::fft_complex *Work_c = (gamer_fftw::fft_complex*)Work;
+
+   const int NBatch_x = local_nz*local_ny;
+   const int NBatch_y = local_nz*local_nx;
+   const int NBatch_z = local_nk*local_nx;
+
+   Pencil.Plan_R2C_x = Pencil.Plan_C2R_x = NULL;
+   Pencil.Plan_Forward_y = Pencil.Plan_Backward_y = NULL;
+   Pencil.Plan_Forward_z = Pencil.Plan_Backward_z = NULL;
+
+   if ( NBatch_x > 0 )
+   {
+      Pencil.Plan_R2C_x      = gamer_fftw::plan_many_dft_r2c( 1, &Pencil.N[0], NBatch_x, Data_r, NULL, 1, 2*Pencil.NxC,
+                                                              Data_c, NULL, 1, Pencil.NxC, StartupFlag );
+      Pencil.Plan_C2R_x      = gamer_fftw::plan_many_dft_c2r( 1, &Pencil.N[0], NBatch_x, Data_c, NULL, 1, Pencil.NxC,
+                                                              Data_r, NULL, 1, 2*Pencil.NxC, StartupFlag );
+   }
+
+   if ( NBatch_y > 0 )
+   {
+      Pencil.Plan_Forward_y  = gamer_fftw::plan_many_dft_c2c( 1, &Pencil.N[1], NBatch_y, Work_c, NULL, 1, Pencil.N[1],
+                                                              Work_c, NULL, 1, Pencil.N[1], FFTW_FORWARD,  StartupFlag );
+      Pencil.Plan_Backward_y = gamer_fftw::plan_many_dft_c2c( 1, &Pencil.N[1], NBatch_y, Work_c, NULL, 1, Pencil.N[1],
+                                                              Work_c, NULL, 1, Pencil.N[1], FFTW_BACKWARD, StartupFlag );
+   }
+
+   if ( NBatch_z > 0 )
+   {
+      Pencil.Plan_Forward_z  = gamer_fftw::plan_many_dft_c2c( 1, &Pencil.N[2], NBatch_z, Data_c, NULL, 1, Pencil.N[2],
+                                                              Data_c, NULL, 1, Pencil.N[2], FFTW_FORWARD,  StartupFlag );
+      Pencil.Plan_Backward_z = gamer_fftw::plan_many_dft_c2c( 1, &Pencil.N[2], NBatch_z, Data_c, NULL, 1, Pencil.N[2],
+                                                              Data_c, NULL, 1, Pencil.N[2], FFTW_BACKWARD, StartupFlag );
+   }
+
+   root_fftw::fft_free( Data );
+   root_fftw::fft_free( Work );
+
+} // FUNCTION : Init_FFTW_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  End_FFTW_Pencil
+// Description :  Free the plans, arrays, and communicators allocated by Init_FFTW_Pencil()
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object to be freed
+//-------------------------------------------------------------------------------------------------------
+void End_FFTW_Pencil( FFTW_Pencil_t &Pencil )
+{
+
+   if ( Pencil.Plan_R2C_x      != NULL )   gamer_fftw::destroy_real_plan_1d   ( Pencil.Plan_R2C_x      );
+   if ( Pencil.Plan_C2R_x      != NULL )   gamer_fftw::destroy_real_plan_1d   ( Pencil.Plan_C2R_x      );
+   if ( Pencil.Plan_Forward_y  != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Forward_y  );
+   if ( Pencil.Plan_Backward_y != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Backward_y );
+   if ( Pencil.Plan_Forward_z  != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Forward_z  );
+   if ( Pencil.Plan_Backward_z != NULL )   gamer_fftw::destroy_complex_plan_1d( Pencil.Plan_Backward_z );
+
+   delete [] Pencil.Y_Start;
+   delete [] Pencil.XC_Start;
+   delete [] Pencil.Z_Start;
+   delete [] Pencil.YK_Start;
+
+#  ifndef SERIAL
+   MPI_Comm_free( &Pencil.Comm_Row );
+   MPI_Comm_free( &Pencil.Comm_Col );
+#  endif
+
+} // FUNCTION : End_FFTW_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_Pencil_Forward
+// Description :  Real-to-complex 3D FFT in the pencil decomposition
+//
+// Note        :  1. Input : real    data in the x-pencil layout stored in Data
+//                   Output: complex data in the z-pencil layout stored in Data
+//                2. Both Data and Work must be allocated by root_fftw::fft_malloc() with Pencil.TotalSize
+//                   real elements so that they share the same alignment as the arrays used for planning
+//                3. Must be called by all ranks together
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object initialized by Init_FFTW_Pencil()
+//                Data   : Input and output array
+//                Work   : Work array
+//-------------------------------------------------------------------------------------------------------
+void FFTW_Pencil_Forward( const FFTW_Pencil_t &Pencil, real *Data, real *Work )
+{
+
+   const bool XY_Yes = true, XY_No = false, Forward_Yes = true;
+
+   if ( Pencil.Plan_R2C_x != NULL )
+      gamer_fftw::execute_dft_r2c_1d( Pencil.Plan_R2C_x, (gamer_fftw::fft_real*)Data, (gamer_fftw::fft_complex*)Data );
+
+   Transpose( Pencil, XY_Yes, Forward_Yes, Data, Work );
+
+   if ( Pencil.Plan_Forward_y != NULL )
+      gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Forward_y, (gamer_fftw::fft_complex*)Work, (gamer_fftw::fft_complex*)Work );
+
+   Transpose( Pencil, XY_No, Forward_Yes, Work, Data );
+
+   if ( Pencil.Plan_Forward_z != NULL )
+      gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Forward_z, (gamer_fftw::fft_complex*)Data, (gamer_fftw::fft_complex*)Data );
+
+} // FUNCTION : FFTW_Pencil_Forward
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_Pencil_Backward
+// Description :  Complex-to-real 3D FFT in the pencil decomposition
+//
+// Note        :  1. Input : complex data in the z-pencil layout stored in Data
+//                   Output: real    data in the x-pencil layout stored in Data
+//                2. Not normalized, same as FFTW
+//                3. See also the notes of FFTW_Pencil_Forward()
+//
+// Parameter   :  Pencil : FFTW_Pencil_t object initialized by Init_FFTW_Pencil()
+//                Data   : Input and output array
+//                Work   : Work array
+//-------------------------------------------------------------------------------------------------------
+void FFTW_Pencil_Backward( const FFTW_Pencil_t &Pencil, real *Data, real *Work )
+{
+
+   const bool XY_Yes = true, XY_No = false, Forward_No = false;
+
+   if ( Pencil.Plan_Backward_z != NULL )
+      gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Backward_z, (gamer_fftw::fft_complex*)Data, (gamer_fftw::fft_complex*)Data );
+
+   Transpose( Pencil, XY_No, Forward_No, Data, Work );
+
+   if ( Pencil.Plan_Backward_y != NULL )
+      gamer_fftw::execute_dft_c2c_1d( Pencil.Plan_Backward_y, (gamer_fftw::fft_complex*)Work, (gamer_fftw::fft_complex*)Work );
+
+   Transpose( Pencil, XY_Yes, Forward_No, Work, Data );
+
+   if ( Pencil.Plan_C2R_x != NULL )
+      gamer_fftw::execute_dft_c2r_1d( Pencil.Plan_C2R_x, (gamer_fftw::fft_complex*)Data, (gamer_fftw::fft_real*)Data );
+
+} // FUNCTION : FFTW_Pencil_Backward
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Transpose
+// Description :  Transpose complex data between the x- and y-pencil layouts (XY=true) or between the y- and
+//                z-pencil layouts (XY=false)
+//
+// Note        :  1. Forward : x->y (XY=true) or y->z (XY=false)
+//                   Backward: y->x (XY=true) or z->y (XY=false)
+//                2. Data are packed from In to Buf, exchanged from Buf to In, and then unpacked from In to Buf
+//                   --> The output is stored in Buf and In is overwritten
+//                3. Each block exchanged with a rank is described by its 3D size and the strides/offset in the
+//                   pencil arrays on both sides
+//
+// Parameter   :  Pencil  : FFTW_Pencil_t object
+//                XY      : Transpose between the x- and y-pencils (true) or between the y- and z-pencils (false)
+//                Forward : Forward or backward transpose
+//                In      : Input array
+//                Buf     : Output array
+//-------------------------------------------------------------------------------------------------------
+void Transpose( const FFTW_Pencil_t &Pencil, const bool XY, const bool Forward, real *In, real *Buf )
+{
+
+   const int c0       = Pencil.Coord[0];
+   const int c1       = Pencil.Coord[1];
+   const int NPeer    = ( XY ) ? Pencil.NP[0] : Pencil.NP[1];
+   const int local_ny = Pencil.Y_Start [c0+1] - Pencil.Y_Start [c0];
+   const int local_nx = Pencil.XC_Start[c0+1] - Pencil.XC_Start[c0];
+   const int local_nz = Pencil.Z_Start [c1+1] - Pencil.Z_Start [c1];
+   const int local_nk = Pencil.YK_Start[c1+1] - Pencil.YK_Start[c1];
+
+// A = layout before the forward transpose, B = layout after the forward transpose
+// --> loop order of each block is always (z,y,x) for XY and (z,x,y) for !XY
+   int  (*BlkN_A)[3] = new int  [NPeer][3];
+   int  (*BlkN_B)[3] = new int  [NPeer][3];
+   long  *Offset_A   = new long [NPeer];
+   long  *Offset_B   = new long [NPeer];
+   long   Stride_A[3], Stride_B[3];
+
+   for (int q=0; q<NPeer; q++)
+   {
+      if ( XY )
+      {
+//       x-pencil [z][y][x] <-> y-pencil [z][x][y]
+         BlkN_A  [q][0] = local_nz;
+         BlkN_A  [q][1] = local_ny;
+         BlkN_A  [q][2] = Pencil.XC_Start[q+1] - Pencil.XC_Start[q];
+         Offset_A[q]    = Pencil.XC_Start[q];
+
+         BlkN_B  [q][0] = local_nz;
+         BlkN_B  [q][1] = Pencil.Y_Start[q+1] - Pencil.Y_Start[q];
+         BlkN_B  [q][2] = local_nx;
+         Offset_B[q]    = Pencil.Y_Start[q];
+      }
+
+      else
+      {
+//       y-pencil [z][x][y] <-> z-pencil [y][x][z]
+         BlkN_A  [q][0] = local_nz;
+         BlkN_A  [q][1] = local_nx;
+         BlkN_A  [q][2] = Pencil.YK_Start[q+1] - Pencil.YK_Start[q];
+         Offset_A[q]    = Pencil.YK_Start[q];
+
+         BlkN_B  [q][0] = Pencil.Z_Start[q+1] - Pencil.Z_Start[q];
+         BlkN_B  [q][1] = local_nx;
+         BlkN_B  [q][2] = local_nk;
+         Offset_B[q]    = Pencil.Z_Start[q];
+      }
+   }
+
+   if ( XY )
+   {
+      Stride_A[0] = (long)local_ny*Pencil.NxC;   Stride_A[1] = Pencil.NxC;    Stride_A[2] = 1;
+      Stride_B[0] = (long)local_nx*Pencil.N[1];  Stride_B[1] = 1;             Stride_B[2] = Pencil.N[1];
+   }
+
+   else
+   {
+      Stride_A[0] = (long)local_nx*Pencil.N[1];  Stride_A[1] = Pencil.N[1];   Stride_A[2] = 1;
+      Stride_B[0] = 1;                           Stride_B[1] = Pencil.N[2];   Stride_B[2] = (long)local_nx*Pencil.N[2];
+   }
+
+// the source (Src) and destination (Dst) sides of this transpose
+   const int  (*BlkN_Src)[3] = ( Forward ) ? BlkN_A   : BlkN_B;
+   const int  (*BlkN_Dst)[3] = ( Forward ) ? BlkN_B   : BlkN_A;
+   const long  *Offset_Src   = ( Forward ) ? Offset_A : Offset_B;
+   const long  *Offset_Dst   = ( Forward ) ? Offset_B : Offset_A;
+   const long  *Stride_Src   = ( Forward ) ? Stride_A : Stride_B;
+   const long  *Stride_Dst   = ( Forward ) ? Stride_B : Stride_A;
+
+
+// 1. pack data to Buf
+   int *SendCount = new int [NPeer];
+   int *RecvCount = new int [NPeer];
+   int *SendDisp  = new int [NPeer];
+   int *RecvDisp  = new int [NPeer];
+
+   for (int q=0; q<NPeer; q++)
+   {
+      SendCount[q] = 2*BlkN_Src[q][0]*BlkN_Src[q][1]*BlkN_Src[q][2];
+      RecvCount[q] = 2*BlkN_Dst[q][0]*BlkN_Dst[q][1]*BlkN_Dst[q][2];
+      SendDisp [q] = ( q == 0 ) ? 0 : SendDisp[q-1] + SendCount[q-1];
+      RecvDisp [q] = ( q == 0 ) ? 0 : RecvDisp[q-1] + RecvCount[q-1];
+   }
+
+   for (int q=0; q<NPeer; q++)
+      CopyBlock( In, Buf+SendDisp[q], BlkN_Src[q], Stride_Src, Offset_Src[q], true );
+
+
+// 2. exchange data from Buf to In
+   MPI_Alltoallv( Buf, SendCount, SendDisp, MPI_GAMER_REAL, In, RecvCount, RecvDisp, MPI_GAMER_REAL,
+                  ( XY ) ? Pencil.Comm_Row : Pencil.Comm_Col );
+
+
+// 3. unpack data to Buf
+   for (int q=0; q<NPeer; q++)
+      CopyBlock( Buf, In+RecvDisp[q], BlkN_Dst[q], Stride_Dst, Offset_Dst[q], false );
+
+
+   delete [] BlkN_A;
+   delete [] BlkN_B;
+   delete [] Offset_A;
+   delete [] Offset_B;
+   delete [] SendCount;
+   delete [] RecvCount;
+   delete [] SendDisp;
+   delete [] RecvDisp;
+
+} // FUNCTION : Transpose
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CopyBlock
+// Description :  Copy a 3D block of complex numbers between a pencil array and a contiguous buffer
+//
+// Note        :  1. Element (i0,i1,i2) of the block maps to Arr[ Offset + i0*Stride[0] + i1*Stride[1] + i2*Stride[2] ]
+//                   in units of complex numbers
+//
+// Parameter   :  Arr    : Pencil array
+//                Blk    : Contiguous buffer
+//                BlkN   : Block size
+//                Stride : Strides of the three block dimensions in Arr
+//                Offset : Offset of the block in Arr
+//                ToBlk  : true/false --> Arr -> Blk / Blk -> Arr
+//-------------------------------------------------------------------------------------------------------
+void CopyBlock( real *Arr, real *Blk, const int BlkN[], const long Stride[], const long Offset, const bool ToBlk )
+{
+
+#  pragma omp parallel for collapse( 2 ) schedule( static )
+   for (int i0=0; i0<BlkN[0]; i0++)
+   for (int i1=0; i1<BlkN[1]; i1++)
+   {
+      const long Idx0 = Offset + i0*Stride[0] + i1*Stride[1];
+      const long Blk0 = ( (long)i0*BlkN[1] + i1 )*BlkN[2];
+
+      if ( ToBlk )
+      {
+         for (int i2=0; i2<BlkN[2]; i2++)
+         {
+            const long Idx = Idx0 + i2*Stride[2];
+
+            Blk[ 2*(Blk0+i2)     ] = Arr[ 2*Idx     ];
+            Blk[ 2*(Blk0+i2) + 1 ] = Arr[ 2*Idx + 1 ];
+         }
+      }
+
+      else
+      {
+         for (int i2=0; i2<BlkN[2]; i2++)
+         {
+            const long Idx = Idx0 + i2*Stride[2];
+
+            Arr[ 2*Idx     ] = Blk[ 2*(Blk0+i2)     ];
+            Arr[ 2*Idx + 1 ] = Blk[ 2*(Blk0+i2) + 1 ];
+         }
+      }
+   } // i0,i1
+
+} // FUNCTION : CopyBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Index2Block
+// Description :  Return the block that the input index belongs to when N elements are split into NBlock
+//                blocks starting at N*b/NBlock
+//-------------------------------------------------------------------------------------------------------
+int Index2Block( const int Idx, const int N, const int NBlock )
+{
+
+   return int(  ( (long)(Idx+1)*NBlock - 1 ) / N  );
+
+} // FUNCTION : Index2Block
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Patch2Pencil
+// Description :  Patch-based data --> x-pencil layout of the pencil decomposition
+//
+// Note        :  1. Counterpart of Patch2Slab() for OPT__FFTW_PENCIL
+//                2. Data are sent as patch rows of PS1 cells along x
+//                3. List_PID[], List_jk[], and RecvBuf_PIdx will be allocated here; user needs to either call
+//                   Pencil2Patch() to free the memory or do manual deallocation
+//                4. VarP must be initialized (e.g., to zero) by the caller for the zero-padding regions
+//
+// Parameter   :  VarP          : Pencil array of the target variable in the x-pencil layout
+//                Pencil        : FFTW_Pencil_t object
+//                RecvBuf_PIdx  : 1D index in VarP of each received patch row
+//                List_PID      : PID of each patch row sent to each rank
+//                List_jk       : Local y/z coordinates (j + k*PS1) of each patch row sent to each rank
+//                List_NSendRow : Number of patch rows sent to each rank
+//                List_NRecvRow : Number of patch rows received from each rank
+//                PrepTime      : Physical time for preparing the target variable field
+//                TVar          : Target variable to be prepared
+//                ForPoisson    : Preparing the density field for the Poisson solver
+//                AddExtraMass  : Adding an extra density field for computing gravitational potential (only works with ForPoisson)
+//-------------------------------------------------------------------------------------------------------
+void Patch2Pencil( real *VarP, const FFTW_Pencil_t &Pencil, long **RecvBuf_PIdx, int **List_PID, int **List_jk,
+                   long *List_NSendRow, long *List_NRecvRow, const double PrepTime, const long TVar,
+                   const bool ForPoisson, const bool AddExtraMass )
+{
+
+// check only single field
+   if ( TVar == 0  ||  TVar & (TVar-1) )
+      Aux_Error( ERROR_INFO, "number of target variables is not one !!\n" );
+
+#  ifdef GRAVITY
+   if ( ForPoisson  &&  TVar != _TOTAL_DENS )
+      Aux_Error( ERROR_INFO, "TVar != _TOTAL_DENS for Poisson solver !!\n" );
+
+   if ( ForPoisson  &&  AddExtraMass  &&  Poi_AddExtraMassForGravity_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "Poi_AddExtraMassForGravity_Ptr == NULL for AddExtraMass !!\n" );
+#  endif
+
+
+   const int NReal  = amr->NPatchComma[0][1];
+   const int Scale0 = amr->scale[0];
+   const int SizeX  = 2*Pencil.NxC;    // padded size of x-pencils
+   int Cr[3], TRank;
+
+
+// 1. count the number of patch rows sent to each rank
+   for (int r=0; r<MPI_NRank; r++)  List_NSendRow[r] = 0;
+
+   for (int PID=0; PID<NReal; PID++)
+   {
+      for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      {
+         TRank = Index2Block( Cr[2]+k, Pencil.N[2], Pencil.NP[1] )*Pencil.NP[0] +
+                 Index2Block( Cr[1]+j, Pencil.N[1], Pencil.NP[0] );
+         List_NSendRow[TRank] ++;
+      }
+   }
+
+   long SendDispRow[MPI_NRank], RecvDispRow[MPI_NRank], SendCount[MPI_NRank], RecvCount[MPI_NRank];
+   long SendDisp[MPI_NRank], RecvDisp[MPI_NRank], Counter[MPI_NRank];
+
+   MPI_Alltoall( List_NSendRow, 1, MPI_LONG, List_NRecvRow, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      SendDispRow[r] = ( r == 0 ) ? 0 : SendDispRow[r-1] + List_NSendRow[r-1];
+      RecvDispRow[r] = ( r == 0 ) ? 0 : RecvDispRow[r-1] + List_NRecvRow[r-1];
+      SendCount  [r] = List_NSendRow[r]*PS1;
+      RecvCount  [r] = List_NRecvRow[r]*PS1;
+      SendDisp   [r] = SendDispRow[r]*PS1;
+      RecvDisp   [r] = RecvDispRow[r]*PS1;
+      Counter    [r] = 0;
+
+      List_PID[r] = (int*)malloc( List_NSendRow[r]*sizeof(int) );
+      List_jk [r] = (int*)malloc( List_NSendRow[r]*sizeof(int) );
+   }
+
+   const long NSendRow = SendDispRow[MPI_NRank-1] + List_NSendRow[MPI_NRank-1];
+   const long NRecvRow = RecvDispRow[MPI_NRank-1] + List_NRecvRow[MPI_NRank-1];
+
+   long *SendBuf_PIdx = new long [NSendRow];
+   real *SendBuf_Var  = new real [NSendRow*PS1];
+   real *RecvBuf_Var  = new real [NRecvRow*PS1];
+
+   *RecvBuf_PIdx = new long [NRecvRow];
+
+
+// 2. prepare the send buffer and record lists
+   const OptPotBC_t  PotBC_None        = BC_POT_NONE;
+   const IntScheme_t IntScheme         = INT_NONE;
+   const NSide_t     NSide_None        = NSIDE_00;
+   const bool        IntPhase_No       = false;
+   const bool        DE_Consistency_No = false;
+   const real        MinDens_No        = -1.0;
+   const real        MinPres_No        = -1.0;
+   const real        MinTemp_No        = -1.0;
+   const real        MinEntr_No        = -1.0;
+   const int         GhostSize         = 0;
+   const int         NPG               = 1;
+
+   real (*VarPatch)[PS1][PS1][PS1] = new real [8*NPG][PS1][PS1][PS1];
+
+   for (int PID0=0; PID0<NReal; PID0+=8)
+   {
+      Prepare_PatchData( 0, PrepTime, VarPatch[0][0][0], NULL, GhostSize, NPG, &PID0, TVar, _NONE,
+                         IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
+                         MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+#     ifdef GRAVITY
+//    add extra mass source for gravity if required
+      if ( ForPoisson  &&  AddExtraMass )
+      {
+         const double dh = amr->dh[0];
+
+         for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+         {
+            const double x0 = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
+            const double y0 = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
+            const double z0 = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
+
+            double x, y, z;
+
+            for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
+            for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
+            for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+               VarPatch[LocalID][k][j][i] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[0], 0, NULL );
+            }}}
+         }
+      }
+
+//    subtract the background density (which is assumed to be UNITY) for the isolated BC in the comoving frame
+#     ifdef COMOVING
+      if ( ForPoisson  &&  OPT__BC_POT == BC_POT_ISOLATED )
+      {
+         for (int LocalID=0; LocalID<8; LocalID++)
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+            VarPatch[LocalID][k][j][i] -= (real)1.0;
+      }
+#     endif
+#     endif // #ifdef GRAVITY
+
+//    copy data to the send buffer
+      for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+      {
+         for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         {
+            const int  ty   = Index2Block( Cr[1]+j, Pencil.N[1], Pencil.NP[0] );
+            const int  tz   = Index2Block( Cr[2]+k, Pencil.N[2], Pencil.NP[1] );
+            const int  ny   = Pencil.Y_Start[ty+1] - Pencil.Y_Start[ty];
+            const long Row  = SendDispRow[ tz*Pencil.NP[0] + ty ] + Counter[ tz*Pencil.NP[0] + ty ];
+
+            TRank = tz*Pencil.NP[0] + ty;
+
+            List_PID    [TRank][ Counter[TRank] ] = PID;
+            List_jk     [TRank][ Counter[TRank] ] = j + k*PS1;
+            SendBuf_PIdx[Row] = ( (long)(Cr[2]+k-Pencil.Z_Start[tz])*ny + (Cr[1]+j-Pencil.Y_Start[ty]) )*SizeX + Cr[0];
+
+            memcpy( SendBuf_Var + Row*PS1, VarPatch[LocalID][k][j], PS1*sizeof(real) );
+
+            Counter[TRank] ++;
+         }
+      } // for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+   } // for (int PID0=0; PID0<NReal; PID0+=8)
+
+   delete [] VarPatch;
+
+
+// 3. exchange data by MPI
+   MPI_Alltoallv_GAMER( SendBuf_PIdx, List_NSendRow, SendDispRow, MPI_LONG,
+                        *RecvBuf_PIdx, List_NRecvRow, RecvDispRow, MPI_LONG,       MPI_COMM_WORLD );
+
+   MPI_Alltoallv_GAMER( SendBuf_Var,  SendCount,     SendDisp,    MPI_GAMER_REAL,
+                        RecvBuf_Var,  RecvCount,     RecvDisp,    MPI_GAMER_REAL, MPI_COMM_WORLD );
+
+
+// 4. store the received data in the x-pencils
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NRecvRow; t++)
+      memcpy( VarP + (*RecvBuf_PIdx)[t], RecvBuf_Var + t*PS1, PS1*sizeof(real) );
+
+
+   delete [] SendBuf_PIdx;
+   delete [] SendBuf_Var;
+   delete [] RecvBuf_Var;
+
+} // FUNCTION : Patch2Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pencil2Patch
+// Description :  x-pencil layout of the pencil decomposition --> patch-based data
+//
+// Note        :  1. Counterpart of Slab2Patch() for OPT__FFTW_PENCIL
+//                2. Must be preceded by Patch2Pencil(), which sets all the lists
+//                3. Free List_PID[], List_jk[], and RecvBuf_PIdx allocated by Patch2Pencil()
+//
+// Parameter   :  VarP          : Pencil array of the target variable in the x-pencil layout
+//                Pencil        : FFTW_Pencil_t object
+//                RecvBuf_PIdx  : 1D index in VarP of each patch row received in Patch2Pencil()
+//                List_PID      : PID of each patch row sent to each rank in Patch2Pencil()
+//                List_jk       : Local y/z coordinates of each patch row sent to each rank in Patch2Pencil()
+//                List_NSendRow : Number of patch rows sent to each rank in Patch2Pencil()
+//                List_NRecvRow : Number of patch rows received from each rank in Patch2Pencil()
+//                SaveSg        : Sandglass to store the updated data
+//                TVar          : Target variable to be stored
+//-------------------------------------------------------------------------------------------------------
+void Pencil2Patch( const real *VarP, const FFTW_Pencil_t &Pencil, long *RecvBuf_PIdx, int **List_PID, int **List_jk,
+                   long *List_NSendRow, long *List_NRecvRow, const int SaveSg, const long TVar )
+{
+
+// check only single field
+   if ( TVar == 0  ||  TVar & (TVar-1) )
+      Aux_Error( ERROR_INFO, "number of target variables is not one !!\n" );
+
+// find the variable index
+   int TVarIdx = -1;
+   for (int v=0; v<NCOMP_TOTAL; v++)
+      if ( TVar & (1L<<v) )  TVarIdx = v;
+
+#  ifdef GRAVITY
+   if ( TVar == _POTE )  TVarIdx = NCOMP_TOTAL+NDERIVE;
+#  endif
+
+   if ( TVarIdx < 0 )
+      Aux_Error( ERROR_INFO, "unsupported variable %s = %d !!\n", "TVar", TVar );
+
+
+// 1. store the pencil data to the send buffer (the order of the rows received in Patch2Pencil())
+   long SendDisp[MPI_NRank], RecvDisp[MPI_NRank], SendCount[MPI_NRank], RecvCount[MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      SendCount[r] = List_NRecvRow[r]*PS1;
+      RecvCount[r] = List_NSendRow[r]*PS1;
+      SendDisp [r] = ( r == 0 ) ? 0 : SendDisp[r-1] + SendCount[r-1];
+      RecvDisp [r] = ( r == 0 ) ? 0 : RecvDisp[r-1] + RecvCount[r-1];
+   }
+
+   const long NSendRow = ( SendDisp[MPI_NRank-1] + SendCount[MPI_NRank-1] ) / PS1;
+   const long NRecvRow = ( RecvDisp[MPI_NRank-1] + RecvCount[MPI_NRank-1] ) / PS1;
+
+   real *SendBuf = new real [NSendRow*PS1];
+   real *RecvBuf = new real [NRecvRow*PS1];
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NSendRow; t++)
+      memcpy( SendBuf + t*PS1, VarP + RecvBuf_PIdx[t], PS1*sizeof(real) );
+
+
+// 2. exchange data by MPI
+   MPI_Alltoallv_GAMER( SendBuf, SendCount, SendDisp, MPI_GAMER_REAL,
+                        RecvBuf, RecvCount, RecvDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+
+
+// 3. store the received data to different patch objects
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      const real *RecvPtr = RecvBuf + RecvDisp[r];
+
+      for (long t=0; t<List_NSendRow[r]; t++)
+      {
+         const int PID = List_PID[r][t];
+         const int j   = List_jk [r][t] % PS1;
+         const int k   = List_jk [r][t] / PS1;
+
+         if ( TVarIdx < NCOMP_TOTAL )
+            memcpy( amr->patch[SaveSg][0][PID]->fluid[TVarIdx][k][j], RecvPtr, PS1*sizeof(real) );
+#        ifdef GRAVITY
+         else if ( TVarIdx == NCOMP_TOTAL+NDERIVE )
+            memcpy( amr->patch[SaveSg][0][PID]->pot[k][j], RecvPtr, PS1*sizeof(real) );
+#        endif
+         else
+            Aux_Error( ERROR_INFO, "incorrect target variable index %s = %d !!\n", "TVarIdx", TVarIdx );
+
+         RecvPtr += PS1;
+      }
+   }
+
+
+// free memory
+   delete [] SendBuf;
+   delete [] RecvBuf;
+   delete [] RecvBuf_PIdx;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      free( List_PID[r] );
+      free( List_jk [r] );
+   }
+
+} // FUNCTION : Pencil2Patch
+
+
+
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
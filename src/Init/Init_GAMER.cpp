@@ -167,6 +167,11 @@ void Init_GAMER( int *argc, char ***argv )
 #  endif
 
 
+// initialize the patch slabs
+// --> must be done before allocating any patch
+   if ( OPT__PATCH_SLAB )     amr->SlabInit();
+
+
 // initialize memory pool
    if ( OPT__MEMORY_POOL )    Init_MemoryPool();
 
@@ -231,6 +236,11 @@ void Init_GAMER( int *argc, char ***argv )
    }
 
 
+// compact the patch slabs of all levels
+   if ( OPT__PATCH_SLAB )
+   for (int lv=0; lv<NLEVEL; lv++)  amr->SlabCompact( lv );
+
+
 // ensure B field consistency on the shared interfaces between sibling patches
 #  if ( MODEL == HYDRO  &&  defined MHD )
    if ( OPT__SAME_INTERFACE_B )
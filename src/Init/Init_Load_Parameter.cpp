@@ -89,6 +89,8 @@ void Init_Load_Parameter()
    ReadPara->Add( "PAR_REMOVE_CELL",            &amr->Par->RemoveCell,           -1.0,              NoMin_double,  NoMax_double   );
    ReadPara->Add( "OPT__FREEZE_PAR",            &OPT__FREEZE_PAR,                 false,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "PAR_TR_VEL_CORR",            &amr->Par->TracerVelCorr,         false,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "PAR_SORT_INTERVAL",          &amr->Par->SortInterval,          0,                NoMin_int,     NoMax_int      );
+   ReadPara->Add( "PAR_SPARSE_EXCHANGE",        &amr->Par->SparseExchange,        false,            Useless_bool,  Useless_bool   );
 #  endif // #ifdef PARTICLE
 
 
@@ -128,6 +130,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "DT__SYNC_PARENT_LV",         &DT__SYNC_PARENT_LV,              0.1,             0.0,           NoMax_double   );
    ReadPara->Add( "DT__SYNC_CHILDREN_LV",       &DT__SYNC_CHILDREN_LV,            0.1,             0.0,           1.0            );
    ReadPara->Add( "OPT__DT_USER",               &OPT__DT_USER,                    false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__DT_FLU_CACHE",          &OPT__DT_FLU_CACHE,               false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__DT_LEVEL",              &OPT__DT_LEVEL,                   3,               1,             3              );
    ReadPara->Add( "OPT__RECORD_DT",             &OPT__RECORD_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT",             &AUTO_REDUCE_DT,                  true,            Useless_bool,  Useless_bool   );
@@ -191,6 +194,7 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
    ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PATCH_SLAB",            &OPT__PATCH_SLAB,                 false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -200,6 +204,8 @@ void Init_Load_Parameter()
    ReadPara->Add( "LB_INPUT__PAR_WEIGHT",       &LB_INPUT__PAR_WEIGHT,            0.0,             0.0,           NoMax_double   );
 #  endif
    ReadPara->Add( "OPT__RECORD_LOAD_BALANCE",   &OPT__RECORD_LOAD_BALANCE,        true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__SPARSE_MPI_EXCHANGE",   &OPT__SPARSE_MPI_EXCHANGE,        false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_MEASURED_COST",      &OPT__LB_MEASURED_COST,           false,           Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       false,           Useless_bool,  Useless_bool   );
 
@@ -315,6 +321,7 @@ void Init_Load_Parameter()
 // do not check FLU_GPU_NPGROUP and GPU_NSTREAM since they may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "FLU_GPU_NPGROUP",            &FLU_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "GPU_NSTREAM",                &GPU_NSTREAM,                    -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__CPU_FUSED_SOLVER",      &OPT__CPU_FUSED_SOLVER,           false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FIXUP_FLUX",            &OPT__FIXUP_FLUX,                 true,            Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__FIXUP_ELECTRIC",        &OPT__FIXUP_ELECTRIC,             true,            Useless_bool,  Useless_bool   );
@@ -354,11 +361,18 @@ void Init_Load_Parameter()
    ReadPara->Add( "SOR_OMEGA",                  &SOR_OMEGA,                      -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "SOR_MAX_ITER",               &SOR_MAX_ITER,                   -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "SOR_MIN_ITER",               &SOR_MIN_ITER,                   -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "SOR_CHECK_INTERVAL",         &SOR_CHECK_INTERVAL,              1,                1,             NoMax_int      );
 // do not check MG_XXX since they may be reset by Init_Set_Default_MG_Parameter()
    ReadPara->Add( "MG_MAX_ITER",                &MG_MAX_ITER,                    -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPRE_SMOOTH",             &MG_NPRE_SMOOTH,                 -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_NPOST_SMOOTH",            &MG_NPOST_SMOOTH,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "MG_TOLERATED_ERROR",         &MG_TOLERATED_ERROR,             -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OPT__POI_LEVEL_MG",          &OPT__POI_LEVEL_MG,               false,           Useless_bool,  Useless_bool   );
+// do not check POI_LEVEL_MG_XXX since they may be reset by Init_ResetParameter()
+   ReadPara->Add( "POI_LEVEL_MG_MAX_ITER",      &POI_LEVEL_MG_MAX_ITER,          -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "POI_LEVEL_MG_NPRE_SMOOTH",   &POI_LEVEL_MG_NPRE_SMOOTH,       -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "POI_LEVEL_MG_NPOST_SMOOTH",  &POI_LEVEL_MG_NPOST_SMOOTH,      -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "POI_LEVEL_MG_TOLERATED_ERROR", &POI_LEVEL_MG_TOLERATED_ERROR, -1.0,             NoMin_double,  NoMax_double   );
 // do not check POT_GPU_NPGROUP since it may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "POT_GPU_NPGROUP",            &POT_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__GRA_P5_GRADIENT",       &OPT__GRA_P5_GRADIENT,            false,           Useless_bool,  Useless_bool   );
@@ -415,10 +429,13 @@ void Init_Load_Parameter()
 #  else  // # if ( SUPPORT_FFTW == FFTW2 ) ... # else
 #  error : ERROR : Unsupported FFTW version for OPT__FFTW_STARTUP
 #  endif // #  if ( SUPPORT_FFTW == FFTW2 ) ... # else
+// load OPT__FFTW_PENCIL for FFTW2 as well so that Aux_Check_Parameter() can reject it
+   ReadPara->Add( "OPT__FFTW_PENCIL",           &OPT__FFTW_PENCIL,                false,           Useless_bool,  Useless_bool   );
 #  endif // # ifdef SUPPORT_FFTW
 
 // interpolation schemes
    ReadPara->Add( "OPT__INT_TIME",              &OPT__INT_TIME,                   true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__INT_CACHE",             &OPT__INT_CACHE,                  false,           Useless_bool,  Useless_bool   );
 #  if ( MODEL == HYDRO )
    ReadPara->Add( "OPT__INT_PRIM",              &OPT__INT_PRIM,                   true,            Useless_bool,  Useless_bool   );
 #  endif
@@ -454,6 +471,10 @@ void Init_Load_Parameter()
 
 // data dump
    ReadPara->Add( "OPT__OUTPUT_TOTAL",          &OPT__OUTPUT_TOTAL,               1,               0,             2              );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_COLLECTIVE",&OPT__OUTPUT_HDF5_COLLECTIVE,     false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_AGGREGATE", &OPT__OUTPUT_HDF5_AGGREGATE,      false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__OUTPUT_HDF5_ASYNC",     &OPT__OUTPUT_HDF5_ASYNC,          false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OUTPUT_HDF5_ASYNC_MAX_MEM",  &OUTPUT_HDF5_ASYNC_MAX_MEM,       1024.0,          Eps_double,    NoMax_double   );
    ReadPara->Add( "OPT__OUTPUT_PART",           &OPT__OUTPUT_PART,                0,               0,             7              );
    ReadPara->Add( "OPT__OUTPUT_USER",           &OPT__OUTPUT_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OUTPUT_TEXT_FORMAT_FLT", OPT__OUTPUT_TEXT_FORMAT_FLT,     "%24.16e",       Useless_str,   Useless_str    );
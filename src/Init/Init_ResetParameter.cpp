@@ -158,6 +158,51 @@ void Init_ResetParameter()
 #  endif // GRAVITY
 
 
+// level-wide multigrid Poisson solver parameters
+#  ifdef GRAVITY
+   if ( OPT__POI_LEVEL_MG )
+   {
+#     ifdef FLOAT8
+      const int    Default_Max_Iter        = 20;
+      const double Default_Tolerated_Error = 1.e-15;
+#     else
+      const int    Default_Max_Iter        = 10;
+      const double Default_Tolerated_Error = 1.e-6;
+#     endif
+      const int    Default_NPre_Smooth     = 3;
+      const int    Default_NPost_Smooth    = 3;
+
+      if ( POI_LEVEL_MG_MAX_ITER < 0 )
+      {
+         POI_LEVEL_MG_MAX_ITER = Default_Max_Iter;
+
+         PRINT_RESET_PARA( POI_LEVEL_MG_MAX_ITER, FORMAT_INT, "" );
+      }
+
+      if ( POI_LEVEL_MG_NPRE_SMOOTH < 0 )
+      {
+         POI_LEVEL_MG_NPRE_SMOOTH = Default_NPre_Smooth;
+
+         PRINT_RESET_PARA( POI_LEVEL_MG_NPRE_SMOOTH, FORMAT_INT, "" );
+      }
+
+      if ( POI_LEVEL_MG_NPOST_SMOOTH < 0 )
+      {
+         POI_LEVEL_MG_NPOST_SMOOTH = Default_NPost_Smooth;
+
+         PRINT_RESET_PARA( POI_LEVEL_MG_NPOST_SMOOTH, FORMAT_INT, "" );
+      }
+
+      if ( POI_LEVEL_MG_TOLERATED_ERROR < 0.0 )
+      {
+         POI_LEVEL_MG_TOLERATED_ERROR = Default_Tolerated_Error;
+
+         PRINT_RESET_PARA( POI_LEVEL_MG_TOLERATED_ERROR, FORMAT_REAL, "" );
+      }
+   } // if ( OPT__POI_LEVEL_MG )
+#  endif // GRAVITY
+
+
 // external potential table
 #  ifdef GRAVITY
    if ( OPT__EXT_POT == EXT_POT_TABLE  &&  EXT_POT_TABLE_FLOAT8 < 0 )
@@ -230,6 +275,28 @@ void Init_ResetParameter()
 #  endif // #ifndef GPU
 
 
+// disable OPT__CPU_FUSED_SOLVER when using GPU
+#  ifdef GPU
+   if ( OPT__CPU_FUSED_SOLVER )
+   {
+      OPT__CPU_FUSED_SOLVER = false;
+
+      PRINT_RESET_PARA( OPT__CPU_FUSED_SOLVER, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+
+// disable OPT__DT_FLU_CACHE when the fluid solver does not record the maximum signal speed
+#  if ( MODEL != HYDRO  ||  defined SRHD  ||  defined CR_DIFFUSION )
+   if ( OPT__DT_FLU_CACHE )
+   {
+      OPT__DT_FLU_CACHE = false;
+
+      PRINT_RESET_PARA( OPT__DT_FLU_CACHE, FORMAT_INT, "since it only supports HYDRO without SRHD and CR_DIFFUSION" );
+   }
+#  endif
+
+
 // derived parameters related to the simulation scale
    int NX0_Max;
    NX0_Max = ( NX0_TOT[0] > NX0_TOT[1] ) ? NX0_TOT[0] : NX0_TOT[1];
@@ -553,8 +620,41 @@ void Init_ResetParameter()
    }
 
 
+// turn off the parallel HDF5 output options for SERIAL and OPT__OUTPUT_HDF5_ASYNC
+#  ifdef SERIAL
+   if ( OPT__OUTPUT_HDF5_COLLECTIVE )
+   {
+      OPT__OUTPUT_HDF5_COLLECTIVE = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_COLLECTIVE, FORMAT_INT, "since SERIAL is enabled" );
+   }
+
+   if ( OPT__OUTPUT_HDF5_AGGREGATE )
+   {
+      OPT__OUTPUT_HDF5_AGGREGATE = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_AGGREGATE, FORMAT_INT, "since SERIAL is enabled" );
+   }
+#  endif
+
+   if ( OPT__OUTPUT_HDF5_ASYNC  &&  OPT__OUTPUT_HDF5_COLLECTIVE )
+   {
+      OPT__OUTPUT_HDF5_COLLECTIVE = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_COLLECTIVE, FORMAT_INT, "since OPT__OUTPUT_HDF5_ASYNC is enabled" );
+   }
+
+   if ( OPT__OUTPUT_HDF5_ASYNC  &&  OPT__OUTPUT_HDF5_AGGREGATE )
+   {
+      OPT__OUTPUT_HDF5_AGGREGATE = false;
+
+      PRINT_RESET_PARA( OPT__OUTPUT_HDF5_AGGREGATE, FORMAT_INT, "since OPT__OUTPUT_HDF5_ASYNC is enabled" );
+   }
+
+
 // turn off "OPT__OVERLAP_MPI" if (1) OVERLAP_MPI=ff, (2) SERIAL=on, (3) LOAD_BALANCE=off,
-//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE
+//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE,
+//                                (6) MHD=on, (7) OPT__TIMING_BARRIER=on
 #  ifndef OVERLAP_MPI
    if ( OPT__OVERLAP_MPI )
    {
@@ -603,6 +703,23 @@ void Init_ResetParameter()
    }
 #  endif
 
+#  ifdef MHD
+   if ( OPT__OVERLAP_MPI )
+   {
+      OPT__OVERLAP_MPI = false;
+
+      PRINT_RESET_PARA( OPT__OVERLAP_MPI, FORMAT_INT, "since MHD is not supported yet" );
+   }
+#  endif
+
+// MPI_Barrier() cannot be invoked by the computing and communicating threads simultaneously
+   if ( OPT__OVERLAP_MPI  &&  OPT__TIMING_BARRIER )
+   {
+      OPT__OVERLAP_MPI = false;
+
+      PRINT_RESET_PARA( OPT__OVERLAP_MPI, FORMAT_INT, "since OPT__TIMING_BARRIER is enabled" );
+   }
+
 
 // disable "OPT__CK_FLUX_ALLOCATE" if no flux arrays are going to be allocated
    if ( OPT__CK_FLUX_ALLOCATE  &&  !amr->WithFlux )
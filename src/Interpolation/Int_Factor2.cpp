@@ -0,0 +1,270 @@
+#include "GAMER.h"
+
+void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                     real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                     const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
+void Int_CQuartic  ( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                     real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                     const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
+
+
+// maximum number of coarse-grid ghost zones supported by the specialized kernels (i.e., INT_CQUAR)
+#define F2_MAX_CGHOST   2
+
+// sizes of the temporary arrays on the stack
+// --> all shapes used by Refine() and InterpolateGhostZone() have CRange[d] <= PS1
+#define F2_TDATAX_SIZE  ( 2*PS1*SQR(PS1+2*F2_MAX_CGHOST) )
+#define F2_TDATAY_SIZE  ( 4*SQR(PS1)*(PS1+2*F2_MAX_CGHOST) )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Factor2_Slope
+// Description :  Compute the interpolated values on the left and right halves of one coarse cell along
+//                one direction for the conservative quadratic and quartic schemes
+//
+// Note        :  1. Identical to the 1D operation in Int_CQuadratic() and Int_CQuartic(), except that
+//                   the monotonicity and opposite-sign checks are resolved at compile time
+//                2. Invoked by Int_Factor2_1Comp()
+//
+// Parameter   :  CGhost          : Number of coarse-grid ghost zones (1/2 -> INT_CQUAD/INT_CQUAR)
+//                Mono            : Ensure that the interpolation results are monotonic
+//                OppSign0thOrder : See Int_MinMod1D()
+//                In              : Pointer to the central input cell
+//                d               : Index stride along the target direction
+//                MonoCoeff       : Slope limiter coefficient
+//                OutL/R          : Output values on the left/right halves
+//-------------------------------------------------------------------------------------------------------
+template <int CGhost, bool Mono, bool OppSign0thOrder>
+static inline void Int_Factor2_Slope( const real *In, const int d, const real MonoCoeff, real &OutL, real &OutR )
+{
+
+   const real C  = In[  0];
+   const real L1 = In[ -d];
+   const real R1 = In[ +d];
+
+   real SlopeDh_4;
+
+   if ( CGhost == 1 )
+      SlopeDh_4 = (real)0.125*( R1 - L1 );
+
+   else
+   {
+      const real IntCoeff[5] = { +3.0/128.0, -22.0/128.0, +128.0/128.0, +22.0/128.0, -3.0/128.0 };
+
+      SlopeDh_4 = IntCoeff[0]*In[-2*d] + IntCoeff[1]*L1 +
+                  IntCoeff[3]*R1       + IntCoeff[4]*In[+2*d];
+   }
+
+   if ( Mono )
+   {
+      real LSlopeDh_4 = (real)0.25*( C  - L1 );
+      real RSlopeDh_4 = (real)0.25*( R1 - C  );
+
+      if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 )
+      {
+         if ( CGhost == 2  &&  SlopeDh_4*LSlopeDh_4 < (real)0.0 )   SlopeDh_4 = (real)0.125*( R1 - L1 );
+
+         const real Sign = SIGN( LSlopeDh_4 );
+         SlopeDh_4  *= Sign;
+         LSlopeDh_4 *= Sign;
+         RSlopeDh_4 *= Sign;
+
+         if ( LSlopeDh_4 < RSlopeDh_4 )   LSlopeDh_4 *= MonoCoeff;
+         else                             RSlopeDh_4 *= MonoCoeff;
+
+         SlopeDh_4  = FMIN( LSlopeDh_4, SlopeDh_4 );
+         SlopeDh_4  = FMIN( RSlopeDh_4, SlopeDh_4 );
+         SlopeDh_4 *= Sign;
+      }
+
+      else
+         SlopeDh_4 = (real)0.0;
+   } // if ( Mono )
+
+   if ( OppSign0thOrder  &&  L1*R1 < (real)0.0 )   SlopeDh_4 = (real)0.0;
+
+   OutL = C - SlopeDh_4;
+   OutR = C + SlopeDh_4;
+
+} // FUNCTION : Int_Factor2_Slope
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Factor2_1Comp
+// Description :  Interpolate one component with the conservative quadratic or quartic scheme
+//
+// Note        :  1. FullPatch = true is for the shape used by Refine() and LB_Refine_AllocateNewPatch(),
+//                   for which all index strides are compile-time constants:
+//                      CRange = PS1, CSize = PS1+2*CGhost, FSize = PS2 along all directions
+//                2. FullPatch = false is for all other shapes (e.g., the ghost-zone slabs of InterpolateGhostZone())
+//                3. The inner loops of the y and z sweeps are contiguous along x and free of branches
+//                   on runtime options so that they can be vectorized
+//
+// Parameter   :  See Int_Factor2_Slope() and Interpolate()
+//-------------------------------------------------------------------------------------------------------
+template <int CGhost, bool Mono, bool OppSign0thOrder, bool FullPatch>
+static void Int_Factor2_1Comp( const real *CPtr, const int CSize[3], const int CStart[3], const int CRange[3],
+                               real *FPtr, const int FSize[3], const int FStart[3], const real MonoCoeff )
+{
+
+// sizes and index strides resolved at compile time for FullPatch
+   const int CRx  = ( FullPatch ) ? PS1          : CRange[0];
+   const int CRy  = ( FullPatch ) ? PS1          : CRange[1];
+   const int CRz  = ( FullPatch ) ? PS1          : CRange[2];
+   const int Cdy  = ( FullPatch ) ? PS1+2*CGhost : CSize[0];
+   const int Cdz  = ( FullPatch ) ? SQR(Cdy)     : Cdy*CSize[1];
+   const int Fdy  = ( FullPatch ) ? PS2          : FSize[0];
+   const int Fdz  = ( FullPatch ) ? SQR(PS2)     : Fdy*FSize[1];
+
+   const int Tdy  = 2*CRx;
+   const int TdzX = Tdy*( CRy + 2*CGhost );
+   const int TdzY = Tdy*( 2*CRy );
+
+   real TDataX[F2_TDATAX_SIZE];     // temporary array after x interpolation
+   real TDataY[F2_TDATAY_SIZE];     // temporary array after y interpolation
+
+
+// interpolation along x direction
+   for (int k=0; k<CRz+2*CGhost; k++)
+   for (int j=0; j<CRy+2*CGhost; j++)
+   {
+      const real *In  = CPtr + ( CStart[2]-CGhost+k )*Cdz + ( CStart[1]-CGhost+j )*Cdy + CStart[0];
+            real *Out = TDataX + k*TdzX + j*Tdy;
+
+      for (int i=0; i<CRx; i++)
+         Int_Factor2_Slope<CGhost,Mono,OppSign0thOrder>( In+i, 1, MonoCoeff, Out[2*i], Out[2*i+1] );
+   }
+
+
+// interpolation along y direction
+   for (int k=0; k<CRz+2*CGhost; k++)
+   for (int j=0; j<CRy;          j++)
+   {
+      const real *In   = TDataX + k*TdzX + ( j+CGhost )*Tdy;
+            real *OutL = TDataY + k*TdzY + ( 2*j      )*Tdy;
+            real *OutR = OutL + Tdy;
+
+      for (int i=0; i<2*CRx; i++)
+         Int_Factor2_Slope<CGhost,Mono,OppSign0thOrder>( In+i, Tdy, MonoCoeff, OutL[i], OutR[i] );
+   }
+
+
+// interpolation along z direction
+   for (int k=0; k<CRz;   k++)
+   for (int j=0; j<2*CRy; j++)
+   {
+      const real *In   = TDataY + ( k+CGhost )*TdzY + j*Tdy;
+            real *OutL = FPtr + ( FStart[2]+2*k )*Fdz + ( FStart[1]+j )*Fdy + FStart[0];
+            real *OutR = OutL + Fdz;
+
+      for (int i=0; i<2*CRx; i++)
+         Int_Factor2_Slope<CGhost,Mono,OppSign0thOrder>( In+i, TdzY, MonoCoeff, OutL[i], OutR[i] );
+   }
+
+} // FUNCTION : Int_Factor2_1Comp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Factor2
+// Description :  Perform the conservative quadratic or quartic interpolation with the specialized kernels
+//
+// Note        :  1. Results are bitwise identical to Int_CQuadratic() and Int_CQuartic()
+//                2. Return false without doing anything if the input is not supported
+//                   --> Phase unwrapping or CRange[d] > PS1
+//                3. Temporary arrays are allocated on the stack
+//
+// Parameter   :  CGhost : Number of coarse-grid ghost zones (1/2 -> INT_CQUAD/INT_CQUAR)
+//                Others : See Interpolate()
+//
+// Return      :  true/false --> the interpolation is done/skipped
+//-------------------------------------------------------------------------------------------------------
+template <int CGhost>
+static bool Int_Factor2( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                         real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                         const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                         const bool OppSign0thOrder )
+{
+
+   if ( UnwrapPhase )   return false;
+
+   for (int d=0; d<3; d++)
+      if ( CRange[d] > PS1 )  return false;
+
+   bool FullPatch = true;
+
+   for (int d=0; d<3; d++)
+   {
+      if ( CRange[d] != PS1  ||  CSize[d] != PS1+2*CGhost  ||  FSize[d] != PS2 )
+      {
+         FullPatch = false;
+         break;
+      }
+   }
+
+   const int CDisp = CSize[0]*CSize[1]*CSize[2];
+   const int FDisp = FSize[0]*FSize[1]*FSize[2];
+
+   for (int v=0; v<NComp; v++)
+   {
+      const real *CPtr = CData + v*CDisp;
+            real *FPtr = FData + v*FDisp;
+
+      switch (  ( FullPatch << 2 ) | ( Monotonic[v] << 1 ) | OppSign0thOrder  )
+      {
+         case 0 : Int_Factor2_1Comp<CGhost,false,false,false>( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 1 : Int_Factor2_1Comp<CGhost,false,true ,false>( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 2 : Int_Factor2_1Comp<CGhost,true ,false,false>( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 3 : Int_Factor2_1Comp<CGhost,true ,true ,false>( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 4 : Int_Factor2_1Comp<CGhost,false,false,true >( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 5 : Int_Factor2_1Comp<CGhost,false,true ,true >( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 6 : Int_Factor2_1Comp<CGhost,true ,false,true >( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+         case 7 : Int_Factor2_1Comp<CGhost,true ,true ,true >( CPtr, CSize, CStart, CRange, FPtr, FSize, FStart, MonoCoeff ); break;
+      }
+   }
+
+   return true;
+
+} // FUNCTION : Int_Factor2
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_CQuadratic_Factor2 / Int_CQuartic_Factor2
+// Description :  Interpolation-scheme functions of INT_CQUAD/INT_CQUAR selected by Int_SelectScheme()
+//
+// Note        :  1. Use the specialized kernels in Int_Factor2() if applicable
+//                2. Otherwise fall back to Int_CQuadratic() and Int_CQuartic()
+//
+// Parameter   :  See Interpolate()
+//-------------------------------------------------------------------------------------------------------
+void Int_CQuadratic_Factor2( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                             real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                             const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                             const bool OppSign0thOrder )
+{
+
+   if (  ! Int_Factor2<1>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                           UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder )  )
+      Int_CQuadratic( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                      UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
+
+} // FUNCTION : Int_CQuadratic_Factor2
+
+
+
+void Int_CQuartic_Factor2( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                           real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                           const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                           const bool OppSign0thOrder )
+{
+
+   if (  ! Int_Factor2<2>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                           UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder )  )
+      Int_CQuartic( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                    UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
+
+} // FUNCTION : Int_CQuartic_Factor2
@@ -34,6 +34,12 @@ void Int_CQuartic  ( real CData[], const int CSize[3], const int CStart[3], cons
 void Int_Quartic   ( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
                      real FData[], const int FSize[3], const int FStart[3], const int NComp,
                      const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
+void Int_CQuadratic_Factor2( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                             real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                             const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
+void Int_CQuartic_Factor2  ( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                             real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                             const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
 
 
 
@@ -535,7 +541,9 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
 // Function    :  Int_SelectScheme
 // Description :  Select a spatial interpolation scheme
 //
-// Note        :  Use the input parameter "IntScheme" to determine the adopted interpolation scheme
+// Note        :  1. Use the input parameter "IntScheme" to determine the adopted interpolation scheme
+//                2. INT_CQUAD and INT_CQUAR use the specialized kernels in Int_Factor2.cpp, which fall back
+//                   to Int_CQuadratic() and Int_CQuartic() for unsupported inputs
 //
 // Parameter   :  IntScheme : Interpolation scheme
 //                            --> Currently supported schemes include
@@ -554,13 +562,13 @@ static IntSchemeFunc_t Int_SelectScheme( const IntScheme_t IntScheme )
 
    switch ( IntScheme )
    {
-      case INT_MINMOD3D :  return Int_MinMod3D;    break;
-      case INT_MINMOD1D :  return Int_MinMod1D;    break;
-      case INT_VANLEER  :  return Int_vanLeer;     break;
-      case INT_CQUAD    :  return Int_CQuadratic;  break;
-      case INT_QUAD     :  return Int_Quadratic;   break;
-      case INT_CQUAR    :  return Int_CQuartic;    break;
-      case INT_QUAR     :  return Int_Quartic;     break;
+      case INT_MINMOD3D :  return Int_MinMod3D;            break;
+      case INT_MINMOD1D :  return Int_MinMod1D;            break;
+      case INT_VANLEER  :  return Int_vanLeer;             break;
+      case INT_CQUAD    :  return Int_CQuadratic_Factor2;  break;
+      case INT_QUAD     :  return Int_Quadratic;           break;
+      case INT_CQUAR    :  return Int_CQuartic_Factor2;    break;
+      case INT_QUAR     :  return Int_Quartic;             break;
       default           :  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "IntScheme", IntScheme );
    }
 
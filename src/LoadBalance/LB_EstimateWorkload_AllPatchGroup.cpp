@@ -17,6 +17,13 @@
 //                   --> For non-leaf patches, this function will collect particles from the leaf patches
 //                3. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
 //                   function "Mis_GetTotalPatchNumber( lv )"
+//                4. For OPT__LB_MEASURED_COST, the estimated workload of each patch group is replaced by the
+//                   measured workload (i.e., the sum of patch_t::LB_Cost) if all of its patches have been measured
+//                   --> Measured workload is renormalized so that the total workload of all measured patch groups
+//                       in all ranks is the same as that estimated above
+//                       --> Patch groups not measured yet (e.g., just created) can still adopt the estimated workload
+//                       --> Weighting between different levels is the same as that without OPT__LB_MEASURED_COST
+//                   --> Must be invoked by all ranks since it calls MPI_Allreduce()
 //
 // Parameter   :  lv        : Target refinement level
 //                ParWeight : Relative workload weighting of particles
@@ -80,6 +87,50 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
    } // if ( ParWeight_Norm > 0.0 )
 #  endif // #ifdef PARTICLE
 
+
+// 3. replace the estimated workload by the measured workload
+   if ( OPT__LB_MEASURED_COST )
+   {
+      double *Cost_PG = new double [NPG_ThisRank];
+      double  Sum_ThisRank[2] = { 0.0, 0.0 };   // [0/1] = estimated/measured workload of all measured patch groups
+      double  Sum_AllRank [2];
+
+      for (int t=0; t<NPG_ThisRank; t++)
+      {
+         Cost_PG[t] = 0.0;
+
+         for (int PID=t*8; PID<(t+1)*8; PID++)
+         {
+            if ( amr->patch[0][lv][PID]->LB_Cost < 0.0 )
+            {
+               Cost_PG[t] = -1.0;
+               break;
+            }
+
+            Cost_PG[t] += amr->patch[0][lv][PID]->LB_Cost;
+         }
+
+         if ( Cost_PG[t] >= 0.0 )
+         {
+            Sum_ThisRank[0] += Load_PG[t];
+            Sum_ThisRank[1] += Cost_PG[t];
+         }
+      }
+
+      MPI_Allreduce( Sum_ThisRank, Sum_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+//    keep the estimated workload if there are no valid measurements at all
+      if ( Sum_AllRank[1] > 0.0 )
+      {
+         const double Norm = Sum_AllRank[0] / Sum_AllRank[1];
+
+         for (int t=0; t<NPG_ThisRank; t++)
+            if ( Cost_PG[t] >= 0.0 )   Load_PG[t] = Cost_PG[t]*Norm;
+      }
+
+      delete [] Cost_PG;
+   } // if ( OPT__LB_MEASURED_COST )
+
 } // FUNCTION : LB_EstimateWorkload_AllPatchGroup
 
 
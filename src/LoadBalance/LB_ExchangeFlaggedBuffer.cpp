@@ -14,6 +14,8 @@
 //                   all real patches
 //                2. Flag list is sorted by the recv rank instead of the send rank
 //                   --> Sorting and matching only need to be done once
+//                3. The target ranks of the flagged sibling-buffer patches and the final flagging are computed
+//                   with OpenMP
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -21,47 +23,33 @@ void LB_ExchangeFlaggedBuffer( const int lv )
 {
 
    const int NSibBuf = amr->NPatchComma[lv][2] - amr->NPatchComma[lv][1];
-   const int MemUnit = 1 + NSibBuf/MPI_NRank;      // set arbitrarily
 
-   int   TRank, MemSize[MPI_NRank], NSend[MPI_NRank];
-   long  LBIdx;
-   long *Send_Temp[MPI_NRank];
-
-// initialize arrays
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      MemSize  [r] = MemUnit;
-      Send_Temp[r] = (long*)malloc( MemSize[r]*sizeof(long) );
-      NSend    [r] = 0;
-   }
+   int   TRank, NSend[MPI_NRank], Send_Offset[MPI_NRank];
+   int  *TRank_List = new int [NSibBuf];
 
 
 // 1. collect the LB_Idx of all flagged sibling-buffer patches
 // ==========================================================================================
-   for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][2]; PID++)
+// 1.1 get the target rank of each flagged sibling-buffer patch (-1 for unflagged patches)
+#  pragma omp parallel for schedule( static )
+   for (int t=0; t<NSibBuf; t++)
    {
-      if ( amr->patch[0][lv][PID]->flag )
-      {
-         LBIdx = amr->patch[0][lv][PID]->LB_Idx;
-         TRank = LB_Index2Rank( lv, LBIdx, CHECK_ON );
+      const int PID = amr->NPatchComma[lv][1] + t;
 
-//       allocate enough memory
-         if ( NSend[TRank] >= MemSize[TRank] )
-         {
-            MemSize  [TRank] += MemUnit;
-            Send_Temp[TRank]  = (long*)realloc( Send_Temp[TRank], MemSize[TRank]*sizeof(long) );
-         }
+      TRank_List[t] = ( amr->patch[0][lv][PID]->flag ) ? LB_Index2Rank( lv, amr->patch[0][lv][PID]->LB_Idx, CHECK_ON )
+                                                       : -1;
+   }
 
-//       record list
-         Send_Temp[TRank][ NSend[TRank] ++ ] = LBIdx;
+// 1.2 count the number of patches sent to each rank
+   for (int r=0; r<MPI_NRank; r++)  NSend[r] = 0;
 
-      } // if ( amr->patch[0][lv][PID]->flag )
-   } // for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][2]; PID++)
+   for (int t=0; t<NSibBuf; t++)
+      if ( TRank_List[t] >= 0 )  NSend[ TRank_List[t] ] ++;
 
 
 // 2. broadcast the unsorted send list to all other ranks
 // ==========================================================================================
-   int   NRecv[MPI_NRank], Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank], NSend_Total, NRecv_Total, Counter;
+   int   NRecv[MPI_NRank], Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank], NSend_Total, NRecv_Total;
    long *SendBuf=NULL, *RecvBuf=NULL;
 
 // 2.1 broadcast the number of elements sent to different ranks
@@ -81,10 +69,15 @@ void LB_ExchangeFlaggedBuffer( const int lv )
    SendBuf = new long [NSend_Total];
    RecvBuf = new long [NRecv_Total];
 
-   Counter = 0;
-   for (int r=0; r<MPI_NRank; r++)
-   for (int t=0; t<NSend[r]; t++)
-      SendBuf[ Counter ++ ] = Send_Temp[r][t];
+// fill the send buffer in the order of PID for each target rank
+   for (int r=0; r<MPI_NRank; r++)  Send_Offset[r] = Send_Disp[r];
+
+   for (int t=0; t<NSibBuf; t++)
+   {
+      TRank = TRank_List[t];
+
+      if ( TRank >= 0 )    SendBuf[ Send_Offset[TRank] ++ ] = amr->patch[0][lv][ amr->NPatchComma[lv][1] + t ]->LB_Idx;
+   }
 
 // 2.3 broadcast the send list
    MPI_Alltoallv( SendBuf, NSend, Send_Disp, MPI_LONG,
@@ -93,7 +86,6 @@ void LB_ExchangeFlaggedBuffer( const int lv )
 
 // 3. flag real patches according to the received flag results
 // ============================================================================================================
-   int  TPID;
    int *Match = new int [NRecv_Total];
 
 // 3.1 sort the received list
@@ -103,6 +95,7 @@ void LB_ExchangeFlaggedBuffer( const int lv )
    Mis_Matching_int( amr->NPatchComma[lv][1], amr->LB->IdxList_Real[lv], NRecv_Total, RecvBuf, Match );
 
 // 3.3 flag
+#  pragma omp parallel for schedule( static )
    for (int t=0; t<NRecv_Total; t++)
    {
 //    all target real patches must be found
@@ -111,15 +104,14 @@ void LB_ExchangeFlaggedBuffer( const int lv )
          Aux_Error( ERROR_INFO, "lv %d, LB_Idx %ld found no matching patches !!\n", lv, RecvBuf[t] );
 #     endif
 
-      TPID = amr->LB->IdxList_Real_IdxTable[lv][ Match[t] ];
+      const int TPID = amr->LB->IdxList_Real_IdxTable[lv][ Match[t] ];
 
       amr->patch[0][lv][TPID]->flag = true;
    }
 
 
 // free memory
-   for (int r=0; r<MPI_NRank; r++)  free( Send_Temp[r] );
-
+   delete [] TRank_List;
    delete [] SendBuf;
    delete [] RecvBuf;
    delete [] Match;
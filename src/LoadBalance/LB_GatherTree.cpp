@@ -13,6 +13,45 @@ Instructions for adding new patch_t members to GatherTree:
 */
 
 
+#ifdef LOAD_BALANCE
+// list of the remote patches referred to by local patches, whose GIDs are resolved by LB_ResolveRemoteGID()
+struct LB_RemoteGIDList
+{
+   long   NQuery;
+   long   NAlloc;
+   long  *LBIdx;  // LBIdx of the remote patches
+   int   *Lv;     // levels of the remote patches
+   int  **GID;    // pointers to the local exchange lists where the remote GIDs are stored
+
+   LB_RemoteGIDList() : NQuery(0), NAlloc(0), LBIdx(NULL), Lv(NULL), GID(NULL) {}
+   ~LB_RemoteGIDList() { free( LBIdx );  free( Lv );  free( GID ); }
+
+   void Add( const int TLv, const long TLBIdx, int *TGID )
+   {
+      if ( NQuery == NAlloc )
+      {
+         NAlloc = MAX( 2*NAlloc, 1024L );
+         LBIdx  = (long* )realloc( LBIdx, NAlloc*sizeof(long ) );
+         Lv     = (int*  )realloc( Lv,    NAlloc*sizeof(int  ) );
+         GID    = (int** )realloc( GID,   NAlloc*sizeof(int* ) );
+      }
+
+      LBIdx[NQuery] = TLBIdx;
+      Lv   [NQuery] = TLv;
+      GID  [NQuery] = TGID;
+      NQuery ++;
+   }
+}; // struct LB_RemoteGIDList
+
+static void LB_ResolveRemoteGID( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_RemoteGIDList& rgl );
+#else
+struct LB_RemoteGIDList;
+#endif
+
+static int LB_LBIdx2GID( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_RemoteGIDList *rgl,
+                         const int TLv, const long TLBIdx, int *TGID );
+
+
 
 LB_PatchCount::LB_PatchCount() : NPatchAllLv(0), NPatchLocalAllLv(0), isInitialised(false) {
 
@@ -55,8 +94,9 @@ LB_LocalPatchExchangeList::LB_LocalPatchExchangeList() : isInitialised(false), L
       NParList_Local         [lv] = new int    [ amr->NPatchComma[lv][1] ];
 #     endif
 
-      LBIdxList_Sort         [lv] = new long   [ NPatchTotal[lv] ];
-      LBIdxList_Sort_IdxTable[lv] = new int    [ NPatchTotal[lv] ];
+//    lists of all patches are allocated only when calling LB_AllgatherLBIdx()
+      LBIdxList_Sort         [lv] = NULL;
+      LBIdxList_Sort_IdxTable[lv] = NULL;
    }
 
 } // FUNCTION : LB_LocalPatchExchangeList
@@ -229,6 +269,9 @@ void LB_AllgatherPatchCount( LB_PatchCount& pc ) {
 // Description :  Collect and sort LBIdx from all ranks
 //
 // Note        :  - pc requires initialisation by calling LB_AllgatherPatchCount
+//                - Memory and communication scale with the total number of patches in all ranks
+//                  --> Not required by LB_FillLocalPatchExchangeList() in LOAD_BALANCE, which resolves the GIDs
+//                      of remote patches with LB_ResolveRemoteGID() instead
 //
 // Parameter   :  pc   : Reference to LB_PatchCount object
 //             :  lel  : Reference to LB_LocalPatchExchangeList
@@ -246,6 +289,12 @@ void LB_AllgatherLBIdx( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_Gl
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
+      if ( lel.LBIdxList_Sort[lv] == NULL )
+      {
+         lel.LBIdxList_Sort         [lv] = new long [ NPatchTotal[lv] ];
+         lel.LBIdxList_Sort_IdxTable[lv] = new int  [ NPatchTotal[lv] ];
+      }
+
       for (int r=0; r<MPI_NRank; r++)
       {
          RecvCount_LBIdx[r] = pc.NPatchAllRank[r][lv];
@@ -287,7 +336,12 @@ void LB_AllgatherLBIdx( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_Gl
 // Description :  Fill local exchange list by reading amr->patch structure on local MPI rank
 //
 // Note        :  - pc requires initialisation by calling LB_AllgatherPatchCount
-//                - lel requires initialisation by calling LB_AllgatherLBIdx
+//                - lel requires initialisation by calling LB_AllgatherLBIdx, except for LOAD_BALANCE
+//                - For LOAD_BALANCE without calling LB_AllgatherLBIdx, the GIDs of remote fathers, sons, and siblings
+//                  are resolved by LB_ResolveRemoteGID(), which only exchanges the LBIdx of these patches with
+//                  their home ranks
+//                  --> Memory scales with the number of local patches instead of all patches
+//                  --> Collective operation in MPI_COMM_WORLD
 //
 // Parameter   :  pc  : Reference to LB_PatchCount object
 //             :  lel : Reference to LB_LocalPatchExchangeList
@@ -297,22 +351,32 @@ void LB_FillLocalPatchExchangeList( LB_PatchCount& pc, LB_LocalPatchExchangeList
 #  ifdef GAMER_DEBUG
    if ( !pc.isInitialised )
       Aux_Error( ERROR_INFO, "call LB_FillLocalExchangeList without initialising LB_PatchCount object !!\n");
+#  ifndef LOAD_BALANCE
    if ( !lel.LBIdxisInitialised )
       Aux_Error( ERROR_INFO, "call LB_FillLocalExchangeList without initialising load balancing id lists object !!\n");
 #  endif
+#  endif
 
 // temporary variables
-   int   MyGID, FaPID, FaGID, FaLv, SonPID, SonGID, SonLv, SibPID, SibGID, MatchIdx;
+   int   MyGID, FaPID, FaGID, FaLv, SonPID, SonGID, SonLv, SibPID, SibGID;
    long  FaLBIdx, SonLBIdx, SibLBIdx;
    int  *SonCr=NULL, *SibCr=NULL;
 
+// remote patches to be resolved by LB_ResolveRemoteGID()
+#  ifdef LOAD_BALANCE
+   LB_RemoteGIDList  RemoteGIDList;
+   LB_RemoteGIDList *rgl = ( lel.LBIdxisInitialised ) ? NULL : &RemoteGIDList;
+#  else
+   LB_RemoteGIDList *rgl = NULL;
+#  endif
+
 // store the local tree
    for (int lv=0; lv<NLEVEL; lv++)
    {
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
       {
-//       1. LBIdx (set already)
-//       lel.LBIdxList_Local[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
+//       1. LBIdx (also set by LB_AllgatherLBIdx)
+         lel.LBIdxList_Local[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
 
 
 //       2. corner
@@ -354,16 +418,7 @@ void LB_FillLocalPatchExchangeList( LB_PatchCount& pc, LB_LocalPatchExchangeList
 #           endif // GAMER_DEBUG
 
             FaLBIdx = amr->patch[0][FaLv][FaPID]->LB_Idx;
-
-            Mis_Matching_int( NPatchTotal[FaLv], lel.LBIdxList_Sort[FaLv], 1, &FaLBIdx, &MatchIdx );
-
-#           ifdef GAMER_DEBUG
-            if ( MatchIdx < 0 )
-            Aux_Error( ERROR_INFO, "Lv %d, PID %d, FaPID %d, FaLBIdx %ld, couldn't find a matching patch !!\n",
-                       lv, PID, FaPID, FaLBIdx );
-#           endif
-
-            FaGID = lel.LBIdxList_Sort_IdxTable[FaLv][MatchIdx] + pc.GID_LvStart[FaLv];
+            FaGID   = LB_LBIdx2GID( pc, lel, rgl, FaLv, FaLBIdx, lel.FaList_Local[lv]+PID );
          } // if ( FaPID >= amr->NPatchComma[FaLv][1] )
 
          lel.FaList_Local[lv][PID] = FaGID;
@@ -407,15 +462,7 @@ void LB_FillLocalPatchExchangeList( LB_PatchCount& pc, LB_LocalPatchExchangeList
                        lv, PID, SonPID, SonCr[0], SonCr[1], SonCr[2], SonLBIdx, amr->patch[0][lv][PID]->LB_Idx );
 #           endif
 
-            Mis_Matching_int( NPatchTotal[SonLv], lel.LBIdxList_Sort[SonLv], 1, &SonLBIdx, &MatchIdx );
-
-#           ifdef GAMER_DEBUG
-            if ( MatchIdx < 0 )
-            Aux_Error( ERROR_INFO, "Lv %d, PID %d, SonPID %d, SonLBIdx %ld, couldn't find a matching patch !!\n",
-                       lv, PID, SonPID, SonLBIdx );
-#           endif
-
-            SonGID = lel.LBIdxList_Sort_IdxTable[SonLv][MatchIdx] + pc.GID_LvStart[SonLv];
+            SonGID = LB_LBIdx2GID( pc, lel, rgl, SonLv, SonLBIdx, lel.SonList_Local[lv]+PID );
          } // else if ( SonPID < -1 )
 
 //       son patch is a buffer patch (SonPID >= amr->NPatchComma[SonLv][1]) --> impossible
@@ -451,16 +498,7 @@ void LB_FillLocalPatchExchangeList( LB_PatchCount& pc, LB_LocalPatchExchangeList
 //             get the SibGID by "sibling corner -> sibling LB_Idx -> sibling GID"
                SibCr    = amr->patch[0][lv][SibPID]->corner;
                SibLBIdx = LB_Corner2Index( lv, SibCr, CHECK_OFF );   // periodicity has been assumed here
-
-               Mis_Matching_int( NPatchTotal[lv], lel.LBIdxList_Sort[lv], 1, &SibLBIdx, &MatchIdx );
-
-#              ifdef GAMER_DEBUG
-               if ( MatchIdx < 0 )
-               Aux_Error( ERROR_INFO, "Lv %d, PID %d, SibPID %d, SibLBIdx %ld, couldn't find a matching patch !!\n",
-                          lv, PID, SibPID, SibLBIdx );
-#              endif
-
-               SibGID = lel.LBIdxList_Sort_IdxTable[lv][MatchIdx] + pc.GID_LvStart[lv];
+               SibGID   = LB_LBIdx2GID( pc, lel, rgl, lv, SibLBIdx, lel.SibList_Local[lv][PID]+s );
             } // if ( SibPID >= amr->NPatchComma[lv][1] )
 
             lel.SibList_Local[lv][PID][s] = SibGID;
@@ -489,12 +527,194 @@ void LB_FillLocalPatchExchangeList( LB_PatchCount& pc, LB_LocalPatchExchangeList
       } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    } // for (int lv=0; lv<NLEVEL; lv++)
 
+// resolve the GIDs of remote patches
+#  ifdef LOAD_BALANCE
+   if ( rgl != NULL )   LB_ResolveRemoteGID( pc, lel, *rgl );
+#  endif
+
    lel.isInitialised = true;
 
 } // FUNCTION : LB_FillLocalPatchExchangeList
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_LBIdx2GID
+// Description :  Get the GID of a patch not stored as a real patch in this rank from its LBIdx
+//
+// Note        :  - Invoked by LB_FillLocalPatchExchangeList()
+//                - Look up the sorted LBIdx of all patches if rgl == NULL
+//                  --> lel requires initialisation by calling LB_AllgatherLBIdx
+//                - Otherwise record the patch in rgl, and its GID will be stored in TGID by LB_ResolveRemoteGID()
+//
+// Parameter   :  pc     : Reference to LB_PatchCount object
+//                lel    : Reference to LB_LocalPatchExchangeList
+//                rgl    : Pointer to LB_RemoteGIDList (NULL --> look up the sorted LBIdx of all patches)
+//                TLv    : Level of the target patch
+//                TLBIdx : LBIdx of the target patch
+//                TGID   : Pointer where the GID of the target patch will be stored by LB_ResolveRemoteGID()
+//
+// Return      :  GID of the target patch (-1 if it is resolved later by LB_ResolveRemoteGID())
+//-------------------------------------------------------------------------------------------------------
+int LB_LBIdx2GID( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_RemoteGIDList *rgl,
+                  const int TLv, const long TLBIdx, int *TGID )
+{
+
+#  ifdef LOAD_BALANCE
+   if ( rgl != NULL )
+   {
+      rgl->Add( TLv, TLBIdx, TGID );
+
+      return -1;
+   }
+#  endif
+
+   int MatchIdx;
+
+   Mis_Matching_int( NPatchTotal[TLv], lel.LBIdxList_Sort[TLv], 1, &TLBIdx, &MatchIdx );
+
+#  ifdef GAMER_DEBUG
+   if ( MatchIdx < 0 )
+      Aux_Error( ERROR_INFO, "Lv %d, LBIdx %ld, couldn't find a matching patch !!\n", TLv, TLBIdx );
+#  endif
+
+   return lel.LBIdxList_Sort_IdxTable[TLv][MatchIdx] + pc.GID_LvStart[TLv];
+
+} // FUNCTION : LB_LBIdx2GID
+
+
+
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_ResolveRemoteGID
+// Description :  Get the GIDs of the remote patches recorded in rgl from their home ranks
+//
+// Note        :  - Invoked by LB_FillLocalPatchExchangeList()
+//                - Home ranks are determined from the LB cut points by LB_Index2Rank()
+//                - Each home rank looks up the LBIdx of its own real patches, so memory and communication scale
+//                  with the number of local patches and remote references instead of all patches
+//                - Collective operation in MPI_COMM_WORLD
+//
+// Parameter   :  pc  : Reference to LB_PatchCount object
+//                lel : Reference to LB_LocalPatchExchangeList with LBIdxList_Local[] set
+//                rgl : Reference to LB_RemoteGIDList
+//
+// Return      :  GIDs pointed to by rgl.GID[]
+//-------------------------------------------------------------------------------------------------------
+void LB_ResolveRemoteGID( LB_PatchCount& pc, LB_LocalPatchExchangeList& lel, LB_RemoteGIDList& rgl )
+{
+
+   int  Send_NCount[MPI_NRank], Send_NDisp[MPI_NRank], Recv_NCount[MPI_NRank], Recv_NDisp[MPI_NRank];
+   int  Send_NCount2[MPI_NRank], Send_NDisp2[MPI_NRank], Recv_NCount2[MPI_NRank], Recv_NDisp2[MPI_NRank];
+   int  Counter[MPI_NRank];
+   int *HomeRank = new int [rgl.NQuery];
+
+
+// 1. prepare the send buffer of [level, LBIdx] sorted by the home ranks
+   for (int r=0; r<MPI_NRank; r++)  Send_NCount[r] = 0;
+
+   for (long q=0; q<rgl.NQuery; q++)
+   {
+      HomeRank[q] = LB_Index2Rank( rgl.Lv[q], rgl.LBIdx[q], CHECK_ON );
+      Send_NCount[ HomeRank[q] ] ++;
+   }
+
+   MPI_Alltoall( Send_NCount, 1, MPI_INT, Recv_NCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   Send_NDisp[0] = 0;
+   Recv_NDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      Send_NDisp[r] = Send_NDisp[r-1] + Send_NCount[r-1];
+      Recv_NDisp[r] = Recv_NDisp[r-1] + Recv_NCount[r-1];
+   }
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Counter     [r] = 0;
+      Send_NCount2[r] = 2*Send_NCount[r];
+      Send_NDisp2 [r] = 2*Send_NDisp [r];
+      Recv_NCount2[r] = 2*Recv_NCount[r];
+      Recv_NDisp2 [r] = 2*Recv_NDisp [r];
+   }
+
+   const int NSend = Send_NDisp[MPI_NRank-1] + Send_NCount[MPI_NRank-1];
+   const int NRecv = Recv_NDisp[MPI_NRank-1] + Recv_NCount[MPI_NRank-1];
+
+   long *SendBuf_Query  = new long [2*NSend];
+   long *RecvBuf_Query  = new long [2*NRecv];
+   int  *SendBuf_GID    = new int  [NRecv];
+   int  *RecvBuf_GID    = new int  [NSend];
+   int  *QueryIdx       = new int  [NSend];
+
+   for (long q=0; q<rgl.NQuery; q++)
+   {
+      const int t = Send_NDisp[ HomeRank[q] ] + Counter[ HomeRank[q] ] ++;
+
+      SendBuf_Query[ 2*t + 0 ] = rgl.Lv   [q];
+      SendBuf_Query[ 2*t + 1 ] = rgl.LBIdx[q];
+      QueryIdx     [ t       ] = q;
+   }
+
+   MPI_Alltoallv( SendBuf_Query, Send_NCount2, Send_NDisp2, MPI_LONG,
+                  RecvBuf_Query, Recv_NCount2, Recv_NDisp2, MPI_LONG, MPI_COMM_WORLD );
+
+
+// 2. look up the LBIdx of the local real patches
+   long *LBIdx_Sort[NLEVEL];
+   int  *LBIdx_IdxTable[NLEVEL];
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      LBIdx_Sort    [lv] = new long [ amr->NPatchComma[lv][1] ];
+      LBIdx_IdxTable[lv] = new int  [ amr->NPatchComma[lv][1] ];
+
+      memcpy( LBIdx_Sort[lv], lel.LBIdxList_Local[lv], amr->NPatchComma[lv][1]*sizeof(long) );
+
+      Mis_Heapsort( amr->NPatchComma[lv][1], LBIdx_Sort[lv], LBIdx_IdxTable[lv] );
+   }
+
+   for (int t=0; t<NRecv; t++)
+   {
+      const int  TLv    = (int)RecvBuf_Query[ 2*t + 0 ];
+      const long TLBIdx =      RecvBuf_Query[ 2*t + 1 ];
+      int MatchIdx;
+
+      Mis_Matching_int( amr->NPatchComma[TLv][1], LBIdx_Sort[TLv], 1, &TLBIdx, &MatchIdx );
+
+      if ( MatchIdx < 0 )
+         Aux_Error( ERROR_INFO, "Lv %d, LBIdx %ld, couldn't find a matching patch in rank %d !!\n", TLv, TLBIdx, MPI_Rank );
+
+      SendBuf_GID[t] = LBIdx_IdxTable[TLv][MatchIdx] + pc.GID_Offset[TLv];
+   }
+
+
+// 3. send the GIDs back
+   MPI_Alltoallv( SendBuf_GID, Recv_NCount, Recv_NDisp, MPI_INT,
+                  RecvBuf_GID, Send_NCount, Send_NDisp, MPI_INT, MPI_COMM_WORLD );
+
+   for (int t=0; t<NSend; t++)   *rgl.GID[ QueryIdx[t] ] = RecvBuf_GID[t];
+
+
+// 4. free memory
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] LBIdx_Sort    [lv];
+      delete [] LBIdx_IdxTable[lv];
+   }
+
+   delete [] HomeRank;
+   delete [] SendBuf_Query;
+   delete [] RecvBuf_Query;
+   delete [] SendBuf_GID;
+   delete [] RecvBuf_GID;
+   delete [] QueryIdx;
+
+} // FUNCTION : LB_ResolveRemoteGID
+#endif // #ifdef LOAD_BALANCE
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_FillGlobalPatchExchangeList
 // Description :  Fill global patch exchange lists by exchanging local patch list data between ranks
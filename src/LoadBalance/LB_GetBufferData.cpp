@@ -1099,7 +1099,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 
-// 4. transfer data by MPI_Alltoallv
+// 4. transfer data by MPI_Alltoallv or point-to-point communication (OPT__SPARSE_MPI_EXCHANGE)
 // ============================================================================================================
 #  ifdef TIMING
 // it's better to add barrier before timing transferring data through MPI
@@ -1111,8 +1111,14 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
 #  endif
 
-   MPI_Alltoallv_GAMER( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
-                        RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
+// each rank only exchanges data with its spatial neighbours
+// --> use point-to-point communication to avoid the global synchronization of MPI_Alltoallv
+   if ( OPT__SPARSE_MPI_EXCHANGE )
+      MPI_Alltoallv_Sparse( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
+                            RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL );
+   else
+      MPI_Alltoallv_GAMER ( SendBuf, Send_NCount, Send_NDisp, MPI_GAMER_REAL,
+                            RecvBuf, Recv_NCount, Recv_NDisp, MPI_GAMER_REAL, MPI_COMM_WORLD );
 
 #  ifdef TIMING
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
@@ -293,6 +293,11 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
    }
 
 
+// 8. compact the patch slabs since patches may have been reallocated or reordered
+   if ( OPT__PATCH_SLAB )
+   for (int lv=lv_min_mpi; lv<=lv_max_mpi; lv++)  amr->SlabCompact( lv );
+
+
    if ( MPI_Rank == 0 )
    {
       char lv_str[MAX_STRING];
@@ -316,6 +321,7 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
 //                3. Real patches with LB_Idx in the range "CutPoint[lv][r] <= LB_Idx < CutPoint[lv][r+1]"
 //                   will be sent to rank "r"
 //                4. Particles will be redistributed along with the leaf patches as well
+//                5. Measured workload of each patch (LB_Cost/LB_CostNew) is transferred only when OPT__LB_MEASURED_COST is on
 //
 // Parameter   :  lv                : Target refinement level
 //                ParAtt_Old        : Pointers pointing to the particle attribute arrays (amr->Par->Attribute[])
@@ -490,6 +496,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    real     *SendPtr         = NULL;
    real_par *SendPtr_Par     = NULL;
    long     *SendBuf_LBIdx   = new long [ NSend_Total_Patch ];
+   double   *SendBuf_Cost    = ( OPT__LB_MEASURED_COST ) ? new double [ NSend_Total_Patch*2 ] : NULL;
    real     *SendBuf_Flu     = ( SendGridData ) ? new real [ SendDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
 #  ifdef GRAVITY
    real     *SendBuf_Pot     = ( SendGridData ) ? new real [ SendDataSizeFlu1v ]             : NULL;
@@ -518,9 +525,15 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
       LB_Idx = amr->patch[0][lv][PID]->LB_Idx;
       TRank  = LB_Index2Rank( lv, LB_Idx, CHECK_ON );
 
-//    2.1 LB_Idx
+//    2.1 LB_Idx and measured workload (for OPT__LB_MEASURED_COST)
       SendBuf_LBIdx[ Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = LB_Idx;
 
+      if ( OPT__LB_MEASURED_COST )
+      {
+         SendBuf_Cost[                     Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = amr->patch[0][lv][PID]->LB_Cost;
+         SendBuf_Cost[ NSend_Total_Patch + Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = amr->patch[0][lv][PID]->LB_CostNew;
+      }
+
       if ( SendGridData )
       {
 //       2.2 fluid
@@ -602,6 +615,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 
 // allocate recv buffers AFTER deleting old patches
    long *RecvBuf_LBIdx   = new long [ NRecv_Total_Patch ];
+   double *RecvBuf_Cost  = ( OPT__LB_MEASURED_COST ) ? new double [ NRecv_Total_Patch*2 ] : NULL;
    real *RecvBuf_Flu     = ( SendGridData ) ? new real [ RecvDataSizeFlu1v*NCOMP_TOTAL ] : NULL;
 #  ifdef GRAVITY
    real *RecvBuf_Pot     = ( SendGridData ) ? new real [ RecvDataSizeFlu1v ]             : NULL;
@@ -620,10 +634,15 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
 
 // 4. transfer data by MPI_Alltoallv
 // ==========================================================================================
-// 4.1 LB_Idx
+// 4.1 LB_Idx and measured workload
    MPI_Alltoallv( SendBuf_LBIdx, Send_NCount_Patch, Send_NDisp_Patch, MPI_LONG,
                   RecvBuf_LBIdx, Recv_NCount_Patch, Recv_NDisp_Patch, MPI_LONG, MPI_COMM_WORLD );
 
+   if ( OPT__LB_MEASURED_COST )
+   for (int t=0; t<2; t++)    // LB_Cost and LB_CostNew
+   MPI_Alltoallv( SendBuf_Cost+t*NSend_Total_Patch, Send_NCount_Patch, Send_NDisp_Patch, MPI_DOUBLE,
+                  RecvBuf_Cost+t*NRecv_Total_Patch, Recv_NCount_Patch, Recv_NDisp_Patch, MPI_DOUBLE, MPI_COMM_WORLD );
+
    if ( SendGridData )
    {
 //    4.2 fluid (transfer one component at a time to avoid exceeding the maximum allowed transfer size in MPI)
@@ -677,6 +696,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    delete [] Send_NDisp_Flu1v;
    delete [] NDone_Patch;
    delete [] SendBuf_LBIdx;
+   delete [] SendBuf_Cost;
    delete [] SendBuf_Flu;
 #  ifdef GRAVITY
    delete [] SendBuf_Pot;
@@ -754,6 +774,13 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
       {
          PID = PID0 + LocalID;
 
+//       measured workload
+         if ( OPT__LB_MEASURED_COST )
+         {
+            amr->patch[0][lv][PID]->LB_Cost    = RecvBuf_Cost[                     PID ];
+            amr->patch[0][lv][PID]->LB_CostNew = RecvBuf_Cost[ NRecv_Total_Patch + PID ];
+         }
+
          if ( SendGridData )
          {
 //          fluid
@@ -851,6 +878,7 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAtt_Old, const bool R
    delete [] Recv_NCount_Flu1v;
    delete [] Recv_NDisp_Flu1v;
    delete [] RecvBuf_LBIdx;
+   delete [] RecvBuf_Cost;
    delete [] RecvBuf_Flu;
 #  ifdef GRAVITY
    delete [] RecvBuf_Pot;
@@ -0,0 +1,85 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+// weighting of the previous measurements when averaging the measured workload over root-level steps
+// --> LB_Cost = COST_SMOOTH*LB_Cost + (1-COST_SMOOTH)*LB_CostNew
+static const double COST_SMOOTH = 0.5;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_RecordMeasuredCost
+// Description :  Add the measured workload of the target patch groups to their patches
+//
+// Note        :  1. Invoked by InvokeSolver() and Par_UpdateParticle() when OPT__LB_MEASURED_COST is on
+//                2. Workload is distributed evenly to all patches in the target patch groups
+//                3. Patches created during the current root-level step (i.e., LB_CostNew < 0.0) are skipped
+//                   since their measurements are incomplete
+//                4. Not thread-safe for the same patch group
+//
+// Parameter   :  lv        : Target refinement level
+//                NPG       : Number of target patch groups
+//                PID0_List : List recording the patch indices with LocalID==0 of the target patch groups
+//                Cost      : Total wall-clock time spent on all target patch groups
+//-------------------------------------------------------------------------------------------------------
+void LB_RecordMeasuredCost( const int lv, const int NPG, const int *PID0_List, const double Cost )
+{
+
+   if ( NPG <= 0 )   return;
+
+   const double Cost_Patch = Cost / (8.0*NPG);
+
+   for (int t=0; t<NPG; t++)
+   for (int PID=PID0_List[t]; PID<PID0_List[t]+8; PID++)
+   {
+      if ( amr->patch[0][lv][PID]->LB_CostNew >= 0.0 )
+         amr->patch[0][lv][PID]->LB_CostNew += Cost_Patch;
+   }
+
+} // FUNCTION : LB_RecordMeasuredCost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_UpdateMeasuredCost
+// Description :  Fold the workload measured in the current root-level step into the average workload
+//                of all real patches
+//
+// Note        :  1. Invoked by main() after each root-level step when OPT__LB_MEASURED_COST is on
+//                   --> Must be called before LB_EstimateLoadImbalance()
+//                2. The workload of each patch is normalized to a single update at its level by dividing
+//                   by amr->NUpdateLv[lv] so that it is consistent with LB_EstimateWorkload_AllPatchGroup()
+//                3. Average over root-level steps by an exponential moving average with the weighting COST_SMOOTH
+//                4. Reset LB_CostNew of all real patches to zero for the next root-level step
+//-------------------------------------------------------------------------------------------------------
+void LB_UpdateMeasuredCost()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const double NUpdate = (double)MAX( amr->NUpdateLv[lv], 1L );
+
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         patch_t *Patch = amr->patch[0][lv][PID];
+
+         if ( Patch->LB_CostNew >= 0.0 )
+         {
+            const double Cost = Patch->LB_CostNew / NUpdate;
+
+            if ( Patch->LB_Cost < 0.0 )   Patch->LB_Cost = Cost;
+            else                          Patch->LB_Cost = COST_SMOOTH*Patch->LB_Cost + (1.0-COST_SMOOTH)*Cost;
+         }
+
+         Patch->LB_CostNew = 0.0;
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+} // FUNCTION : LB_UpdateMeasuredCost
+
+
+
+#endif // #ifdef LOAD_BALANCE
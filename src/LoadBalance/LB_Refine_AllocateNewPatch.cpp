@@ -10,10 +10,9 @@ void PrepareCData( const int FaLv, const int FaPID, real *const FaData,
                    const int FaSg_Mag, const int FaGhost_Mag,
                    const int BC_Face[], const int FluVarIdxList[] );
 void LB_Refine_AllocateBufferPatch_Sibling( const int SonLv );
-static int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, real *CData,
-                             const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
-                             const int BC_Face[], const int FluVarIdxList[],
-                             const real *CFB_BFieldEachRank[], const int CFB_SibRank[], long CFB_OffsetEachRank[] );
+static void AllocateSonPatch( const int FaLv, const int SonPID0, const int *Cr, const int PScale, const int FaPID, real *CData,
+                              const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
+                              const int BC_Face[], const int FluVarIdxList[], const real *Mag_FInterface_Ptr[] );
 static void DeallocateSonPatch( const int FaLv, const int FaPID, const int NNew_Real0, int NewSonPID0_Real[],
                                 int SwitchIdx, int &RefineS2F_Send_NPatchTotal, int *&RefineS2F_Send_PIDList );
 
@@ -37,6 +36,9 @@ static void DeallocateSonPatch( const int FaLv, const int FaPID, const int NNew_
 //                6. All MPI lists are NOT reconstructed here
 //                7. Several alternative functions are invoked here for better performance
 //                   (e.g., LB_AllocateBufferPatch_Sibling() --> LB_Refine_AllocateBufferPatch_Sibling())
+//                8. New real patches at SonLv are allocated and filled with data by multiple OpenMP threads
+//                   --> Their patch indices are reserved sequentially in advance so that the results do not
+//                       depend on the number of threads
 //
 // Parameter   :  FaLv                  : Target refinement level to be refined
 //                NNew_Home             : Number of home patches at FaLv to allocate son patches
@@ -278,7 +280,6 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    int *NewSonPID0_NoFa = new int [ NNew_Away ];         // NNew_Away is the maximum number this array can have
    int *NewSonPID0_All  = (int*)malloc( NNew_Real0*sizeof(int) );
    int *NewSonPID0_Real = NewSonPID0_All;
-   int *NewSonPID0_Away = NewSonPID0_All + NNew_Home;
 
 
 // parameters for spatial interpolation
@@ -343,67 +344,149 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    CFB_BFieldEachRank[r] = CFB_BFieldEachRank[r-1] + CFB_NSibEachRank[r-1]*SQR( PS2 );
 
    for (int r=0; r<MPI_NRank; r++)  CFB_OffsetEachRank[r] = 0;
-
-#  else
-   const real **CFB_BFieldEachRank = NULL;
-         long  *CFB_OffsetEachRank = NULL;
 #  endif
 
 
-// 3.1 home patches
-   for (int t=0; t<NNew_Home; t++)
-   {
-      FaPID    = NewPID_Home[t];
-      Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
-
-      NewSonPID0_All[t] = AllocateSonPatch( FaLv, Cr3D_Ptr, PScale, FaPID,
-                                            NULL,
-                                            CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                            BC_Face, FluVarIdxList,
-                                            CFB_BFieldEachRank, CFB_SibRank_Home[t], CFB_OffsetEachRank );
-   }
+// 3.1 reserve the patch indices of all new patch groups and construct relation : father -> child
+//     --> done sequentially for home patches first and then away patches, which gives the same patch indices
+//         as allocating one patch group at a time
+   const int NewSonPID0_Start = amr->preserve( SonLv, 8*NNew_Real0 );
 
+   int  *NewFaPID_All    = new int   [NNew_Real0];
+   int (*NewCr3D_All)[3] = new int   [NNew_Real0][3];
+   real **NewCData_All   = new real* [NNew_Real0];
+#  ifdef MHD
+   const real *(*Mag_FInterface_Ptr_All)[6] = new const real* [NNew_Real0][6];
+#  endif
 
-// 3.2 away patches
-   for (int t=0; t<NNew_Away; t++)
+   for (int t=0; t<NNew_Real0; t++)
    {
-//    3.2.1 away patches without father patch
-      if ( Match_New[t] == -1 )
+#     ifdef MHD
+      const int *CFB_SibRank = NULL;
+#     endif
+
+//    3.1.1 home patches
+      if ( t < NNew_Home )
+      {
+         FaPID    = NewPID_Home[t];
+         Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
+
+         NewCData_All[t] = NULL;
+#        ifdef MHD
+         CFB_SibRank     = CFB_SibRank_Home[t];
+#        endif
+      }
+
+//    3.1.2 away patches
+      else
       {
-         FaPID = -1;
-         Mis_Idx1D2Idx3D( BoxNScale_Padded, NewCr1D_Away[t], Cr3D );
-         for (int d=0; d<3; d++)    Cr3D[d] = ( Cr3D[d] - Padded )*PS1;
+         const int ta = t - NNew_Home;
 
-         NewSonPID0_Away[t] = AllocateSonPatch( FaLv, Cr3D, PScale, FaPID,
-                                                NewCData_Away+NewCr1D_Away_IdxTable[t]*CSize_Tot,
-                                                CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                                NULL, NULL,
-                                                CFB_BFieldEachRank, CFB_SibRank_Away[t], CFB_OffsetEachRank );
+//       away patches without father patch
+         if ( Match_New[ta] == -1 )
+         {
+            FaPID = -1;
+            Mis_Idx1D2Idx3D( BoxNScale_Padded, NewCr1D_Away[ta], Cr3D );
+            for (int d=0; d<3; d++)    Cr3D[d] = ( Cr3D[d] - Padded )*PS1;
+            Cr3D_Ptr = Cr3D;
 
-//       record the SonPID (with LocalID == 0 ) with no father at home
-#        ifdef GAMER_DEBUG
-         if ( NNoFa >= NNew_Away )
-            Aux_Error( ERROR_INFO, "FaLv %d, NNoFa (%d) exceeds the maximum number (%d) !!\n",
-                       FaLv, NNoFa, NNew_Away );
+//          record the SonPID (with LocalID == 0 ) with no father at home
+#           ifdef GAMER_DEBUG
+            if ( NNoFa >= NNew_Away )
+               Aux_Error( ERROR_INFO, "FaLv %d, NNoFa (%d) exceeds the maximum number (%d) !!\n",
+                          FaLv, NNoFa, NNew_Away );
+#           endif
+
+            NewSonPID0_NoFa[ NNoFa ++ ] = NewSonPID0_Start + 8*t;
+         }
+
+//       away patches with father patch
+         else
+         {
+            FaPID    = amr->LB->PaddedCr1DList_IdxTable[FaLv][ Match_New[ta] ];
+            Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
+         }
+
+         NewCData_All[t] = NewCData_Away + NewCr1D_Away_IdxTable[ta]*CSize_Tot;
+#        ifdef MHD
+         CFB_SibRank     = CFB_SibRank_Away[ta];
 #        endif
+      } // if ( t < NNew_Home ) ... else ...
+
+      SonPID0         = NewSonPID0_Start + 8*t;
+      NewFaPID_All[t] = FaPID;
+      for (int d=0; d<3; d++)    NewCr3D_All[t][d] = Cr3D_Ptr[d];
+      NewSonPID0_All[t] = SonPID0;
 
-         NewSonPID0_NoFa[ NNoFa ++ ] = NewSonPID0_Away[t];
-      } // if ( Match_New[t] == -1 )
+//    3.1.3 check : target father patch has no son
+#     ifdef GAMER_DEBUG
+      if ( FaPID != -1  &&  amr->patch[0][FaLv][FaPID]->son != -1 )
+         Aux_Error( ERROR_INFO, "FaLv %d, FaPID (%d) already has sons (SonPID = %d, duplicate SonPID = %d) !!\n",
+                    FaLv, FaPID, amr->patch[0][FaLv][FaPID]->son, SonPID0 );
+#     endif
 
+//    3.1.4 construct relation : father -> child
+      if ( FaPID != -1 )   amr->patch[0][FaLv][FaPID]->son = SonPID0;
 
-//    3.2.2 away patches with father patch
-      else
+//    3.1.5 set the B field on the coarse-fine interfaces
+//          --> CFB_OffsetEachRank[] must be accumulated in the same order as CFB_BField[]
+#     ifdef MHD
+      for (int s=0; s<6; s++)
       {
-         FaPID    = amr->LB->PaddedCr1DList_IdxTable[FaLv][ Match_New[t] ];
-         Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
+         const int TRank = CFB_SibRank[s];
+
+//       we set TRank>=0 on the coarse-fine interfaces
+         if ( TRank >= 0 )
+         {
+            Mag_FInterface_Ptr_All[t][s] = CFB_BFieldEachRank[TRank] + CFB_OffsetEachRank[TRank];
+
+            CFB_OffsetEachRank[TRank] += SQR( PS2 );
+         }
+
+         else
+            Mag_FInterface_Ptr_All[t][s] = NULL;
+      }
+#     endif
+   } // for (int t=0; t<NNew_Real0; t++)
+
+   amr->NPatchComma[SonLv][1] += 8*NNew_Real0;
+
+
+// 3.2 allocate all new patch groups and assign data to them by spatial interpolation
+//     --> different patch groups are independent of each other and can thus be processed in parallel
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<NNew_Real0; t++)
+   {
+#     ifdef MHD
+      const real **Mag_FInterface_Ptr = Mag_FInterface_Ptr_All[t];
+#     else
+      const real **Mag_FInterface_Ptr = NULL;
+#     endif
 
-         NewSonPID0_Away[t] = AllocateSonPatch( FaLv, Cr3D_Ptr, PScale, FaPID,
-                                                NewCData_Away+NewCr1D_Away_IdxTable[t]*CSize_Tot,
-                                                CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                                NULL, NULL,
-                                                CFB_BFieldEachRank, CFB_SibRank_Away[t], CFB_OffsetEachRank );
-      } // if ( Match_New[t] == -1 ) ... else ...
-   } // for (int t=0; t<NNew_Away; t++)
+      AllocateSonPatch( FaLv, NewSonPID0_All[t], NewCr3D_All[t], PScale, NewFaPID_All[t], NewCData_All[t],
+                        CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
+                        BC_Face, FluVarIdxList, Mag_FInterface_Ptr );
+   }
+
+
+// 3.3 pass particles from father to son if they are in the same rank
+//     --> otherwise these particles will be transferred to the real son patches by calling
+//         Par_PassParticle2Son_MultiPatch() in LB_Refine()
+#  ifdef PARTICLE
+   for (int t=0; t<NNew_Real0; t++)
+   {
+      FaPID = NewFaPID_All[t];
+
+      if ( FaPID >= 0  &&  FaPID < amr->NPatchComma[FaLv][1] )    Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
+   }
+#  endif
+
+   delete [] NewFaPID_All;
+   delete [] NewCr3D_All;
+   delete [] NewCData_All;
+#  ifdef MHD
+   delete [] Mag_FInterface_Ptr_All;
+#  endif
 
 
 
@@ -686,9 +769,14 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 // Function    :  AllocateSonPatch
 // Description :  Allocate eight son patches at FaLv+1
 //
-// Note        :  Just to avoid duplicate code segment
+// Note        :  1. Just to avoid duplicate code segment
+//                2. Patch indices must be reserved by amr->preserve() in advance
+//                   --> Relation father -> child must also be constructed in advance
+//                3. Thread-safe for different patch groups
+//                   --> Particles must be passed from father to son after invoking this function
 //
 // Parameter   :  FaLv          : Target refinement level to be refined
+//                SonPID0       : Reserved patch index of the son patch with LocalID == 0
 //                Cr            : Corner coordinates of the son patch with LocalID == 0
 //                PScale        : Scale of one patch at SonLv
 //                FaPID         : Father patch index (can be -1 for the away patches)
@@ -703,46 +791,35 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 //                FluVarIdxList : List of target fluid variable indices                          -> for non-periodic B.C. only
 //
 //                MHD-only parameters
-//                CFB_BFieldEachRank : Coarse-fine interface B field array
-//                CFB_SibRank        : MPI ranks of the target sibling patches
-//                CFB_OffsetEachRank : Array offset of CFB_BFieldEachRank[] for each rank
-//
-// Return      :  SonPID with LocalID == 0, CFB_OffsetEachRank
+//                Mag_FInterface_Ptr : Fine-grid B field on the six coarse-fine interfaces (NULL if not a
+//                                     coarse-fine interface)
 //-------------------------------------------------------------------------------------------------------
-int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, real *CData,
-                      const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
-                      const int BC_Face[], const int FluVarIdxList[],
-                      const real *CFB_BFieldEachRank[], const int CFB_SibRank[], long CFB_OffsetEachRank[] )
+void AllocateSonPatch( const int FaLv, const int SonPID0, const int *Cr, const int PScale, const int FaPID, real *CData,
+                       const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
+                       const int BC_Face[], const int FluVarIdxList[], const real *Mag_FInterface_Ptr[] )
 {
 
    const int SonLv   = FaLv + 1;
-   const int SonPID0 = amr->num[SonLv];
    bool FaIsHome     = false;
 
 
-// 0. check : target father patch has no son
+// 1. check : relation father -> child must be constructed already
 #  ifdef GAMER_DEBUG
-   if ( FaPID != -1  &&  amr->patch[0][FaLv][FaPID]->son != -1 )
-      Aux_Error( ERROR_INFO, "FaLv %d, FaPID (%d) already has sons (SonPID = %d, duplicate SonPID = %d) !!\n",
+   if ( FaPID != -1  &&  amr->patch[0][FaLv][FaPID]->son != SonPID0 )
+      Aux_Error( ERROR_INFO, "FaLv %d, FaPID (%d) has incorrect sons (SonPID = %d, reserved SonPID = %d) !!\n",
                  FaLv, FaPID, amr->patch[0][FaLv][FaPID]->son, SonPID0 );
 #  endif
 
 
-// 1. construct relation : father -> child
-   if ( FaPID != -1 )   amr->patch[0][FaLv][FaPID]->son = SonPID0;
-
-
 // 2. allocate child patches and construct relation : child -> father
-   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
-
-   amr->NPatchComma[SonLv][1] += 8;
+   amr->pnew_reserved( SonLv, SonPID0+0, Cr[0],        Cr[1],        Cr[2],        FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+1, Cr[0]+PScale, Cr[1],        Cr[2],        FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+2, Cr[0],        Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+3, Cr[0],        Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+4, Cr[0]+PScale, Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+5, Cr[0],        Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+6, Cr[0]+PScale, Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
+   amr->pnew_reserved( SonLv, SonPID0+7, Cr[0]+PScale, Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
 
 
 // 3. assign data to child patches by spatial interpolation
@@ -857,22 +934,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    const real *CData_Mag3v[NCOMP_MAG] = { CData_MagX, CData_MagY, CData_MagZ };
          real *FData_Mag3v[NCOMP_MAG] = { FData_Mag[MAGX], FData_Mag[MAGY], FData_Mag[MAGZ] };
 
-// set the B field on the coarse-fine interfaces
-   const real *Mag_FInterface_Ptr[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-
-   for (int s=0; s<6; s++)
-   {
-      const int TRank = CFB_SibRank[s];
-
-//    we set TRank>=0 on the coarse-fine interfaces
-      if ( TRank >= 0 )
-      {
-         Mag_FInterface_Ptr[s] = CFB_BFieldEachRank[TRank] + CFB_OffsetEachRank[TRank];
-
-         CFB_OffsetEachRank[TRank] += SQR( PS2 );
-      }
-   }
-
 // perform divergence-free interpolation
    MHD_InterpolateBField( CData_Mag3v, CSize_Mag, CStart_Mag, CRange_Mag,
                           FData_Mag3v, FSize_Mag, FStart_Mag, Mag_FInterface_Ptr,
@@ -1155,14 +1216,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    } // for (int LocalID=0; LocalID<8; LocalID++)
 
 
-// 4. pass particles from father to son if they are in the same rank
-//    --> otherwise these particles will be transferred to the real son patches by calling
-//        Par_PassParticle2Son_MultiPatch() in LB_Refine()
-#  ifdef PARTICLE
-   if ( FaPID >= 0  &&  FaPID < amr->NPatchComma[FaLv][1] )    Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
-#  endif
-
-
 // free memory
    if ( FaIsHome )   delete [] CData;
    delete [] FData_Flu;
@@ -1174,9 +1227,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    delete [] FData_Mag_CC_IntIter;
 #  endif
 
-
-   return SonPID0;
-
 } // FUNCTION : AllocateSonPatch
 
 
@@ -3,6 +3,11 @@
 #ifdef LOAD_BALANCE
 
 
+static void GetLoadBelow( const int NKey, const long *Key, double *LoadBelow, const int NPG, const long *LBIdx0,
+                          const double *LoadAcc );
+static int  CountLBIdx0( const int NPG, const long *LBIdx0, const long Key );
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -17,6 +22,15 @@
 //                   particle information yet ...)
 //                   --> See the description of "InputLBIdx0AndLoad, LBIdx0_AllRank_Input, and
 //                       Load_AllRank_Input" below
+//                4. Cut points are computed in parallel without collecting all patch groups to a single rank
+//                   --> Each rank sorts its own patch groups by LB_Idx and accumulates their workload
+//                   --> For each cut point, find the patch group where the global accumulated workload reaches
+//                       the target workload by a bisection search in LB_Idx, where each iteration only requires
+//                       an MPI_Allreduce() of MPI_NRank-1 values
+//                   --> Each cut point is then set to the patch-group boundary with an accumulated workload
+//                       closest to the target workload
+//                   --> Patch groups in different ranks do not need to have disjoint LB_Idx ranges
+//                5. Must be invoked by all ranks
 //
 // Parameter   :  lv                   : Target refinement level
 //                NPG_Total            : Total number of patch groups on level "lv"
@@ -56,53 +70,35 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
       Aux_Error( ERROR_INFO, "NPG_Total (%d) < 0 !!\n", NPG_Total );
 
 
-// 1. collect the load-balance weighting and LB_Idx of all patch groups from all ranks
-   long   *LBIdx0_AllRank = NULL;
-   double *Load_AllRank   = NULL;
-   int    *IdxTable       = ( MPI_Rank == 0 ) ? new int [NPG_Total] : NULL;
+// 1. get the load-balance weighting and LB_Idx of all patch groups in this rank
+   int     NPG_ThisRank;
+   long   *LBIdx0_ThisRank = NULL;
+   double *Load_ThisRank   = NULL;
 
 // use the input tables directly
 // --> useful during RESTART, where we have very limited information
 //     (e.g., we don't know the number of patches in each rank, amr->NPatchComma, and any particle information yet ...)
+// --> copy them since they will be sorted below
    if ( InputLBIdx0AndLoad )
    {
-      if ( MPI_Rank == 0 )
+      NPG_ThisRank    = ( MPI_Rank == 0 ) ? NPG_Total : 0;
+      LBIdx0_ThisRank = new long   [NPG_ThisRank];
+      Load_ThisRank   = new double [NPG_ThisRank];
+
+      if ( NPG_ThisRank > 0 )
       {
-         LBIdx0_AllRank = LBIdx0_AllRank_Input;
-         Load_AllRank   = Load_AllRank_Input;
+         memcpy( LBIdx0_ThisRank, LBIdx0_AllRank_Input, NPG_ThisRank*sizeof(long)   );
+         memcpy( Load_ThisRank,   Load_AllRank_Input,   NPG_ThisRank*sizeof(double) );
       }
    }
 
    else
    {
-//    allocate memory
-      int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
-
-      long   *LBIdx0_ThisRank = new long   [ NPG_ThisRank ];
-      double *Load_ThisRank   = new double [ NPG_ThisRank ];
-      int    *NPG_EachRank    = NULL;
-      int    *Recv_Disp       = NULL;
-
-      if ( MPI_Rank == 0 )
-      {
-         NPG_EachRank   = new int    [ MPI_NRank ];
-         Recv_Disp      = new int    [ MPI_NRank ];
-         LBIdx0_AllRank = new long   [ NPG_Total ];
-         Load_AllRank   = new double [ NPG_Total ];
-      }
-
-
-//    collect the number of patch groups in each rank
-      MPI_Gather( &NPG_ThisRank, 1, MPI_INT, NPG_EachRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
-
-      if ( MPI_Rank == 0 )
-      {
-         Recv_Disp[0] = 0;
-         for (int r=0; r<MPI_NRank-1; r++)   Recv_Disp[r+1] = Recv_Disp[r] + NPG_EachRank[r];
-      }
+      NPG_ThisRank    = amr->NPatchComma[lv][1] / 8;
+      LBIdx0_ThisRank = new long   [NPG_ThisRank];
+      Load_ThisRank   = new double [NPG_ThisRank];
 
-
-//    collect the minimum LBIdx in each patch group
+//    get the minimum LBIdx in each patch group
 //    --> assuming patches within the same patch group have consecutive LBIdx
       for (int t=0; t<NPG_ThisRank; t++)
       {
@@ -112,182 +108,213 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
          LBIdx0_ThisRank[t] -= LBIdx0_ThisRank[t] % 8;         // get the **minimum** LBIdx in this patch group
       }
 
-      MPI_Gatherv( LBIdx0_ThisRank, NPG_ThisRank, MPI_LONG, LBIdx0_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_LONG, 0, MPI_COMM_WORLD );
+//    get the load-balance weighting in each patch group
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+   } // if ( InputLBIdx0AndLoad ) ... else ...
+
+#  ifdef GAMER_DEBUG
+   int NPG_Sum;
+   MPI_Allreduce( &NPG_ThisRank, &NPG_Sum, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
 
+   if ( NPG_Sum != NPG_Total )
+      Aux_Error( ERROR_INFO, "lv %d, sum of the number of patch groups in all ranks (%d) != NPG_Total (%d) !!\n",
+                 lv, NPG_Sum, NPG_Total );
+#  endif
 
-//    collect the load-balance weighting in each patch group
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
 
-      MPI_Gatherv( Load_ThisRank, NPG_ThisRank, MPI_DOUBLE, Load_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_DOUBLE, 0, MPI_COMM_WORLD );
+// 2. sort LB_Idx in this rank and accumulate the workload in the sorted order
+//    --> LoadAcc[t] = total workload of the first t patch groups after sorting
+   int    *IdxTable = new int    [NPG_ThisRank];
+   double *LoadAcc  = new double [NPG_ThisRank+1];
 
+   if ( NPG_ThisRank > 0 )    Mis_Heapsort( NPG_ThisRank, LBIdx0_ThisRank, IdxTable );
 
-//    free memory
-      delete [] LBIdx0_ThisRank;
-      delete [] Load_ThisRank;
+   LoadAcc[0] = 0.0;
+   for (int t=0; t<NPG_ThisRank; t++)  LoadAcc[t+1] = LoadAcc[t] + Load_ThisRank[ IdxTable[t] ];
 
-      if ( MPI_Rank == 0 )
+
+// 3. get the range of LB_Idx and the total workload of all ranks
+   const long LBIdx0_Min_ThisRank = ( NPG_ThisRank > 0 ) ? LBIdx0_ThisRank[             0  ] : __LONG_MAX__;
+   const long LBIdx0_Max_ThisRank = ( NPG_ThisRank > 0 ) ? LBIdx0_ThisRank[ NPG_ThisRank-1 ] : -1L;
+   long   LBIdx0_Min, LBIdx0_Max;
+   double Load_Total, Load_Ave;
+
+   MPI_Allreduce( &LBIdx0_Min_ThisRank,    &LBIdx0_Min, 1, MPI_LONG,   MPI_MIN, MPI_COMM_WORLD );
+   MPI_Allreduce( &LBIdx0_Max_ThisRank,    &LBIdx0_Max, 1, MPI_LONG,   MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( &LoadAcc[NPG_ThisRank],  &Load_Total, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+
+// 4. set the cut points
+   for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+
+// 4-1. take care of the case with no patches at all
+   if ( NPG_Total == 0 )
+   {
+      Load_Ave = 0.0;
+   }
+
+   else
+   {
+//    4-2. get the average workload for each rank
+      Load_Ave = Load_Total / (double)MPI_NRank;
+
+//    4-3. set the min and max cut points
+      CutPoint[        0] = LBIdx0_Min;
+      CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+
+//    4-4. for each cut point CutPoint[c+1], find the patch group where the accumulated workload reaches
+//         the target workload (c+1)*Load_Ave
+//         --> i.e., the minimum LBIdx0 "Key" with "workload of all patch groups with LBIdx0 <= Key" >= target
+//         --> bisection search in the range Key_L < Key <= Key_R for all cut points simultaneously
+//         --> use the same number of iterations in all ranks to avoid deadlock
+      const int NCut       = MPI_NRank - 1;
+      long     *Key_L      = new long   [NCut];
+      long     *Key_R      = new long   [NCut];
+      long     *Key_Query  = new long   [ 2*NCut ];
+      double   *Load_Query = new double [ 2*NCut ];
+      double   *Load_Sum   = new double [ 2*NCut ];
+      int       NIter      = 0;
+
+      for (long Width=LBIdx0_Max-LBIdx0_Min+1; Width>1; Width=(Width+1)/2)    NIter ++;
+
+      for (int c=0; c<NCut; c++)
       {
-         delete [] NPG_EachRank;
-         delete [] Recv_Disp;
+         Key_L[c] = LBIdx0_Min - 1;
+         Key_R[c] = LBIdx0_Max;
       }
-   } // if ( InputLBIdx0AndLoad ) ... else ...
 
+      for (int n=0; n<NIter; n++)
+      {
+         for (int c=0; c<NCut; c++)
+            Key_Query[c] = Key_L[c] + ( Key_R[c] - Key_L[c] )/2 + 1;   // +1 since we want to include LBIdx0 == Key
 
-   if ( MPI_Rank == 0 )
-   {
-      double *Load_Record = ( OPT__VERBOSE ) ? new double [MPI_NRank] : NULL;
-      double  Load_Ave;
+         GetLoadBelow( NCut, Key_Query, Load_Query, NPG_ThisRank, LBIdx0_ThisRank, LoadAcc );
 
-//    3. sort LB_Idx
-//    --> after sorting, we must use IdxTable to access the Load_AllRank[] array
-      Mis_Heapsort( NPG_Total, LBIdx0_AllRank, IdxTable );
+         MPI_Allreduce( Load_Query, Load_Sum, NCut, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
 
+         for (int c=0; c<NCut; c++)
+         {
+            if ( Key_R[c] - Key_L[c] <= 1 )        continue;
 
-//    4. set the cut points
-      for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+            if ( Load_Sum[c] >= (c+1)*Load_Ave )   Key_R[c] = Key_Query[c] - 1;
+            else                                   Key_L[c] = Key_Query[c] - 1;
+         }
+      } // for (int n=0; n<NIter; n++)
 
-//    4-1. take care of the case with no patches at all
-      if ( NPG_Total == 0 )
+//    4-5. determine the cut point with an accumulated workload **closest** to the target accumulated workload
+//         --> (a) exclude the patch group Key_R[c] from the rank "c" if adding it will exceed the target too much
+//             (b) otherwise include it and set the cut point to the next patch group
+//         --> note that the next patch group may be in another rank
+      long *Key_Next_ThisRank = new long [NCut];
+      long *Key_Next          = new long [NCut];
+
+      for (int c=0; c<NCut; c++)
       {
-         Load_Ave = 0.0;
+         Key_Query[ 2*c + 0 ] = Key_R[c];       // workload excluding the patch group Key_R[c]
+         Key_Query[ 2*c + 1 ] = Key_R[c] + 1;   // workload including the patch group Key_R[c]
 
-         if ( OPT__VERBOSE )
-            for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = 0.0;
+         const int Idx = CountLBIdx0( NPG_ThisRank, LBIdx0_ThisRank, Key_R[c]+1 );
+         Key_Next_ThisRank[c] = ( Idx < NPG_ThisRank ) ? LBIdx0_ThisRank[Idx] : __LONG_MAX__;
       }
 
-      else
+      GetLoadBelow( 2*NCut, Key_Query, Load_Query, NPG_ThisRank, LBIdx0_ThisRank, LoadAcc );
+
+      MPI_Allreduce( Load_Query,        Load_Sum, 2*NCut, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+      MPI_Allreduce( Key_Next_ThisRank, Key_Next,   NCut, MPI_LONG,   MPI_MIN, MPI_COMM_WORLD );
+
+      for (int c=0; c<NCut; c++)
       {
-//       4-2. get the average workload for each rank
-         Load_Ave = 0.0;
-         for (int t=0; t<NPG_Total; t++)  Load_Ave += Load_AllRank[t];
-         Load_Ave /= (double)MPI_NRank;
-
-//       4-3. set the min and max cut points
-         const long LBIdx0_Min = LBIdx0_AllRank[             0 ];
-         const long LBIdx0_Max = LBIdx0_AllRank[ NPG_Total - 1 ];
-         CutPoint[        0] = LBIdx0_Min;
-         CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
-
-//       4-4. find the LBIdx with an accumulated workload (LoadAcc) closest to the average workload of each rank (LoadTarget)
-         int    CutIdx     = 1;                 // target array index for CutPoint[]
-                                                // --> note that CutPoint[CutIdx] is the **exclusive** upper bound of rank "CutIdx-1"
-         double LoadAcc    = 0.0;               // accumulated workload
-         double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
-         double LoadThisPG;                     // workload of the target patch group
-
-         for (int PG=0; PG<NPG_Total; PG++)
-         {
-//          nothing to do if all cut points have been set already
-            if ( CutIdx == MPI_NRank )    break;
-
-//          remember to use IdxTable to access Load_AllRank
-            LoadThisPG = Load_AllRank[ IdxTable[PG] ];
-
-//          check if adding a new patch group will exceed the target accumulated workload
-            if ( LoadAcc+LoadThisPG >= LoadTarget )
-            {
-//             determine the cut point with an accumulated workload **closest** to the target accumulated workload
-//             (a) if adding a new patch group will exceed the target accumulated workload too much
-//                 --> exclude this patch group from the rank "CutIdx-1"
-//             note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
-               if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
-               {
-                  CutPoint[CutIdx] = LBIdx0_AllRank[PG];
-
-                  PG --;   // because this patch group has been **excluded** from this cut point
-               }
-
-//             (b) if adding a new patch group will NOT exceed the target accumulated workload too much
-//                 --> include this patch group in the rank "CutIdx-1"
-               else
-               {
-//                be careful about the special case "PG == NPG_Total-1"
-                  CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
-
-                  LoadAcc += LoadThisPG;
-               }
-
-//             record the **accumulated** workload of each rank
-               if ( OPT__VERBOSE )  Load_Record[ CutIdx - 1 ] = LoadAcc;
-
-               CutIdx ++;
-               LoadTarget = CutIdx*Load_Ave;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget )
-
-            else
-            {
-               LoadAcc += LoadThisPG;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
-
-         } // for (int PG=0; PG<NPG_Total; PG++)
-
-//       4.5 take care of the special case where the last several ranks have no patches at all
-         for (int t=CutIdx; t<MPI_NRank; t++)
-         {
-            CutPoint[t] = CutPoint[MPI_NRank];
+         const double LoadTarget = (c+1)*Load_Ave;
+         const double LoadExcl   = Load_Sum[ 2*c + 0 ];
+         const double LoadIncl   = Load_Sum[ 2*c + 1 ];
+
+         if ( fabs(LoadExcl-LoadTarget) < LoadIncl-LoadTarget )
+            CutPoint[c+1] = Key_R[c];
+         else
+            CutPoint[c+1] = ( Key_Next[c] == __LONG_MAX__ ) ? CutPoint[MPI_NRank] : Key_Next[c];
+      }
 
-            if ( OPT__VERBOSE )  Load_Record[ t - 1 ] = Load_Ave*MPI_NRank;
-         }
+//    4-6. ensure monotonicity since a single patch group can cover the target workload of several ranks
+//         --> ranks in between will have no patches at all
+      for (int t=1; t<MPI_NRank+1; t++)   CutPoint[t] = MAX( CutPoint[t], CutPoint[t-1] );
+
+      delete [] Key_L;
+      delete [] Key_R;
+      delete [] Key_Query;
+      delete [] Load_Query;
+      delete [] Load_Sum;
+      delete [] Key_Next_ThisRank;
+      delete [] Key_Next;
+
+//    4-7. check
+#     ifdef GAMER_DEBUG
+//    all cut points must be set properly
+      for (int t=0; t<MPI_NRank+1; t++)
+         if ( CutPoint[t] == -1 )
+            Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] == -1 !!\n", lv, t );
+
+//    monotonicity
+      for (int t=0; t<MPI_NRank; t++)
+         if ( CutPoint[t+1] < CutPoint[t] )
+            Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                       lv, t+1, CutPoint[t+1], t, CutPoint[t] );
+#     endif
+   } // if ( NPG_Total == 0 ) ... else ...
+
+
+// 5. broadcast the cut points to ensure that all ranks adopt exactly the same values
+   MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
 
-//       4.6 check
-#        ifdef GAMER_DEBUG
-//       all cut points must be set properly
-         for (int t=0; t<MPI_NRank+1; t++)
-            if ( CutPoint[t] == -1 )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] == -1 !!\n", lv, t );
 
-//       monotonicity
-         for (int t=0; t<MPI_NRank; t++)
-            if ( CutPoint[t+1] < CutPoint[t] )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
-                          lv, t+1, CutPoint[t+1], t, CutPoint[t] );
-#        endif
-      } // if ( NPG_Total == 0 ) ... else ...
+// 6. output the cut points and workload of each MPI rank
+   if ( OPT__VERBOSE )
+   {
+      double *Load_Record = new double [MPI_NRank+1];
 
+      if ( NPG_Total == 0 )
+      {
+         for (int r=0; r<MPI_NRank+1; r++)   Load_Record[r] = 0.0;
+      }
 
-//    5. output the cut points and workload of each MPI rank
-      if ( OPT__VERBOSE )
+      else
       {
-//       convert the accumulated workload to the actual workload of each rank
-         Load_Record[ MPI_NRank - 1 ] = Load_Ave*MPI_NRank;
-         for (int r=MPI_NRank-1; r>=1; r--)  Load_Record[r] -= Load_Record[r-1];
+         double *Load_Query = new double [MPI_NRank+1];
+
+         GetLoadBelow( MPI_NRank+1, CutPoint, Load_Query, NPG_ThisRank, LBIdx0_ThisRank, LoadAcc );
+
+         MPI_Reduce( Load_Query, Load_Record, MPI_NRank+1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
+         delete [] Load_Query;
+      }
+
+      if ( MPI_Rank == 0 )
+      {
          double Load_Max = -1.0;
 
          for (int r=0; r<MPI_NRank; r++)
          {
+            const double Load_Rank = Load_Record[r+1] - Load_Record[r];
+
             Aux_Message( stdout, "         Lv %2d: Rank %4d, Cut %15ld -> %15ld, Load_Weighted %9.3e\n",
-                         lv, r, CutPoint[r], CutPoint[r+1], Load_Record[r] );
+                         lv, r, CutPoint[r], CutPoint[r+1], Load_Rank );
 
-            if ( Load_Record[r] > Load_Max )    Load_Max = Load_Record[r];
+            if ( Load_Rank > Load_Max )   Load_Max = Load_Rank;
          }
 
          Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
                       Load_Ave, Load_Max, (NPG_Total == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
          Aux_Message( stdout, "         =============================================================================\n" );
-
-         delete [] Load_Record;
       }
-   } // if ( MPI_Rank == 0 )
 
-
-// 6. broadcast the cut points
-   MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
+      delete [] Load_Record;
+   } // if ( OPT__VERBOSE )
 
 
 // free memory
-   if ( MPI_Rank == 0 )
-   {
-      delete [] IdxTable;
-
-      if ( !InputLBIdx0AndLoad )
-      {
-         delete [] LBIdx0_AllRank;
-         delete [] Load_AllRank;
-      }
-   }
+   delete [] LBIdx0_ThisRank;
+   delete [] Load_ThisRank;
+   delete [] IdxTable;
+   delete [] LoadAcc;
 
 
    if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
@@ -297,4 +324,62 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetLoadBelow
+// Description :  Get the total workload of the patch groups in this rank with LBIdx0 < Key
+//
+// Note        :  1. Invoked by LB_SetCutPoint()
+//                2. LBIdx0[] must be sorted into ascending numerical order in advance
+//
+// Parameter   :  NKey      : Number of keys
+//                Key       : Target keys
+//                LoadBelow : Total workload of the patch groups with LBIdx0 < Key[]
+//                NPG       : Number of patch groups in this rank
+//                LBIdx0    : Sorted minimum LB_Idx of all patch groups in this rank
+//                LoadAcc   : Accumulated workload of the first t patch groups in LBIdx0[]
+//
+// Return      :  LoadBelow[]
+//-------------------------------------------------------------------------------------------------------
+void GetLoadBelow( const int NKey, const long *Key, double *LoadBelow, const int NPG, const long *LBIdx0,
+                   const double *LoadAcc )
+{
+
+   for (int k=0; k<NKey; k++)    LoadBelow[k] = LoadAcc[ CountLBIdx0( NPG, LBIdx0, Key[k] ) ];
+
+} // FUNCTION : GetLoadBelow
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CountLBIdx0
+// Description :  Count the number of elements in the sorted array LBIdx0[] smaller than Key
+//
+// Note        :  1. Invoked by LB_SetCutPoint() and GetLoadBelow()
+//                2. Return value is also the index of the first element >= Key
+//
+// Parameter   :  NPG    : Number of elements in LBIdx0[]
+//                LBIdx0 : Array sorted into ascending numerical order
+//                Key    : Target key
+//
+// Return      :  Number of elements < Key
+//-------------------------------------------------------------------------------------------------------
+int CountLBIdx0( const int NPG, const long *LBIdx0, const long Key )
+{
+
+   int Min = 0, Max = NPG;
+
+   while ( Min < Max )
+   {
+      const int Mid = ( Min + Max ) / 2;
+
+      if ( LBIdx0[Mid] < Key )   Min = Mid + 1;
+      else                       Max = Mid;
+   }
+
+   return Min;
+
+} // FUNCTION : CountLBIdx0
+
+
+
 #endif // #ifdef LOAD_BALANCE
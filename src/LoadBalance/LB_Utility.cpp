@@ -114,7 +114,9 @@ void LB_Index2Corner( const int lv, const long LB_Idx, int Corner[], const Check
 // Function    :  LB_Index2Rank
 // Description :  Return the MPI rank which the input LB_Idx belongs to
 //
-// Note        :  "LB_CutPoint[lv]" must be prepared in advance
+// Note        :  1. "LB_CutPoint[lv]" must be prepared in advance
+//                2. Use binary search since LB_CutPoint[lv] is non-decreasing
+//                   --> Fall back to linear search if this assumption fails
 //
 // Parameter   :  lv     : Refinement level of the input LB_Idx
 //                LB_Idx : Space-filling-curve index for load balance
@@ -128,9 +130,27 @@ void LB_Index2Corner( const int lv, const long LB_Idx, int Corner[], const Check
 int LB_Index2Rank( const int lv, const long LB_Idx, const Check_t Check )
 {
 
-//###OPTIMIZATION: better search algorithm
+   const long *CutPoint = amr->LB->CutPoint[lv];
+
+// 1. binary search for the last rank with CutPoint[r] <= LB_Idx
+   if ( LB_Idx >= CutPoint[0]  &&  LB_Idx < CutPoint[MPI_NRank] )
+   {
+      int Min = 0, Max = MPI_NRank-1, Mid;
+
+      while ( Min < Max )
+      {
+         Mid = ( Min + Max + 1 ) / 2;
+
+         if ( CutPoint[Mid] <= LB_Idx )   Min = Mid;
+         else                             Max = Mid - 1;
+      }
+
+      if ( LB_Idx < CutPoint[Min+1] )  return Min;
+   }
+
+// 2. linear search in case LB_CutPoint[lv] is not sorted
    for (int r=0; r<MPI_NRank; r++)
-      if ( LB_Idx >= amr->LB->CutPoint[lv][r]  &&  LB_Idx < amr->LB->CutPoint[lv][r+1] )  return r;
+      if ( LB_Idx >= CutPoint[r]  &&  LB_Idx < CutPoint[r+1] )  return r;
 
    if ( Check == CHECK_ON )
       Aux_Error( ERROR_INFO, "no target rank was found for lv %d, LB_Idx %ld !!\n",
@@ -0,0 +1,292 @@
+#include "GAMER.h"
+
+#ifndef SERIAL
+
+static void Sparse_GetComm();
+
+
+// persistent communicator and buffer shared by MPI_Alltoallv_Sparse() and MPI_Alltoallv_Sparse_NBX()
+// --> Sparse_Comm: duplicate of MPI_COMM_WORLD so that these point-to-point messages never match
+//                  messages of other routines (and vice versa)
+// --> Sparse_RecvPool: messages received by MPI_Alltoallv_Sparse_NBX()
+// --> Sparse_NBXRound: number of calls to MPI_Alltoallv_Sparse_NBX() so far, whose parity is used as the
+//                      message tag to separate consecutive calls
+// --> SPARSE_TAG_KNOWN: message tag of MPI_Alltoallv_Sparse(), which must differ from the NBX tags (0 and 1)
+static MPI_Comm Sparse_Comm         = MPI_COMM_NULL;
+static char    *Sparse_RecvPool     = NULL;
+static long     Sparse_RecvPoolSize = 0L;
+static long     Sparse_NBXRound     = 0L;
+
+static const int SPARSE_TAG_KNOWN = 2;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_Alltoallv_Sparse
+// Description :  Alternative to MPI_Alltoallv_GAMER() for sparse communication patterns, where each rank only
+//                exchanges data with a small number of other ranks (e.g., spatial neighbours along the Hilbert curve)
+//
+// Note        :  1. Invoked by LB_GetBufferData() when OPT__SPARSE_MPI_EXCHANGE is on
+//                2. Use non-blocking point-to-point communication only for the ranks with non-zero send/recv counts
+//                   --> Avoid the global synchronization of MPI_Alltoallv(), whose cost grows with MPI_NRank
+//                       even when most counts are zero
+//                3. Send_NCount[r] on this rank must be equal to Recv_NCount[MPI_Rank] on rank r, as in MPI_Alltoallv()
+//                   --> In particular, a rank must not post a recv from a rank with zero send count to it
+//                   --> Use MPI_Alltoallv_Sparse_NBX() instead if the receive counts are unknown
+//                4. Displacements can exceed __INT_MAX__ since they are applied to the buffer pointers directly
+//                5. Same parameters as MPI_Alltoallv_GAMER() except that there is no communicator argument
+//                   --> Always exchange data among all ranks in MPI_COMM_WORLD through the private communicator
+//                       Sparse_Comm
+//
+// Parameter   :  SendBuf       : Data to be sent by this rank to other ranks
+//                Send_NCount   : Number of elements to be sent by this rank to each rank; length equals MPI_NRank
+//                Send_NDisp    : Displacement indicating where the data sent to each rank start in SendBuf;
+//                                length equals MPI_NRank
+//                Send_Datatype : Sent data type for MPI
+//                RecvBuf       : Data to be received by this rank from other ranks
+//                Recv_NCount   : Number of elements to be received by this rank from each rank; length equals MPI_NRank
+//                Recv_NDisp    : Displacement indicating where the data received from each rank start in RecvBuf;
+//                                length equals MPI_NRank
+//                Recv_Datatype : Received data type for MPI
+//
+// Return      :  RecvBuf
+//-------------------------------------------------------------------------------------------------------
+template<typename T>
+void MPI_Alltoallv_Sparse( T *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype,
+                           T *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype )
+{
+
+   Sparse_GetComm();
+
+
+// 1. count the number of target ranks
+   int NSendRank = 0, NRecvRank = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )    continue;
+
+      if ( Send_NCount[r] > __INT_MAX__ ) Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) > __INT_MAX__ (%ld)!!\n", r, Send_NCount[r], (long)__INT_MAX__ );
+      if ( Recv_NCount[r] > __INT_MAX__ ) Aux_Error( ERROR_INFO, "Recv_NCount[%d] (%ld) > __INT_MAX__ (%ld)!!\n", r, Recv_NCount[r], (long)__INT_MAX__ );
+
+      if ( Send_NCount[r] > 0L )    NSendRank ++;
+      if ( Recv_NCount[r] > 0L )    NRecvRank ++;
+   }
+
+
+// 2. post all receives first and then all sends
+   MPI_Request *Req = new MPI_Request [ NSendRank + NRecvRank ];
+   int NReq = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+      if ( r != MPI_Rank  &&  Recv_NCount[r] > 0L )
+         MPI_Irecv( RecvBuf+Recv_NDisp[r], (int)Recv_NCount[r], Recv_Datatype, r, SPARSE_TAG_KNOWN, Sparse_Comm, &Req[ NReq ++ ] );
+
+   for (int r=0; r<MPI_NRank; r++)
+      if ( r != MPI_Rank  &&  Send_NCount[r] > 0L )
+         MPI_Isend( SendBuf+Send_NDisp[r], (int)Send_NCount[r], Send_Datatype, r, SPARSE_TAG_KNOWN, Sparse_Comm, &Req[ NReq ++ ] );
+
+
+// 3. copy the data sent to this rank directly while waiting for other ranks
+   if ( Send_NCount[MPI_Rank] != Recv_NCount[MPI_Rank] )
+      Aux_Error( ERROR_INFO, "Send_NCount[%d] (%ld) != Recv_NCount[%d] (%ld) !!\n",
+                 MPI_Rank, Send_NCount[MPI_Rank], MPI_Rank, Recv_NCount[MPI_Rank] );
+
+   if ( Send_NCount[MPI_Rank] > 0L )
+      memcpy( RecvBuf+Recv_NDisp[MPI_Rank], SendBuf+Send_NDisp[MPI_Rank], Send_NCount[MPI_Rank]*sizeof(T) );
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+   delete [] Req;
+
+} // FUNCTION : MPI_Alltoallv_Sparse
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_Alltoallv_Sparse_NBX
+// Description :  Same as MPI_Alltoallv_Sparse() except that the receive counts are unknown in advance
+//
+// Note        :  1. Invoked by Par_LB_SendParticleData() when PAR_SPARSE_EXCHANGE is on
+//                2. Adopt the nonblocking consensus algorithm (NBX) of Hoefler et al. (2010) so that a rank
+//                   does not need to know in advance which ranks will send data to it
+//                   (1) Send one message to each target rank by MPI_Issend()
+//                   (2) Keep receiving messages from any rank by MPI_Iprobe() and MPI_Recv()
+//                   (3) Enter a nonblocking barrier once all local sends have been matched
+//                   (4) Stop once the nonblocking barrier completes, at which point all messages
+//                       have been received by all ranks
+//                3. Exchange raw bytes and do not handle the data sent to this rank itself
+//                   --> Send_NByte[MPI_Rank] is ignored and Recv_NByte[MPI_Rank] is always zero
+//                4. RecvBuf points to an internal buffer, which is kept between calls and only grows
+//                   --> Do not free it, and copy the data out before the next call
+//                   --> Call MPI_Alltoallv_Sparse_MemFree() to free memory
+//                5. Require MPI-3 for MPI_Ibarrier()
+//
+// Parameter   :  SendBuf    : Data to be sent by this rank to other ranks
+//                Send_NByte : Number of bytes to be sent by this rank to each rank; length equals MPI_NRank
+//                Send_NDisp : Displacement in bytes indicating where the data sent to each rank start in SendBuf;
+//                             length equals MPI_NRank
+//                RecvBuf    : Data received by this rank from other ranks (call by reference)
+//                Recv_NByte : Number of bytes received by this rank from each rank (zero if no message);
+//                             length equals MPI_NRank
+//                Recv_NDisp : Displacement in bytes indicating where the data received from each rank start in RecvBuf;
+//                             length equals MPI_NRank
+//
+// Return      :  RecvBuf, Recv_NByte, Recv_NDisp
+//-------------------------------------------------------------------------------------------------------
+void MPI_Alltoallv_Sparse_NBX( char *SendBuf, const long *Send_NByte, const long *Send_NDisp,
+                               char *&RecvBuf, long *Recv_NByte, long *Recv_NDisp )
+{
+
+   Sparse_GetComm();
+
+   const int Tag = (int)( Sparse_NBXRound % 2L );
+
+   Sparse_NBXRound ++;
+
+
+// 1. start sending
+//    --> use MPI_Issend() so that the send completes only after the target rank starts receiving
+   int NSendMsg = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank  ||  Send_NByte[r] == 0L )   continue;
+
+      if ( Send_NByte[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "Send_NByte[%d] (%ld) > __INT_MAX__ (%ld)!!\n", r, Send_NByte[r], (long)__INT_MAX__ );
+
+      NSendMsg ++;
+   }
+
+   MPI_Request *SendReq = new MPI_Request [NSendMsg];
+   int          SendIdx = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+      if ( r != MPI_Rank  &&  Send_NByte[r] > 0L )
+         MPI_Issend( SendBuf+Send_NDisp[r], (int)Send_NByte[r], MPI_BYTE, r, Tag, Sparse_Comm, &SendReq[ SendIdx ++ ] );
+
+
+// 2. receive messages until all ranks have received all their messages
+   long RecvPoolUsed  = 0L;
+   bool BarrierActive = false;
+   int  Done          = 0;
+
+   MPI_Request BarrierReq;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Recv_NByte[r] = 0L;
+      Recv_NDisp[r] = 0L;
+   }
+
+   while ( !Done )
+   {
+//    2-1. receive any message that has arrived
+      int        Arrived, MsgSize;
+      MPI_Status Status;
+
+      MPI_Iprobe( MPI_ANY_SOURCE, Tag, Sparse_Comm, &Arrived, &Status );
+
+      if ( Arrived )
+      {
+         MPI_Get_count( &Status, MPI_BYTE, &MsgSize );
+
+//       the receive is blocking, so it is safe to reallocate the pool here
+         if ( RecvPoolUsed + MsgSize > Sparse_RecvPoolSize )
+         {
+            Sparse_RecvPoolSize = MAX( RecvPoolUsed + MsgSize, 2L*Sparse_RecvPoolSize );
+            Sparse_RecvPool     = (char*)realloc( Sparse_RecvPool, Sparse_RecvPoolSize );
+         }
+
+         MPI_Recv( Sparse_RecvPool + RecvPoolUsed, MsgSize, MPI_BYTE, Status.MPI_SOURCE, Tag, Sparse_Comm, MPI_STATUS_IGNORE );
+
+#        ifdef GAMER_DEBUG
+         if ( Recv_NByte[ Status.MPI_SOURCE ] != 0L )
+            Aux_Error( ERROR_INFO, "received more than one message from rank %d !!\n", Status.MPI_SOURCE );
+#        endif
+
+         Recv_NByte[ Status.MPI_SOURCE ]  = MsgSize;
+         Recv_NDisp[ Status.MPI_SOURCE ]  = RecvPoolUsed;
+         RecvPoolUsed                    += MsgSize;
+      }
+
+//    2-2. enter the nonblocking barrier once all local sends have been matched
+//         --> once the barrier completes, all messages of all ranks have been matched
+      if ( BarrierActive )
+         MPI_Test( &BarrierReq, &Done, MPI_STATUS_IGNORE );
+
+      else
+      {
+         int AllSent;
+         MPI_Testall( NSendMsg, SendReq, &AllSent, MPI_STATUSES_IGNORE );
+
+         if ( AllSent )
+         {
+            MPI_Ibarrier( Sparse_Comm, &BarrierReq );
+            BarrierActive = true;
+         }
+      }
+   } // while ( !Done )
+
+   RecvBuf = Sparse_RecvPool;
+
+   delete [] SendReq;
+
+} // FUNCTION : MPI_Alltoallv_Sparse_NBX
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Sparse_GetComm
+// Description :  Create the private communicator Sparse_Comm on the first call
+//
+// Note        :  1. Invoked by MPI_Alltoallv_Sparse() and MPI_Alltoallv_Sparse_NBX()
+//                2. Both functions are called by all ranks in the same order, so it is safe to create
+//                   the communicator collectively on the first call
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Sparse_GetComm()
+{
+
+   if ( Sparse_Comm == MPI_COMM_NULL )    MPI_Comm_dup( MPI_COMM_WORLD, &Sparse_Comm );
+
+} // FUNCTION : Sparse_GetComm
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MPI_Alltoallv_Sparse_MemFree
+// Description :  Free the communicator and the receive buffer used by MPI_Alltoallv_Sparse() and
+//                MPI_Alltoallv_Sparse_NBX()
+//
+// Note        :  1. Invoked by End_MemFree()
+//                2. Must be called by all ranks since MPI_Comm_free() is collective
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void MPI_Alltoallv_Sparse_MemFree()
+{
+
+   free( Sparse_RecvPool );
+
+   Sparse_RecvPool     = NULL;
+   Sparse_RecvPoolSize = 0L;
+
+   if ( Sparse_Comm != MPI_COMM_NULL )    MPI_Comm_free( &Sparse_Comm );
+
+} // FUNCTION : MPI_Alltoallv_Sparse_MemFree
+
+
+
+// explicit template instantiation
+template void MPI_Alltoallv_Sparse <float>  ( float  *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, float  *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template void MPI_Alltoallv_Sparse <double> ( double *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, double *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template void MPI_Alltoallv_Sparse <int>    ( int    *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, int    *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+template void MPI_Alltoallv_Sparse <long>   ( long   *SendBuf, long *Send_NCount, long *Send_NDisp, MPI_Datatype Send_Datatype, long   *RecvBuf, long *Recv_NCount, long *Recv_NDisp, MPI_Datatype Recv_Datatype );
+
+
+
+#endif // #ifndef SERIAL
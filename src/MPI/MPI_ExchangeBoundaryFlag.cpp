@@ -9,42 +9,59 @@
 // Function    :  MPI_ExchangeBoundaryFlag
 // Description :  Get BuffFlag_NList[] and BuffFlag_PosList[] from 26 neighbor ranks
 //
+// Note        :  1. All 26 directions are exchanged at once with non-blocking communication
+//                   --> The sends of BounFlag_NList[] and BounFlag_PosList[] are posted together and only the
+//                       receives of BuffFlag_PosList[] need to wait for BuffFlag_NList[]
+//                2. The message sent to direction "s" is tagged by "s" (and "26+s" for the flag list) so that
+//                   it is received from the mirror-symmetric direction even when several directions
+//                   share the same neighbor rank
+//
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
 void MPI_ExchangeBoundaryFlag( const int lv )
 {
 
-   const int v[26] = { 0,1,2,3,4,5,6,9,7,8,10,13,11,12,14,17,16,15,18,25,19,24,20,23,21,22 };
-   int SendTarget[2], RecvTarget[2];
-   MPI_Request Req[4];
+// MirrorSib : the mirror-symmetric sibling index
+   const int MirrorSib[26] = { 1,0,3,2,5,4,9,8,7,6,13,12,11,10,17,16,15,14,25,24,23,22,21,20,19,18 };
+
+   int NReq_N=0, NReq=0;
+   MPI_Request Req_N[26], Req[3*26];
 
 
-// a. get BuffFlag_NList[]
-   for (int s=0; s<26; s+=2)
+// a. post the receives of BuffFlag_NList[] and the sends of both BounFlag_NList[] and BounFlag_PosList[]
+   for (int s=0; s<26; s++)
    {
+      amr->ParaVar->BuffFlag_NList[lv][s] = 0;
+
 //    properly deal with the non-periodic B.C.
-      for (int t=0; t<2; t++)
-      {
-         SendTarget[t] = ( MPI_SibRank[ v[s+t] ] < 0 ) ? MPI_PROC_NULL : MPI_SibRank[ v[s+t] ];
-         RecvTarget[t] = ( MPI_SibRank[ v[s+t] ] < 0 ) ? MPI_PROC_NULL : MPI_SibRank[ v[s+t] ];
-      }
+      if ( MPI_SibRank[s] < 0 )  continue;
 
-      MPI_Isend( &amr->ParaVar->BounFlag_NList[lv][ v[s  ] ], 1, MPI_INT, SendTarget[0], 0, MPI_COMM_WORLD, &Req[0] );
-      MPI_Isend( &amr->ParaVar->BounFlag_NList[lv][ v[s+1] ], 1, MPI_INT, SendTarget[1], 1, MPI_COMM_WORLD, &Req[1] );
+      MPI_Irecv( &amr->ParaVar->BuffFlag_NList[lv][s], 1, MPI_INT, MPI_SibRank[s], MirrorSib[s],
+                 MPI_COMM_WORLD, &Req_N[ NReq_N ++ ] );
+   }
 
-      MPI_Irecv( &amr->ParaVar->BuffFlag_NList[lv][ v[s  ] ], 1, MPI_INT, RecvTarget[0], 1, MPI_COMM_WORLD, &Req[2] );
-      MPI_Irecv( &amr->ParaVar->BuffFlag_NList[lv][ v[s+1] ], 1, MPI_INT, RecvTarget[1], 0, MPI_COMM_WORLD, &Req[3] );
+   for (int s=0; s<26; s++)
+   {
+      if ( MPI_SibRank[s] < 0 )  continue;
 
-      MPI_Waitall( 4, Req, MPI_STATUSES_IGNORE );
+#     ifdef GAMER_DEBUG
+      if ( MPI_SibRank[s] >= MPI_NRank )
+         Aux_Error( ERROR_INFO, "incorrect MPI_SibRank[%d] = %d !!\n", s, MPI_SibRank[s] );
+#     endif
 
-//    properly deal with the non-periodic B.C.
-      for (int t=0; t<2; t++)
-         if ( MPI_SibRank[ v[s+t] ] < 0 )    amr->ParaVar->BuffFlag_NList[lv][ v[s+t] ] = 0;
+      MPI_Isend( &amr->ParaVar->BounFlag_NList[lv][s], 1, MPI_INT, MPI_SibRank[s], s,
+                 MPI_COMM_WORLD, &Req[ NReq ++ ] );
+
+      if ( amr->ParaVar->BounFlag_NList[lv][s] > 0 )
+      MPI_Isend( amr->ParaVar->BounFlag_PosList[lv][s], amr->ParaVar->BounFlag_NList[lv][s], MPI_INT,
+                 MPI_SibRank[s], 26+s, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
 
-   } // for (int s=0; s<26; s+=2)
 
+// b. allocate memory for BuffFlag_PosList[] (which will be deallocated by Flag_Buffer()) and post
+//    the corresponding receives as soon as BuffFlag_NList[] arrives
+   MPI_Waitall( NReq_N, Req_N, MPI_STATUSES_IGNORE );
 
-// b. allocate memory for BuffFlag_PosList[] (which will be deallocated by Flag_Buffer())
    for (int s=0; s<26; s++)
    {
       if ( amr->ParaVar->BuffFlag_PosList[lv][s] != NULL )
@@ -54,38 +71,15 @@ void MPI_ExchangeBoundaryFlag( const int lv )
       }
 
       amr->ParaVar->BuffFlag_PosList[lv][s] = new int [ amr->ParaVar->BuffFlag_NList[lv][s] ];
-   }
-
-
-// c. get BuffFlag_PosList[]
-   for (int s=0; s<26; s+=2)
-   {
-      for (int t=0; t<2; t++)
-      {
-         SendTarget[t] = ( amr->ParaVar->BounFlag_NList[lv][ v[s+t] ] == 0 ) ? MPI_PROC_NULL : MPI_SibRank[ v[s+t] ];
-         RecvTarget[t] = ( amr->ParaVar->BuffFlag_NList[lv][ v[s+t] ] == 0 ) ? MPI_PROC_NULL : MPI_SibRank[ v[s+t] ];
-
-#        ifdef GAMER_DEBUG
-         if (  amr->ParaVar->BounFlag_NList[lv][ v[s+t] ] != 0  &&  ( SendTarget[t] < 0 || SendTarget[t] >= MPI_NRank )  )
-            Aux_Error( ERROR_INFO, "incorrect SendTarget[%d] = %d !!\n", t, SendTarget[t] );
-         if (  amr->ParaVar->BuffFlag_NList[lv][ v[s+t] ] != 0  &&  ( RecvTarget[t] < 0 || RecvTarget[t] >= MPI_NRank )  )
-            Aux_Error( ERROR_INFO, "incorrect RecvTarget[%d] = %d !!\n", t, RecvTarget[t] );
-#        endif
-      }
 
-      MPI_Isend( amr->ParaVar->BounFlag_PosList[lv][ v[s  ] ], amr->ParaVar->BounFlag_NList[lv][ v[s  ] ],
-                 MPI_INT, SendTarget[0], 2, MPI_COMM_WORLD, &Req[0] );
-      MPI_Isend( amr->ParaVar->BounFlag_PosList[lv][ v[s+1] ], amr->ParaVar->BounFlag_NList[lv][ v[s+1] ],
-                 MPI_INT, SendTarget[1], 3, MPI_COMM_WORLD, &Req[1] );
-
-      MPI_Irecv( amr->ParaVar->BuffFlag_PosList[lv][ v[s  ] ], amr->ParaVar->BuffFlag_NList[lv][ v[s  ] ],
-                 MPI_INT, RecvTarget[0], 3, MPI_COMM_WORLD, &Req[2] );
-      MPI_Irecv( amr->ParaVar->BuffFlag_PosList[lv][ v[s+1] ], amr->ParaVar->BuffFlag_NList[lv][ v[s+1] ],
-                 MPI_INT, RecvTarget[1], 2, MPI_COMM_WORLD, &Req[3] );
+      if ( amr->ParaVar->BuffFlag_NList[lv][s] > 0 )
+      MPI_Irecv( amr->ParaVar->BuffFlag_PosList[lv][s], amr->ParaVar->BuffFlag_NList[lv][s], MPI_INT,
+                 MPI_SibRank[s], 26+MirrorSib[s], MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
 
-      MPI_Waitall( 4, Req, MPI_STATUSES_IGNORE );
 
-   } // for (int s=0; s<26; s+=2)
+// c. wait until all BuffFlag_PosList[] have arrived and all BounFlag_PosList[] have been sent
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
 
 
 // d. deallocate memory for BounFlag_PosList[]
@@ -153,9 +153,28 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Flu_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
-      if ( false ) {}
-      /*
-      if ( OPT__OVERLAP_MPI )
+//    overlap the buffer-data exchange with the fluid solver if possible (OPT__OVERLAP_MPI)
+//    --> advance the patches needed to be sent first (i.e., the patches recorded in LB->SendH_IDList)
+//        and then transfer their updated data while advancing the remaining patches
+//    --> with self-gravity, overlap the density exchange for the Poisson solver (lv > 0 only)
+//        otherwise, overlap the fluid exchange in step 8, which requires that no other routines
+//        modify the fluid data in between
+#     ifdef GRAVITY
+      const bool OverlapMPI_Flu = ( OPT__OVERLAP_MPI  &&  OPT__SELF_GRAVITY  &&  lv > 0 );
+#     else
+      bool OverlapMPI_Flu = ( OPT__OVERLAP_MPI  &&  !SrcTerms.Any  &&  !OPT__RESET_FLUID );
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE )    OverlapMPI_Flu = false;
+#     endif
+#     ifdef STAR_FORMATION
+      if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )  OverlapMPI_Flu = false;
+#     endif
+#     ifdef FEEDBACK
+      if ( FB_Any )              OverlapMPI_Flu = false;
+#     endif
+#     endif // #ifdef GRAVITY ... else ...
+
+      if ( OverlapMPI_Flu )
       {
 //       enable OpenMP nested parallelism
 #        ifdef OPENMP
@@ -166,13 +185,22 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, true ),
                         Timer_Flu_Advance[lv],   TIMER_ON   );
 
-#        pragma omp parallel sections num_threads(2)
+//       let the master thread transfer data so that MPI_THREAD_FUNNELED is sufficient
+#        pragma omp parallel num_threads( 2 )
          {
-#           pragma omp section
+#           ifdef OPENMP
+            const int TID     = omp_get_thread_num();
+            const int NThread = omp_get_num_threads();
+#           else
+            const int TID     = 0;
+            const int NThread = 1;
+#           endif
+
+//          transfer data simultaneously
+//          --> fall back to a sequential update if only one thread is available
+            if ( TID == 0 )
             {
-//             transfer data simultaneously
 #              ifdef GRAVITY
-               if ( OPT__SELF_GRAVITY )
                TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT,   NULL_INT, DATA_GENERAL, _DENS,  _NONE, Rho_ParaBuf, USELB_YES ),
                               Timer_GetBuf[lv][0],   TIMER_ON   );
 #              else
@@ -181,20 +209,17 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 #              endif
             }
 
-#           pragma omp section
-            {
-//             advance patches not needed to be sent
+//          advance patches not needed to be sent
+            if ( TID == NThread-1 )
                TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
                               Timer_Flu_Advance[lv],   TIMER_ON   );
-            }
-         } // OpenMP parallel sections
+         } // OpenMP parallel region
 
 //       disable OpenMP nested parallelism
 #        ifdef OPENMP
          omp_set_nested( false );
 #        endif
-      } // if ( OPT__OVERLAP_MPI )
-      */
+      } // if ( OverlapMPI_Flu )
 
       else
       {
@@ -301,7 +326,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
             } // if ( FluStatus_AllRank == GAMER_SUCCESS ) ... else ...
          } // if ( AUTO_REDUCE_DT )
 
-      } // if ( OPT__OVERLAP_MPI ) ... else ...
+      } // if ( OverlapMPI_Flu ) ... else ...
 
       amr->FluSg    [lv]             = SaveSg_Flu;
       amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
@@ -405,11 +430,18 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          else
          {
 //          exchange the updated density field in the buffer patches for the Poisson solver
-            if ( OPT__SELF_GRAVITY )
+//          --> already done in step 2 if OverlapMPI_Flu is on
+            if ( OPT__SELF_GRAVITY  &&  !OverlapMPI_Flu )
             TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
                                               _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv][0],   TIMER_ON   );
 
+//          Gra_AdvanceDt() times the level-wide multigrid Poisson solver internally (same as the base level)
+//          --> must not start Timer_Gra_Advance[lv] here, which would be started twice
+            if ( UsePot  &&  OPT__SELF_GRAVITY  &&  OPT__POI_LEVEL_MG )
+               Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot, UsePot, true, false, false, true );
+
+            else
             TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
                                           UsePot, true, false, false, true ),
                            Timer_Gra_Advance[lv],   TIMER_ON   );
@@ -418,7 +450,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //          --> we will do this after all other operations (e.g., star formation) if OPT__MINIMIZE_MPI_BARRIER is adopted
 //              --> assuming that all remaining operations do not need to access the potential in the buffer patches
 //              --> one must enable both STORE_POT_GHOST and PAR_IMPROVE_ACC for this purpose
-            if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER )
+//          --> already done in Gra_AdvanceDt() if OPT__POI_LEVEL_MG is on
+            if ( UsePot  &&  !OPT__MINIMIZE_MPI_BARRIER  &&  !( OPT__POI_LEVEL_MG && OPT__SELF_GRAVITY )  )
             TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                               _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv][1],   TIMER_ON   );
@@ -614,6 +647,10 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //    8. update MPI buffers
 // ===============================================================================================
 //    exchange the updated fluid field in the buffer patches
+//    --> already done in step 2 if OverlapMPI_Flu is on without GRAVITY
+#     ifndef GRAVITY
+      if ( !OverlapMPI_Flu )
+#     endif
       TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
                                         _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][2],   TIMER_ON   );
@@ -700,8 +737,14 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
          Timer_Lv[lv]->Stop();
 #        endif
 
+//       cache the coarse-fine ghost-zone interpolation results at lv while evolving lv+1 (OPT__INT_CACHE)
+//       --> data at lv remain unchanged until the fix-up operations below
+         Prepare_PatchData_InitIntCache( lv );
+
          EvolveLevel( lv+1, dTime_SubStep );
 
+         Prepare_PatchData_FreeIntCache( lv );
+
 #        ifdef TIMING
          MPI_Barrier( MPI_COMM_WORLD );
          Timer_Lv[lv]->Start();
@@ -808,6 +851,15 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
             TIMING_FUNC(   Refine( lv_refine, USELB_YES ),
                            Timer_Refine[lv_refine],   TIMER_ON   );
 
+//          restore the fixed-stride layout of the patch slabs modified by Refine()
+            if ( OPT__PATCH_SLAB )
+            {
+               TIMING_FUNC(   amr->SlabCompact( lv_refine   ),
+                              Timer_Refine[lv_refine],   TIMER_ON   );
+               TIMING_FUNC(   amr->SlabCompact( lv_refine+1 ),
+                              Timer_Refine[lv_refine],   TIMER_ON   );
+            }
+
             Time          [lv_refine+1]                            = Time[lv_refine];
             amr->FluSgTime[lv_refine+1][ amr->FluSg[lv_refine+1] ] = Time[lv_refine];
 #           ifdef MHD
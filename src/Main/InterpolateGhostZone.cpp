@@ -23,6 +23,8 @@ void SetTempIntPara( const int lv, const int Sg0, const double PrepTime, const d
 //                6. Use PrepTime to determine the physical time to prepare data
 //                   --> Temporal interpolation/extrapolation will be conducted automatically if PrepTime
 //                       is NOT equal to the time of data stored previously (e.g., FluSgTime[0/1])
+//                7. Temporary arrays are taken from the scratch arena acquired by Prepare_PatchData()
+//                   --> See Mis_GetScratch()
 //
 // Parameter   :  lv                 : Target "coarse-grid" refinement level
 //                PID                : Patch ID at level "lv" used for interpolation
@@ -237,13 +239,20 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 #  else
    const int NVarCC_Allocate = NVarCC_Tot;
 #  endif
+// --> taken from the per-thread scratch arena (see Mis_GetScratch()) to avoid allocating memory for every call
    real *CData_CC_Ptr = NULL;
-   real *CData_CC     = new real [ NVarCC_Allocate*CSize3D_CC ];
-   real **CData_FC    = NULL;
+   real *CData_CC     = (real*)Mis_GetScratch( SCRATCH_INTGZ_CC, (long)NVarCC_Allocate*CSize3D_CC*sizeof(real) );
+   real *CData_FC[3]  = { NULL, NULL, NULL };
 
 // assuming NVarFC_Tot = either 0 or 3
-   CData_FC = new real* [NVarFC_Tot];
-   for (int v=0; v<NVarFC_Tot; v++)    CData_FC[v] = new real [ CSize3D_FC[v] ];
+   if ( NVarFC_Tot > 0 )
+   {
+      long CSize3D_FC_Sum = 0;
+      for (int v=0; v<NVarFC_Tot; v++)    CSize3D_FC_Sum += CSize3D_FC[v];
+
+      CData_FC[0] = (real*)Mis_GetScratch( SCRATCH_INTGZ_FC, CSize3D_FC_Sum*sizeof(real) );
+      for (int v=1; v<NVarFC_Tot; v++)    CData_FC[v] = CData_FC[v-1] + CSize3D_FC[v-1];
+   }
 
 
 // temporal interpolation parameters
@@ -1729,7 +1738,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                      IntData_FC + FSize3D_FC[0],
                                      IntData_FC + FSize3D_FC[0] + FSize3D_FC[1] };
 
-         FMag_CC_IntIter = new real [FSize3D_CC][NCOMP_MAG];
+         FMag_CC_IntIter = (real (*)[NCOMP_MAG])Mis_GetScratch( SCRATCH_INTGZ_MAG, (long)FSize3D_CC*NCOMP_MAG*sizeof(real) );
 
          for (int k=0; k<FSize_CC[2]; k++)
          for (int j=0; j<FSize_CC[1]; j++)
@@ -1752,8 +1761,6 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                    (IntIter && OPT__INT_PRIM)?INT_PRIM_YES:INT_PRIM_NO,
                    (IntIter                 )?INT_REDUCE_MONO_COEFF:INT_FIX_MONO_COEFF,
                    CMag_CC_IntIter, FMag_CC_IntIter );
-
-      delete [] FMag_CC_IntIter;
    } // if ( IntPhase ) ... else ...
 
    NVarCC_SoFar = NVarCC_Flu;
@@ -1866,12 +1873,6 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 #  endif
 
 
-// free memory
-   delete [] CData_CC;
-   for (int v=0; v<NVarFC_Tot; v++)    delete [] CData_FC[v];
-   delete [] CData_FC;
-
-
 
 // d. ensure the consistency between pressure, total energy density, and the dual-energy variable
 //    when DUAL_ENERGY is on
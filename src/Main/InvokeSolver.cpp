@@ -1,11 +1,21 @@
 #include "GAMER.h"
 
 static void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                              const int *PID0_List, const int ArrayID );
+                              const int *PID0_List, const int ArrayID, const int PG0, const bool SubTimer );
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-                    const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
+                    const int NPG, const int ArrayID, const int PG0, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const int PG0, const double dt );
+#ifndef GPU
+static void Fused_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                        const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                        const int NTotal, const int *PID0_List, const int NPG_Max );
+#ifdef LOAD_BALANCE
+static void Measured_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                           const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                           const int NTotal, const int *PID0_List, const int NPG_Max );
+#endif
+#endif
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -17,6 +27,23 @@ extern Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 #endif
 
+// accumulate the wall-clock time spent on "call" to "cost" for OPT__LB_MEASURED_COST
+#ifdef LOAD_BALANCE
+#  define MEASURE_COST( call, cost )   { const double t0 = MPI_Wtime();  call;  cost += MPI_Wtime() - t0; }
+#else
+#  define MEASURE_COST( call, cost )   call
+#endif
+
+// pointers to the PG0-th patch group in the per-patch-group arrays (e.g., h_Flu_Array_F_In) and to the
+// (8*PG0)-th patch in the per-patch arrays (e.g., h_Rho_Array_P) of the target ArrayID
+// --> PG0 is nonzero only for OPT__CPU_FUSED_SOLVER
+// --> return NULL for the arrays of the disabled features
+#define PTR_PG( Array )    ( ( (Array)[ArrayID] == NULL ) ? NULL : (Array)[ArrayID] +   PG0 )
+#define PTR_P( Array )     ( ( (Array)[ArrayID] == NULL ) ? NULL : (Array)[ArrayID] + 8*PG0 )
+
+// preparation sub-timers are disabled in the fused mode since TIMING_SYNC() is not thread-safe
+#define TIMING_PREP( call, timer )  {  if ( SubTimer )  { TIMING_SYNC( call, timer ); }  else  { call; }  }
+
 
 
 
@@ -33,6 +60,16 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For OPT__LB_MEASURED_COST, record the time spent on each patch group
+//                   --> CPU builds always go through Fused_Step() or Measured_Step(), which time each patch group
+//                       separately, except for the Grackle and dt solvers
+//                   --> Otherwise (including GPU), only the wall-clock time spent on each group of NPG_Max patch groups
+//                       is available and it is distributed evenly to these patch groups
+//                   --> Exclude the time waiting for other ranks (e.g., MPI_Barrier for OPT__TIMING_BARRIER)
+//                   --> For GPU, only the CPU time and the GPU time that is not overlapped with CPU are measured
+//                6. For OPT__CPU_FUSED_SOLVER in CPU builds, the fluid (without MHD), Poisson, gravity, and source-term
+//                   solvers prepare, solve, and close one patch group at a time in each thread by Fused_Step()
+//                   instead of going through the three steps with NPG_Max patch groups
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -106,7 +143,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 // set the maximum number of patch groups to be updated at a time
-   int NPG_Max;
+   int NPG_Max = NULL_INT;
 
    switch ( TSolver )
    {
@@ -139,7 +176,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
    bool AllocateList = false; // whether to allocate PID0_List or not
    int  ArrayID      = 0;     // array index to load and store data ( 0 or 1 )
    int  NPG[2];               // number of patch groups to be updated at a time
-   int  NTotal;               // total number of patch groups to be updated
+   int  NTotal       = 0;     // total number of patch groups to be updated
    int  Disp;                 // index displacement in PID0_List
 
    if ( OverlapMPI )
@@ -193,17 +230,67 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
    } // if ( OverlapMPI ) ... else ...
 
+// fused prepare/solve/close pipeline in CPU builds
+// --> also adopted by OPT__LB_MEASURED_COST to measure the workload of each patch group
+#  ifndef GPU
+   bool PerPatchGroup = OPT__CPU_FUSED_SOLVER;
+#  ifdef LOAD_BALANCE
+   PerPatchGroup |= OPT__LB_MEASURED_COST;
+#  endif
+
+   if ( PerPatchGroup )
+   {
+      bool Fused = ( TSolver == SRC_SOLVER );
+
+#     ifndef MHD
+      Fused |= ( TSolver == FLUID_SOLVER );
+#     endif
+#     ifdef GRAVITY
+      Fused |= ( TSolver == POISSON_SOLVER  ||  TSolver == GRAVITY_SOLVER  ||  TSolver == POISSON_AND_GRAVITY_SOLVER );
+#     endif
+
+      if ( Fused )
+      {
+         TIMING_SYNC(   Fused_Step( TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                    NTotal, PID0_List, NPG_Max ),
+                        Timer_Sol[lv][TSolver]  );
+
+         if ( AllocateList )  delete [] PID0_List;
+
+         return;
+      }
+
+//    fluid solver with MHD
+#     ifdef LOAD_BALANCE
+      if ( OPT__LB_MEASURED_COST  &&  TSolver == FLUID_SOLVER )
+      {
+         TIMING_SYNC(   Measured_Step( TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                       NTotal, PID0_List, NPG_Max ),
+                        Timer_Sol[lv][TSolver]  );
+
+         if ( AllocateList )  delete [] PID0_List;
+
+         return;
+      }
+#     endif
+   } // if ( PerPatchGroup )
+#  endif // #ifndef GPU
+
    NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
 
+   double Cost[2] = { 0.0, 0.0 };   // wall-clock time spent on the patch groups stored in each array
+
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID ),
+   TIMING_SYNC(   MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID, 0, true ),
+                                Cost[ArrayID] ),
                   Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+   TIMING_SYNC(   MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff ),
+                                Cost[ArrayID] ),
                   Timer_Sol[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -216,7 +303,8 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
+      TIMING_SYNC(   MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID, 0, true ),
+                                   Cost[ArrayID] ),
                      Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -229,17 +317,25 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+      TIMING_SYNC(   MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff ),
+                                   Cost[ArrayID] ),
                      Timer_Sol[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+      TIMING_SYNC(   MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                   NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, 0, dt ),
+                                   Cost[1-ArrayID] ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
+#     ifdef LOAD_BALANCE
+      if ( OPT__LB_MEASURED_COST )
+         LB_RecordMeasuredCost( lv, NPG[1-ArrayID], PID0_List+Disp-NPG_Max, Cost[1-ArrayID] );
+#     endif
+      Cost[1-ArrayID] = 0.0;
+
    } // for (int Disp=NPG_Max; Disp<NTotal; Disp+=NPG_Max)
 
 
@@ -251,11 +347,17 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+   TIMING_SYNC(   MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, 0, dt ),
+                                Cost[ArrayID] ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
+#  ifdef LOAD_BALANCE
+   if ( OPT__LB_MEASURED_COST )
+      LB_RecordMeasuredCost( lv, NPG[ArrayID], PID0_List+Disp-NPG_Max, Cost[ArrayID] );
+#  endif
+
 
    if ( AllocateList )  delete [] PID0_List;
 
@@ -290,9 +392,11 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //                NPG       : Number of patch groups to be prepared at a time
 //                PID0_List : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                PG0       : Index of the first patch group to store data in the target arrays
+//                SubTimer  : Enable the timers of individual preparation functions (e.g., Timer_Poi_PreRho)
 //-------------------------------------------------------------------------------------------------------
 void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                       const int *PID0_List, const int ArrayID )
+                       const int *PID0_List, const int ArrayID, const int PG0, const bool SubTimer )
 {
 
 #  ifndef UNSPLIT_GRAVITY
@@ -314,43 +418,43 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Prepare( lv, TimeOld, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID],
-                      h_Pot_Array_USG_F[ArrayID], h_Corner_Array_F[ArrayID], NPG, PID0_List );
+         Flu_Prepare( lv, TimeOld, PTR_PG( h_Flu_Array_F_In ), PTR_PG( h_Mag_Array_F_In ),
+                      PTR_PG( h_Pot_Array_USG_F ), PTR_PG( h_Corner_Array_F ), NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
       case POISSON_SOLVER :
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, h_Rho_Array_P[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Poi_Prepare_Rho( lv, TimeNew, PTR_P( h_Rho_Array_P ), NPG, PID0_List ),
                         Timer_Poi_PreRho[lv]   );
 
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Poi_Prepare_Pot( lv, TimeNew, PTR_P( h_Pot_Array_P_In ), NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
 
 //       use the same timer "Timer_Poi_PreRho" as Poi_Prepare_Rho()
          if ( OPT__EXT_POT )
-         TIMING_SYNC(   Gra_Prepare_Corner( lv, h_Corner_Array_PGT[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Gra_Prepare_Corner( lv, PTR_P( h_Corner_Array_PGT ), NPG, PID0_List ),
                         Timer_Poi_PreRho[lv]   );
       break;
 
       case GRAVITY_SOLVER :
-         TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
+         TIMING_PREP(   Gra_Prepare_Flu( lv, PTR_P( h_Flu_Array_G ), PTR_P( h_DE_Array_G ), PTR_P( h_Emag_Array_G ),
                                          NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
          if ( OPT__SELF_GRAVITY  ||  OPT__EXT_POT )
-         TIMING_SYNC(   Gra_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Gra_Prepare_Pot( lv, TimeNew, PTR_P( h_Pot_Array_P_Out ), NPG, PID0_List ),
                         Timer_Poi_PrePot_F[lv]   );
 
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu()
          if ( OPT__EXT_ACC )
-         TIMING_SYNC(   Gra_Prepare_Corner( lv, h_Corner_Array_PGT[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Gra_Prepare_Corner( lv, PTR_P( h_Corner_Array_PGT ), NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
 #        ifdef UNSPLIT_GRAVITY
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu()
-         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID],
+         TIMING_PREP(   Gra_Prepare_USG( lv, TimeOld, PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ),
                         NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 #        endif
@@ -358,25 +462,25 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 
       case POISSON_AND_GRAVITY_SOLVER :
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, h_Rho_Array_P[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Poi_Prepare_Rho( lv, TimeNew, PTR_P( h_Rho_Array_P ), NPG, PID0_List ),
                         Timer_Poi_PreRho[lv]   );
 
          if ( OPT__SELF_GRAVITY )
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Poi_Prepare_Pot( lv, TimeNew, PTR_P( h_Pot_Array_P_In ), NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
 
-         TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
+         TIMING_PREP(   Gra_Prepare_Flu( lv, PTR_P( h_Flu_Array_G ), PTR_P( h_DE_Array_G ), PTR_P( h_Emag_Array_G ),
                                          NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu()
          if ( OPT__EXT_POT  ||  OPT__EXT_ACC )
-         TIMING_SYNC(   Gra_Prepare_Corner( lv, h_Corner_Array_PGT[ArrayID], NPG, PID0_List ),
+         TIMING_PREP(   Gra_Prepare_Corner( lv, PTR_P( h_Corner_Array_PGT ), NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
 #        ifdef UNSPLIT_GRAVITY
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu()
-         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID],
+         TIMING_PREP(   Gra_Prepare_USG( lv, TimeOld, PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ),
                         NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 #        endif
@@ -404,7 +508,7 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 #     endif
 
       case SRC_SOLVER:
-         Src_Prepare( lv, TimeNew, h_Flu_Array_S_In[ArrayID], h_Mag_Array_S_In[ArrayID], h_Corner_Array_S[ArrayID],
+         Src_Prepare( lv, TimeNew, PTR_P( h_Flu_Array_S_In ), PTR_P( h_Mag_Array_S_In ), PTR_P( h_Corner_Array_S ),
                       NPG, PID0_List );
       break;
 
@@ -437,11 +541,12 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 //                TimeOld   : Physical time before update   (for external gravity with UNSPLIT_GRAVITY)
 //                NPG       : Number of patch groups to be updated at a time
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                PG0       : Index of the first patch group to load and store data in the target arrays
 //                dt        : Time interval to advance solution (for the fluid, gravity, and Grackle solvers)
 //                Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
 //-------------------------------------------------------------------------------------------------------
 void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-             const int NPG, const int ArrayID, const double dt, const double Poi_Coeff )
+             const int NPG, const int ArrayID, const int PG0, const double dt, const double Poi_Coeff )
 {
 
    const double dh = amr->dh[lv];
@@ -534,10 +639,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case FLUID_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_FluidSolver( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
-                                 h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
-                                 h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+         CUAPI_Asyn_FluidSolver( PTR_PG( h_Flu_Array_F_In ), PTR_PG( h_Flu_Array_F_Out ),
+                                 PTR_PG( h_Mag_Array_F_In ), PTR_PG( h_Mag_Array_F_Out ),
+                                 PTR_PG( h_DE_Array_F_Out ), PTR_PG( h_Flux_Array ), PTR_PG( h_Ele_Array ),
+                                 PTR_PG( h_Corner_Array_F ), PTR_PG( h_Pot_Array_USG_F ),
                                  NPG, dt, dh, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ,
                                  OPT__LR_LIMITER, MINMOD_COEFF, MINMOD_MAX_ITER,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
@@ -548,10 +653,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  JEANS_MIN_PRES, JeansMinPres_Coeff,
                                  GPU_NSTREAM );
 #        else
-         CPU_FluidSolver       ( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
-                                 h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
-                                 h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+         CPU_FluidSolver       ( PTR_PG( h_Flu_Array_F_In ), PTR_PG( h_Flu_Array_F_Out ),
+                                 PTR_PG( h_Mag_Array_F_In ), PTR_PG( h_Mag_Array_F_Out ),
+                                 PTR_PG( h_DE_Array_F_Out ), PTR_PG( h_Flux_Array ), PTR_PG( h_Ele_Array ),
+                                 PTR_PG( h_Corner_Array_F ), PTR_PG( h_Pot_Array_USG_F ),
                                  NPG, dt, dh, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ,
                                  OPT__LR_LIMITER, MINMOD_COEFF, MINMOD_MAX_ITER,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
@@ -559,7 +664,7 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx,
                                  OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar, PassiveIntFrac_VarIdx,
-                                 JEANS_MIN_PRES, JeansMinPres_Coeff );
+                                 JEANS_MIN_PRES, JeansMinPres_Coeff, PG0 );
 #        endif
       break;
 
@@ -568,8 +673,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case POISSON_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_PoissonGravitySolver( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], NULL, h_Corner_Array_PGT[ArrayID],
+         CUAPI_Asyn_PoissonGravitySolver( PTR_P( h_Rho_Array_P ), PTR_P( h_Pot_Array_P_In ),
+                                          PTR_P( h_Pot_Array_P_Out ), NULL, PTR_P( h_Corner_Array_PGT ),
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
@@ -579,8 +684,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           TimeNew, TimeOld, NULL_REAL,
                                           GPU_NSTREAM );
 #        else
-         CPU_PoissonGravitySolver       ( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], NULL, h_Corner_Array_PGT[ArrayID],
+         CPU_PoissonGravitySolver       ( PTR_P( h_Rho_Array_P ), PTR_P( h_Pot_Array_P_In ),
+                                          PTR_P( h_Pot_Array_P_Out ), NULL, PTR_P( h_Corner_Array_PGT ),
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
@@ -596,9 +701,9 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
 #        ifdef GPU
          CUAPI_Asyn_PoissonGravitySolver( NULL, NULL,
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_PGT[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_Emag_Array_G[ArrayID],
+                                          PTR_P( h_Pot_Array_P_Out ), PTR_P( h_Flu_Array_G ), PTR_P( h_Corner_Array_PGT ),
+                                          PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ), PTR_P( h_DE_Array_G ),
+                                          PTR_P( h_Emag_Array_G ),
                                           NPG, dt, dh, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
@@ -608,9 +713,9 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           GPU_NSTREAM );
 #        else
          CPU_PoissonGravitySolver       ( NULL, NULL,
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_PGT[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_Emag_Array_G[ArrayID],
+                                          PTR_P( h_Pot_Array_P_Out ), PTR_P( h_Flu_Array_G ), PTR_P( h_Corner_Array_PGT ),
+                                          PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ), PTR_P( h_DE_Array_G ),
+                                          PTR_P( h_Emag_Array_G ),
                                           NPG, dt, dh, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
@@ -624,10 +729,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case POISSON_AND_GRAVITY_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_PoissonGravitySolver( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_PGT[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_Emag_Array_G[ArrayID],
+         CUAPI_Asyn_PoissonGravitySolver( PTR_P( h_Rho_Array_P ), PTR_P( h_Pot_Array_P_In ),
+                                          PTR_P( h_Pot_Array_P_Out ), PTR_P( h_Flu_Array_G ), PTR_P( h_Corner_Array_PGT ),
+                                          PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ), PTR_P( h_DE_Array_G ),
+                                          PTR_P( h_Emag_Array_G ),
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
@@ -636,10 +741,10 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           TimeNew, TimeOld, MIN_EINT,
                                           GPU_NSTREAM );
 #        else
-         CPU_PoissonGravitySolver       ( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_PGT[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_Emag_Array_G[ArrayID],
+         CPU_PoissonGravitySolver       ( PTR_P( h_Rho_Array_P ), PTR_P( h_Pot_Array_P_In ),
+                                          PTR_P( h_Pot_Array_P_Out ), PTR_P( h_Flu_Array_G ), PTR_P( h_Corner_Array_PGT ),
+                                          PTR_P( h_Pot_Array_USG_G ), PTR_P( h_Flu_Array_USG_G ), PTR_P( h_DE_Array_G ),
+                                          PTR_P( h_Emag_Array_G ),
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
@@ -709,17 +814,17 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
       case SRC_SOLVER :
 #        ifdef GPU
-         CUAPI_Asyn_SrcSolver( h_Flu_Array_S_In [ArrayID],
-                               h_Flu_Array_S_Out[ArrayID],
-                               h_Mag_Array_S_In [ArrayID],
-                               h_Corner_Array_S [ArrayID],
+         CUAPI_Asyn_SrcSolver( PTR_P( h_Flu_Array_S_In ),
+                               PTR_P( h_Flu_Array_S_Out ),
+                               PTR_P( h_Mag_Array_S_In ),
+                               PTR_P( h_Corner_Array_S ),
                                SrcTerms, NPG, dt, dh, TimeNew, TimeOld, MIN_DENS, MIN_PRES, MIN_EINT,
                                GPU_NSTREAM );
 #        else
-         CPU_SrcSolver       ( h_Flu_Array_S_In [ArrayID],
-                               h_Flu_Array_S_Out[ArrayID],
-                               h_Mag_Array_S_In [ArrayID],
-                               h_Corner_Array_S [ArrayID],
+         CPU_SrcSolver       ( PTR_P( h_Flu_Array_S_In ),
+                               PTR_P( h_Flu_Array_S_Out ),
+                               PTR_P( h_Mag_Array_S_In ),
+                               PTR_P( h_Corner_Array_S ),
                                SrcTerms, NPG, dt, dh, TimeNew, TimeOld, MIN_DENS, MIN_PRES, MIN_EINT );
 #        endif
       break;
@@ -756,10 +861,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                NPG        : Number of patch groups to be evaluated at a time
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
+//                PG0        : Index of the first patch group to load data in the target arrays
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const int PG0, const double dt )
 {
 
 #  ifndef DUAL_ENERGY
@@ -780,24 +886,24 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                    h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, PTR_PG( h_Flux_Array ), PTR_PG( h_Ele_Array ),
+                    PTR_PG( h_Flu_Array_F_Out ), PTR_PG( h_Mag_Array_F_Out ), PTR_PG( h_DE_Array_F_Out ),
+                    NPG, PID0_List, PTR_PG( h_Flu_Array_F_In ), PTR_PG( h_Mag_Array_F_In ), dt );
       break;
 
 #     ifdef GRAVITY
       case POISSON_SOLVER :
-         Poi_Close( lv, SaveSg_Pot, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List );
+         Poi_Close( lv, SaveSg_Pot, PTR_P( h_Pot_Array_P_Out ), NPG, PID0_List );
       break;
 
       case GRAVITY_SOLVER :
-         Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
+         Gra_Close( lv, SaveSg_Flu, PTR_P( h_Flu_Array_G ), PTR_P( h_DE_Array_G ), PTR_P( h_Emag_Array_G ),
                     NPG, PID0_List );
       break;
 
       case POISSON_AND_GRAVITY_SOLVER :
-         Poi_Close( lv, SaveSg_Pot, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List );
-         Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_Emag_Array_G[ArrayID],
+         Poi_Close( lv, SaveSg_Pot, PTR_P( h_Pot_Array_P_Out ), NPG, PID0_List );
+         Gra_Close( lv, SaveSg_Flu, PTR_P( h_Flu_Array_G ), PTR_P( h_DE_Array_G ), PTR_P( h_Emag_Array_G ),
                     NPG, PID0_List );
       break;
 #     endif
@@ -819,7 +925,7 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 #     endif
 
       case SRC_SOLVER :
-         Src_Close( lv, SaveSg_Flu, h_Flu_Array_S_Out[ArrayID], NPG, PID0_List );
+         Src_Close( lv, SaveSg_Flu, PTR_P( h_Flu_Array_S_Out ), NPG, PID0_List );
       break;
 
       default:
@@ -830,3 +936,153 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 } // FUNCTION : Closing_Step
 
 
+
+#ifndef GPU
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Fused_Step
+// Description :  Prepare, solve, and close one patch group at a time in each OpenMP thread
+//
+// Note        :  1. Invoked by InvokeSolver() for OPT__CPU_FUSED_SOLVER in CPU builds
+//                   --> Supported solvers: FLUID_SOLVER (without MHD), POISSON_SOLVER, GRAVITY_SOLVER,
+//                       POISSON_AND_GRAVITY_SOLVER, and SRC_SOLVER
+//                   --> MHD is excluded since CorrectElectric() in Flu_Close() may update the same coarse-grid
+//                       edges from different patch groups
+//                2. Each thread works on its own slot PG0=TID of the ArrayID=0 solver arrays (e.g., h_Flu_Array_F_In)
+//                   --> The input data of a patch group are still in cache when being solved and closed, instead of
+//                       going through main memory three times for NPG_Max patch groups
+//                   --> Patch groups are still distributed dynamically by "schedule( runtime )"
+//                3. Nested OpenMP parallel regions in the preparation, solver, and closing steps run with a single thread
+//                4. Only Timer_Sol is used for the entire pass (by the caller)
+//                5. For OPT__LB_MEASURED_COST, record the time spent on each patch group
+//                   --> Divided by the number of threads to convert it to the share of the wall-clock time, which is the
+//                       unit adopted by the batched solvers and Par_UpdateParticle()
+//                   --> Same factor for all patch groups, so it does not affect their relative workload
+//                6. Also invoked when OPT__LB_MEASURED_COST is on even if OPT__CPU_FUSED_SOLVER is off
+//
+// Parameter   :  TSolver    : Target solver
+//                lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                Poi_Coeff  : Coefficient in front of the RHS in the Poisson eq.
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                SaveSg_Mag : Sandglass to store the updated B field
+//                SaveSg_Pot : Sandglass to store the updated potential data
+//                NTotal     : Total number of patch groups to be updated
+//                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
+//                NPG_Max    : Maximum number of patch groups in the solver arrays
+//                             --> The number of threads is capped by NPG_Max
+//-------------------------------------------------------------------------------------------------------
+void Fused_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                 const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                 const int NTotal, const int *PID0_List, const int NPG_Max )
+{
+
+   const int ArrayID = 0;
+   const int NThread = MAX( 1, MIN( OMP_NTHREAD, NPG_Max ) );
+
+
+#  pragma omp parallel num_threads( NThread )
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+
+//    serialize the nested parallel regions
+      omp_set_num_threads( 1 );
+#     else
+      const int TID = 0;
+#     endif
+
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NTotal; t++)
+      {
+#        ifdef LOAD_BALANCE
+         double Cost = 0.0;
+#        endif
+
+         MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, 1, PID0_List+t, ArrayID, TID, false ), Cost );
+         MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, 1, ArrayID, TID, dt, Poi_Coeff ), Cost );
+         MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot, 1, PID0_List+t, ArrayID, TID, dt ),
+                       Cost );
+
+#        ifdef LOAD_BALANCE
+         if ( OPT__LB_MEASURED_COST )
+            LB_RecordMeasuredCost( lv, 1, PID0_List+t, Cost/NThread );
+#        endif
+      } // for (int t=0; t<NTotal; t++)
+   } // OpenMP parallel region
+
+} // FUNCTION : Fused_Step
+
+
+
+#ifdef LOAD_BALANCE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Measured_Step
+// Description :  Prepare and solve one patch group at a time in each OpenMP thread and then close the patch groups
+//                one by one in order to measure the workload of each patch group
+//
+// Note        :  1. Invoked by InvokeSolver() for OPT__LB_MEASURED_COST in CPU builds
+//                   --> Only for the solvers supporting PG0 but not supported by Fused_Step(), which is
+//                       currently FLUID_SOLVER with MHD
+//                2. Go through NPG_Max patch groups at a time, where the t-th patch group is stored in the slot
+//                   PG0=t of the ArrayID=0 solver arrays
+//                3. The closing step is invoked serially for each patch group since CorrectElectric() in Flu_Close()
+//                   may update the same coarse-grid edges from different patch groups
+//                   --> Include, for example, the time spent on correcting unphysical cells
+//                4. Only Timer_Sol is used for the entire pass (by the caller)
+//                5. The time spent on preparing and solving each patch group is divided by the number of threads
+//                   as in Fused_Step(), while the serial closing time is recorded as is
+//
+// Parameter   :  See Fused_Step()
+//-------------------------------------------------------------------------------------------------------
+void Measured_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                    const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                    const int NTotal, const int *PID0_List, const int NPG_Max )
+{
+
+   const int ArrayID = 0;
+   const int NThread = MAX( 1, MIN( OMP_NTHREAD, NPG_Max ) );
+
+   double *Cost = new double [NPG_Max];
+
+
+   for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+   {
+      const int NPG = MIN( NPG_Max, NTotal-Disp );
+
+//    1. prepare and solve one patch group at a time in each thread
+#     pragma omp parallel num_threads( NThread )
+      {
+//       serialize the nested parallel regions
+#        ifdef OPENMP
+         omp_set_num_threads( 1 );
+#        endif
+
+#        pragma omp for schedule( runtime )
+         for (int t=0; t<NPG; t++)
+         {
+            Cost[t] = 0.0;
+
+            MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, 1, PID0_List+Disp+t, ArrayID, t, false ), Cost[t] );
+            MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, 1, ArrayID, t, dt, Poi_Coeff ), Cost[t] );
+
+            Cost[t] /= NThread;
+         }
+      } // OpenMP parallel region
+
+//    2. close the patch groups one by one
+      for (int t=0; t<NPG; t++)
+      {
+         MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot, 1, PID0_List+Disp+t, ArrayID, t, dt ),
+                       Cost[t] );
+
+         LB_RecordMeasuredCost( lv, 1, PID0_List+Disp+t, Cost[t] );
+      }
+   } // for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+
+   delete [] Cost;
+
+} // FUNCTION : Measured_Step
+#endif // #ifdef LOAD_BALANCE
+#endif // #ifndef GPU
@@ -59,8 +59,10 @@ int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NLEVEL, OPT__UM_IC_NVAR, OPT__
 int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
 int                  OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
-bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_USER, OPT__DT_FLU_CACHE, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__PATCH_SLAB;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
+bool                 OPT__INT_CACHE;
 bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
@@ -69,6 +71,9 @@ bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID,
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
 bool                 OPT__INT_FRAC_PASSIVE_LR, OPT__CK_INPUT_FLUID, OPT__SORT_PATCH_BY_LBIDX;
+bool                 OPT__OUTPUT_HDF5_COLLECTIVE, OPT__OUTPUT_HDF5_AGGREGATE, OPT__OUTPUT_HDF5_ASYNC;
+bool                 OPT__CPU_FUSED_SOLVER;
+double               OUTPUT_HDF5_ASYNC_MAX_MEM;
 char                 OPT__OUTPUT_TEXT_FORMAT_FLT[MAX_STRING];
 int                  OPT__UM_IC_FLOAT8;
 double               COM_CEN_X, COM_CEN_Y, COM_CEN_Z, COM_MAX_R, COM_MIN_RHO, COM_TOLERR_R;
@@ -152,9 +157,12 @@ double               NEWTON_G;
 int                  POT_GPU_NPGROUP;
 bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS;
 double               SOR_OMEGA;
-int                  SOR_MAX_ITER, SOR_MIN_ITER;
+int                  SOR_MAX_ITER, SOR_MIN_ITER, SOR_CHECK_INTERVAL;
 double               MG_TOLERATED_ERROR;
 int                  MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH;
+bool                 OPT__POI_LEVEL_MG;
+int                  POI_LEVEL_MG_MAX_ITER, POI_LEVEL_MG_NPRE_SMOOTH, POI_LEVEL_MG_NPOST_SMOOTH;
+double               POI_LEVEL_MG_TOLERATED_ERROR;
 char                 EXT_POT_TABLE_NAME[MAX_STRING];
 double               EXT_POT_TABLE_DH[3], EXT_POT_TABLE_EDGEL[3];
 int                  EXT_POT_TABLE_NPOINT[3], EXT_POT_TABLE_FLOAT8;
@@ -189,11 +197,12 @@ double               LB_INPUT__WLI_MAX;
 #ifdef PARTICLE
 double               LB_INPUT__PAR_WEIGHT;
 #endif
-bool                 OPT__RECORD_LOAD_BALANCE;
+bool                 OPT__RECORD_LOAD_BALANCE, OPT__SPARSE_MPI_EXCHANGE, OPT__LB_MEASURED_COST;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
 int                  OPT__FFTW_STARTUP;
+bool                 OPT__FFTW_PENCIL;
 #if ( SUPPORT_FFTW == FFTW3 )
 bool                 FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #endif // # if ( SUPPORT_FFTW == FFTW3 )
@@ -704,6 +713,9 @@ int main( int argc, char *argv[] )
       Timer_Main[5]->Start();    // timer for load balance
 #     endif
 
+//    average the workload measured in this step over root-level steps
+      if ( OPT__LB_MEASURED_COST )  LB_UpdateMeasuredCost();
+
       if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
       {
          if ( MPI_Rank == 0 )
@@ -740,7 +752,16 @@ int main( int argc, char *argv[] )
 //    ---------------------------------------------------------------------------------------------------
 
 
-//    7. record timing
+//    7. reorder the particle repository
+//    ---------------------------------------------------------------------------------------------------
+#     ifdef PARTICLE
+      if ( amr->Par->SortInterval > 0  &&  Step % amr->Par->SortInterval == 0 )
+      TIMING_FUNC(   Par_SortParticle(),              Timer_Main[1],   TIMER_ON   );
+#     endif
+//    ---------------------------------------------------------------------------------------------------
+
+
+//    8. record timing
 //    ---------------------------------------------------------------------------------------------------
 #     ifdef TIMING
       MPI_Barrier( MPI_COMM_WORLD );
@@ -28,6 +28,35 @@ bool ParDensArray_Initialized = false;
 #endif
 
 
+// cache of the coarse-fine ghost-zone interpolation results (OPT__INT_CACHE)
+// --> IntCache[lv][ PID*26 + FSide ] is a linked list storing the results of InterpolateGhostZone() for the
+//     coarse patch PID at level lv and the fine-patch sibling direction FSide
+// --> one entry per key since the same coarse patch can be requested with different target variables,
+//     ghost-zone sizes, interpolation schemes, and physical times
+// --> see Prepare_PatchData_InitIntCache()
+struct IntCache_t
+{
+   double       PrepTime;
+   double       MonoCoeff;
+   long         TVarCC;
+   int          GhostSize;
+   IntScheme_t  IntScheme_CC;
+   bool         IntPhase;
+   bool         DE_Consistency;
+   real         MinPres, MinTemp, MinEntr;
+   long         Size;
+   real        *Data;
+   IntCache_t  *Next;
+};
+
+static IntCache_t **IntCache       [NLEVEL];
+static int          IntCache_NPatch[NLEVEL];
+
+static IntCache_t *IntCache_Find( const int lv, const int PID, const int FSide, const IntCache_t &Key );
+static void IntCache_Add( const int lv, const int PID, const int FSide, const IntCache_t &Key,
+                          const real *Data, const long Size );
+
+
 // check the divergence-free B field (for debug)
 #ifdef MHD
 //#  define MHD_CHECK_DIV_B
@@ -380,9 +409,11 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 // TVarFCIdxList    : list recording the target face-centered variable indices (e.g., [0 ... NCOMP_MAG-1])
    const int NVarCC_Der_Max = 20;   // increase it when the maximum number of derived fields exceeds it
    long TVarCCList_Der[NVarCC_Der_Max];
-   int  NTSib[26], *TSib[26], NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
+   int  NTSib[26], TSib_Data[26][17], *TSib[26], NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
 
 // set up the target sibling indices for InterpolateGhostZone()
+   for (int s=0; s<26; s++)   TSib[s] = TSib_Data[s];
+
    SetTargetSibling( NTSib, TSib );
 
 // determine the cell-centered fluid components to be prepared
@@ -527,6 +558,36 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
    }
 
 
+// key of the coarse-fine interpolation cache (OPT__INT_CACHE)
+// --> the cache is enabled only when it has been initialized for lv-1 by Prepare_PatchData_InitIntCache()
+// --> exclude face-centered variables since the divergence-preserving interpolation also depends on the
+//     fine-grid B field on the coarse-fine interfaces (FInterface)
+// --> exclude particle mass density since particles at lv-1 may be updated during the evolution of lv
+   bool UseIntCache = ( lv > 0  &&  GhostSize > 0  &&  NVarFC_Tot == 0  &&  IntCache[lv-1] != NULL );
+#  ifdef PARTICLE
+   if ( PrepParOnlyDens  ||  PrepTotalDens )    UseIntCache = false;
+#  endif
+
+   IntCache_t IntCacheKey;
+
+   if ( UseIntCache )
+   {
+      IntCacheKey.PrepTime       = PrepTime;
+      IntCacheKey.MonoCoeff      = INT_MONO_COEFF;
+      IntCacheKey.TVarCC         = TVarCC;
+      IntCacheKey.GhostSize      = GhostSize;
+      IntCacheKey.IntScheme_CC   = IntScheme_CC;
+      IntCacheKey.IntPhase       = IntPhase;
+      IntCacheKey.DE_Consistency = DE_Consistency;
+      IntCacheKey.MinPres        = MinPres;
+      IntCacheKey.MinTemp        = MinTemp;
+      IntCacheKey.MinEntr        = MinEntr;
+      IntCacheKey.Size           = NULL_INT;
+      IntCacheKey.Data           = NULL;
+      IntCacheKey.Next           = NULL;
+   }
+
+
 // constant settings used by Par_MassAssignment()
 #  ifdef MASSIVE_PARTICLES
    const bool InitZero_No       = false;
@@ -560,16 +621,20 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 //                   (including the ghost-zone data)
 //    --> for PrepUnit == UNIT_PATCHGROUP, these pointers point to OutputCC/FC directly (which will be set later)
 //        for PrepUnit == UNIT_PATCH, these arrays will be copied to different patches in OutputCC/FC later
-      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarCC_Tot*PGSize3D_CC ] : NULL;
+//    --> all temporary arrays in this function are taken from the per-thread scratch arena (see Mis_GetScratch())
+//        so that they are allocated only when a larger size than all previous calls is required
+      Mis_AcquireScratch();
+
+      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ? (real*)Mis_GetScratch( SCRATCH_PREP_CC, (long)NVarCC_Tot*PGSize3D_CC*sizeof(real) ) : NULL;
       real *Data1PG_CC_Ptr = NULL;
-      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarFC_Tot*PGSize3D_FC ] : NULL;
+      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ? (real*)Mis_GetScratch( SCRATCH_PREP_FC, (long)NVarFC_Tot*PGSize3D_FC*sizeof(real) ) : NULL;
       real *Data1PG_FC_Ptr = NULL;
 
 
 //    IntData_CC/FC: arrays to store the interpolated cell-/face-centered results
 //    --> allocate it only once but with the maximum required size to reduce the number of memory allocations
-      real *IntData_CC = new real [ NVarCC_Tot*PS2*PS2*(GhostSize_Padded  ) ];
-      real *IntData_FC = new real [ NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1) ];
+      real *IntData_CC = (real*)Mis_GetScratch( SCRATCH_PREP_INT_CC, (long)NVarCC_Tot*PS2*PS2*(GhostSize_Padded  )*sizeof(real) );
+      real *IntData_FC = (real*)Mis_GetScratch( SCRATCH_PREP_INT_FC, (long)NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1)*sizeof(real) );
 
 
 //    B field on the coarse-fine interfaces for the divergence-preserving interpolation
@@ -577,7 +642,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #     ifdef MHD
       real *FInterface_Data = NULL;
 
-      if ( NVarFC_Tot > 0 )   FInterface_Data = new real [ SQR(PS2) + 4*PS2*GhostSize_Padded ];
+      if ( NVarFC_Tot > 0 )
+         FInterface_Data = (real*)Mis_GetScratch( SCRATCH_PREP_FINT, (long)( SQR(PS2) + 4*PS2*GhostSize_Padded )*sizeof(real) );
 #     endif
 
 //    IntData_CC_IntTime: for temporal interpolation on density and phase in ELBDM
@@ -585,7 +651,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
       real *IntData_CC_IntTime = (  IntPhase  &&  OPT__INT_TIME  &&  lv > 0  &&
                                    !Mis_CompareRealValue( PrepTime, amr->FluSgTime[lv-1][  amr->FluSg[lv-1]], NULL, false )  &&
                                    !Mis_CompareRealValue( PrepTime, amr->FluSgTime[lv-1][1-amr->FluSg[lv-1]], NULL, false )  )
-                                 ? new real [ 2*PS2*PS2*GhostSize_Padded ] : NULL;
+                                 ? (real*)Mis_GetScratch( SCRATCH_PREP_INT_TIME, (long)2*PS2*PS2*GhostSize_Padded*sizeof(real) ) : NULL;
 #     else
       real *IntData_CC_IntTime = NULL;
 #     endif
@@ -1554,11 +1620,23 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //             (b2-3) perform interpolation and store the results in IntData_CC[] and IntData_FC[]
-               InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, IntData_CC_IntTime, Side, PrepTime, GhostSize,
-                                     IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
-                                     TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
-                                     IntPhase, FluBC, PotBC, BC_Face, MinPres, MinTemp, MinEntr, DE_Consistency,
-                                     (const real **)FInterface_Ptr );
+//                    --> reuse the cached results if available (OPT__INT_CACHE)
+               const long  IntSize_CC = (long)NVarCC_Tot*FSize[0]*FSize[1]*FSize[2];
+               IntCache_t *IntCacheHit = ( UseIntCache ) ? IntCache_Find( lv-1, FaSibPID, Side, IntCacheKey ) : NULL;
+
+               if ( IntCacheHit != NULL )
+                  memcpy( IntData_CC, IntCacheHit->Data, IntSize_CC*sizeof(real) );
+
+               else
+               {
+                  InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, IntData_CC_IntTime, Side, PrepTime, GhostSize,
+                                        IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
+                                        TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
+                                        IntPhase, FluBC, PotBC, BC_Face, MinPres, MinTemp, MinEntr, DE_Consistency,
+                                        (const real **)FInterface_Ptr );
+
+                  if ( UseIntCache )   IntCache_Add( lv-1, FaSibPID, Side, IntCacheKey, IntData_CC, IntSize_CC );
+               }
 
 
 //             (b2-4) copy cell-centered data from IntData_CC[] to Data1PG_CC[]
@@ -2111,25 +2189,10 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
       } // for (int TID=0; TID<NPG; TID++)
 
-      if ( PrepUnit == UNIT_PATCH )
-      {
-         delete [] Data1PG_CC;
-         delete [] Data1PG_FC;
-      }
-      delete [] IntData_CC;
-      delete [] IntData_FC;
-      delete [] IntData_CC_IntTime;
-
-#     ifdef MHD
-      delete [] FInterface_Data;
-#     endif
+      Mis_ReleaseScratch();
 
    } // end of OpenMP parallel region
 
-
-// free memroy
-   for (int s=0; s<26; s++)   delete [] TSib[s];
-
 } // FUNCTION : Prepare_PatchData
 
 
@@ -2567,7 +2630,7 @@ int Table_02( const int lv, const int PID, const int Side )
 // Description :  Set the target sibling directions for preparing the ghost-zone data at the coarse-grid level
 //
 // Note        :  1. Work for Prepare_PatchData()
-//                2. TSib needs to be deallocated manually
+//                2. TSib[s] must be allocated in advance with at least NTSib[s] (<= 17) elements
 //                3. Sibling directions recorded in TSib must be in ascending numerical order for filling the
 //                   non-periodic ghost-zone data in InterpolateGhostZone()
 //                   --> Therefore, this function CANNOT be applied in LB_RecordExchangeDataPatchID(), in which
@@ -2583,8 +2646,6 @@ void SetTargetSibling( int NTSib[], int *TSib[] )
    for (int t= 6; t<18; t++)  NTSib[t] = 11;
    for (int t=18; t<26; t++)  NTSib[t] =  7;
 
-   for (int s=0; s<26; s++)   TSib[s] = new int [ NTSib[s] ];
-
    TSib[ 0][ 0] =  1;
    TSib[ 0][ 1] =  2;
    TSib[ 0][ 2] =  3;
@@ -2905,6 +2966,156 @@ void SetTargetSibling( int NTSib[], int *TSib[] )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_InitIntCache
+// Description :  Initialize the cache of the coarse-fine ghost-zone interpolation results at level lv
+//                (OPT__INT_CACHE)
+//
+// Note        :  1. Invoked by EvolveLevel() right before evolving level lv+1
+//                   --> Data at level lv are fixed until EvolveLevel( lv+1, ... ) returns, except for the particles
+//                       at lv which are excluded from the cache by Prepare_PatchData()
+//                   --> Must call Prepare_PatchData_FreeIntCache() once level lv is modified again (e.g., by
+//                       Flu_FixUp_Restrict() and Flu_FixUp_Flux())
+//                2. Prepare_PatchData() at level lv+1 then stores the results of InterpolateGhostZone() for each
+//                   coarse patch and fine-patch sibling direction and reuses them for the identical requests
+//                   (e.g., the same PrepTime, target variables, ghost-zone size, and interpolation scheme)
+//                3. Apply to buffer patches as well
+//                4. Do nothing if OPT__INT_CACHE is off
+//
+// Parameter   :  lv : Target coarse-grid refinement level
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_InitIntCache( const int lv )
+{
+
+   if ( ! OPT__INT_CACHE )    return;
+
+// remove the previous cache
+   Prepare_PatchData_FreeIntCache( lv );
+
+   IntCache_NPatch[lv] = amr->NPatchComma[lv][27];
+   IntCache       [lv] = new IntCache_t* [ (long)IntCache_NPatch[lv]*26 ];
+
+   for (long t=0; t<(long)IntCache_NPatch[lv]*26; t++)   IntCache[lv][t] = NULL;
+
+} // FUNCTION : Prepare_PatchData_InitIntCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_FreeIntCache
+// Description :  Free the cache of the coarse-fine ghost-zone interpolation results at level lv
+//                (OPT__INT_CACHE)
+//
+// Note        :  1. Invoked by EvolveLevel() right after evolving level lv+1
+//                2. Prepare_PatchData() stops using the cache of level lv afterwards
+//
+// Parameter   :  lv : Target coarse-grid refinement level
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_FreeIntCache( const int lv )
+{
+
+   if ( IntCache[lv] == NULL )   return;
+
+   for (long t=0; t<(long)IntCache_NPatch[lv]*26; t++)
+   {
+      IntCache_t *Entry = IntCache[lv][t];
+
+      while ( Entry != NULL )
+      {
+         IntCache_t *Next = Entry->Next;
+
+         delete [] Entry->Data;
+         delete Entry;
+
+         Entry = Next;
+      }
+   }
+
+   delete [] IntCache[lv];
+
+   IntCache       [lv] = NULL;
+   IntCache_NPatch[lv] = 0;
+
+} // FUNCTION : Prepare_PatchData_FreeIntCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  IntCache_Find
+// Description :  Return the cached interpolation results matching the input key
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. Return NULL if no matching entry is found
+//
+// Parameter   :  lv    : Target coarse-grid refinement level
+//                PID   : Target coarse patch at level lv
+//                FSide : Fine-patch sibling index (0~25)
+//                Key   : Cache key (i.e., all input parameters of InterpolateGhostZone() that affect the results)
+//
+// Return      :  Pointer to the matching cache entry or NULL
+//-------------------------------------------------------------------------------------------------------
+IntCache_t *IntCache_Find( const int lv, const int PID, const int FSide, const IntCache_t &Key )
+{
+
+   if ( PID >= IntCache_NPatch[lv] )   return NULL;
+
+   for (IntCache_t *Entry=IntCache[lv][ (long)PID*26 + FSide ]; Entry!=NULL; Entry=Entry->Next)
+   {
+      if (  Entry->PrepTime       == Key.PrepTime      &&
+            Entry->MonoCoeff      == Key.MonoCoeff     &&
+            Entry->TVarCC         == Key.TVarCC        &&
+            Entry->GhostSize      == Key.GhostSize     &&
+            Entry->IntScheme_CC   == Key.IntScheme_CC  &&
+            Entry->IntPhase       == Key.IntPhase      &&
+            Entry->DE_Consistency == Key.DE_Consistency  &&
+            Entry->MinPres        == Key.MinPres       &&
+            Entry->MinTemp        == Key.MinTemp       &&
+            Entry->MinEntr        == Key.MinEntr          )
+         return Entry;
+   }
+
+   return NULL;
+
+} // FUNCTION : IntCache_Find
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  IntCache_Add
+// Description :  Store the interpolation results in the cache
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. Different OpenMP threads never access the same list concurrently since each pair of
+//                   coarse patch and fine-patch sibling direction corresponds to a single fine patch group
+//
+// Parameter   :  lv    : Target coarse-grid refinement level
+//                PID   : Target coarse patch at level lv
+//                FSide : Fine-patch sibling index (0~25)
+//                Key   : Cache key
+//                Data  : Interpolation results to be stored
+//                Size  : Number of elements in Data[]
+//-------------------------------------------------------------------------------------------------------
+void IntCache_Add( const int lv, const int PID, const int FSide, const IntCache_t &Key,
+                   const real *Data, const long Size )
+{
+
+   if ( PID >= IntCache_NPatch[lv] )   return;
+
+   IntCache_t *Entry = new IntCache_t;
+
+   *Entry       = Key;
+   Entry->Size  = Size;
+   Entry->Data  = new real [Size];
+   Entry->Next  = IntCache[lv][ (long)PID*26 + FSide ];
+
+   memcpy( Entry->Data, Data, Size*sizeof(real) );
+
+   IntCache[lv][ (long)PID*26 + FSide ] = Entry;
+
+} // FUNCTION : IntCache_Add
+
+
+
 #ifdef MASSIVE_PARTICLES
 
 // flag for checking whether Par_CollectParticle2OneLevel() has been called
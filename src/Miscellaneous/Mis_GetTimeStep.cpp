@@ -1,6 +1,11 @@
 #include "GAMER.h"
 
 
+// maximum signal speed recorded by the fluid solver for OPT__DT_FLU_CACHE (declared in Flu_AdvanceDt.cpp)
+#if ( MODEL == HYDRO )
+extern real Flu_MaxSpeed_ThisRank[NLEVEL];
+extern bool Flu_MaxSpeed_Valid   [NLEVEL];
+#endif
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -16,6 +21,9 @@
 //                       in the comoving coordinates, back to dt in EvolveLevel()
 //                2. For OPT__DT_USER, the function pointer "Mis_GetTimeStep_User_Ptr" must be set by a
 //                   test problem initializer
+//                3. For OPT__DT_FLU_CACHE, the hydro CFL criterion is estimated from the maximum signal speed
+//                   recorded by the last fluid update at lv (see Flu_Close()) when it is still valid
+//                   --> Skip the dt solver sweep over all patches at lv
 //
 // Parameter   :  lv                : Target refinement level
 //                dTime_SyncFaLv    : dt to synchronize lv and lv-1
@@ -62,7 +70,18 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
    if ( DT__SPEED_OF_LIGHT ) dTime[NdTime] = ( (Step==0)?DT__FLUID_INIT:DT__FLUID ) * amr->dh[lv];
    else                      dTime[NdTime] = dt_InvokeSolver( DT_FLU_SOLVER, lv );
 #  else
-   dTime[NdTime] = dt_InvokeSolver( DT_FLU_SOLVER, lv );
+   if ( OPT__DT_FLU_CACHE  &&  Flu_MaxSpeed_Valid[lv] )
+   {
+      real MaxSpeed_AllRank;
+
+      MPI_Allreduce( Flu_MaxSpeed_ThisRank+lv, &MaxSpeed_AllRank, 1, MPI_GAMER_REAL, MPI_MAX, MPI_COMM_WORLD );
+
+      dTime[NdTime] = ( MaxSpeed_AllRank > (real)0.0 ) ? ( (Step==0)?DT__FLUID_INIT:DT__FLUID )*amr->dh[lv]/MaxSpeed_AllRank
+                                                       : HUGE_NUMBER;
+   }
+
+   else
+      dTime[NdTime] = dt_InvokeSolver( DT_FLU_SOLVER, lv );
 #  endif
    dTime[NdTime] *= dTime_dt;
    sprintf( dTime_Name[NdTime++], "%s", "Hydro_CFL" );
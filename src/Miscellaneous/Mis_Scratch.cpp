@@ -0,0 +1,222 @@
+#include "GAMER.h"
+
+
+// scratch arena
+struct Scratch_t
+{
+   void      *Ptr [NSCRATCH];  // buffer of each slot
+   long       Size[NSCRATCH];  // allocated size of each slot in bytes
+   long       NAlloc;          // number of (re)allocations so far
+   Scratch_t *Prev;            // arena held by the same thread before this one (for nested acquisitions)
+};
+
+// arena currently held by the calling thread
+// --> use threadprivate instead of an array indexed by omp_get_thread_num() since the callers can be invoked
+//     in different (and nested) parallel regions simultaneously, where omp_get_thread_num() is not unique
+static Scratch_t *Scratch_ThisThread = NULL;
+#ifdef OPENMP
+#pragma omp threadprivate( Scratch_ThisThread )
+#endif
+
+// Scratch_List: all arenas ever created (for Mis_GetScratchInfo() and Mis_FreeScratch())
+// Scratch_Pool: arenas not held by any thread
+static Scratch_t **Scratch_List = NULL;
+static Scratch_t **Scratch_Pool = NULL;
+static int         Scratch_NList = 0, Scratch_NPool = 0, Scratch_MaxList = 0;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_AcquireScratch
+// Description :  Assign a scratch arena to the calling thread
+//
+// Note        :  1. Must be called by each OpenMP thread before Mis_GetScratch() and be paired with
+//                   Mis_ReleaseScratch() before leaving the parallel region
+//                   --> Arenas are recycled between parallel regions instead of being bound to the OS threads,
+//                       which is necessary since threads of nested parallel regions may be created and destroyed
+//                       by the OpenMP runtime on every entry
+//                2. Reuse an idle arena if there is any; otherwise create a new one
+//                   --> The number of arenas equals the maximum number of threads holding one at the same time
+//                3. Nested acquisitions by the same thread are allowed
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_AcquireScratch()
+{
+
+   Scratch_t *Arena = NULL;
+
+#  pragma omp critical( Mis_Scratch )
+   {
+      if ( Scratch_NPool > 0 )   Arena = Scratch_Pool[ -- Scratch_NPool ];
+
+      else
+      {
+         Arena = new Scratch_t;
+
+         for (int s=0; s<NSCRATCH; s++)
+         {
+            Arena->Ptr [s] = NULL;
+            Arena->Size[s] = 0L;
+         }
+         Arena->NAlloc = 0L;
+
+         if ( Scratch_NList >= Scratch_MaxList )
+         {
+            Scratch_MaxList = MAX( 2*Scratch_MaxList, 16 );
+            Scratch_List    = (Scratch_t**)realloc( Scratch_List, Scratch_MaxList*sizeof(Scratch_t*) );
+            Scratch_Pool    = (Scratch_t**)realloc( Scratch_Pool, Scratch_MaxList*sizeof(Scratch_t*) );
+         }
+
+         Scratch_List[ Scratch_NList ++ ] = Arena;
+      }
+   } // # pragma omp critical
+
+   Arena->Prev        = Scratch_ThisThread;
+   Scratch_ThisThread = Arena;
+
+} // FUNCTION : Mis_AcquireScratch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_ReleaseScratch
+// Description :  Return the scratch arena of the calling thread to the pool
+//
+// Note        :  1. Buffers are NOT deallocated and will be reused by the next Mis_AcquireScratch()
+//                2. Pointers returned by Mis_GetScratch() become invalid after this call
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_ReleaseScratch()
+{
+
+   Scratch_t *Arena = Scratch_ThisThread;
+
+#  ifdef GAMER_DEBUG
+   if ( Arena == NULL )    Aux_Error( ERROR_INFO, "no scratch arena to be released !!\n" );
+#  endif
+
+   Scratch_ThisThread = Arena->Prev;
+   Arena->Prev        = NULL;
+
+#  pragma omp critical( Mis_Scratch )
+   {
+      Scratch_Pool[ Scratch_NPool ++ ] = Arena;
+   }
+
+} // FUNCTION : Mis_ReleaseScratch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_GetScratch
+// Description :  Return a scratch buffer with at least the requested size from the arena of the calling thread
+//
+// Note        :  1. Used by Prepare_PatchData(), InterpolateGhostZone(), and Par_MassAssignment() to avoid
+//                   allocating and deallocating temporary arrays for every call
+//                2. Must be called between Mis_AcquireScratch() and Mis_ReleaseScratch()
+//                   --> Thread-safe without any lock
+//                3. Each slot (e.g., SCRATCH_PREP_CC) is reallocated only when the current size is not large enough
+//                   --> Arenas eventually sustain the largest request so far and are reused by all subsequent
+//                       calls from all solvers
+//                   --> The previous content is NOT preserved after reallocation
+//                4. Call Mis_FreeScratch() to free memory
+//
+// Parameter   :  Slot : Target scratch slot defined in Typedef.h (e.g., SCRATCH_PREP_CC)
+//                Size : Required size in bytes
+//
+// Return      :  Pointer to the scratch buffer (NULL if Size <= 0)
+//-------------------------------------------------------------------------------------------------------
+void *Mis_GetScratch( const ScratchSlot_t Slot, const long Size )
+{
+
+   Scratch_t *Arena = Scratch_ThisThread;
+
+#  ifdef GAMER_DEBUG
+   if ( Arena == NULL )                   Aux_Error( ERROR_INFO, "Mis_AcquireScratch() has not been called !!\n" );
+   if ( Slot < 0  ||  Slot >= NSCRATCH )  Aux_Error( ERROR_INFO, "incorrect scratch slot (%d) !!\n", Slot );
+   if ( Size < 0L )                       Aux_Error( ERROR_INFO, "Size (%ld) < 0 !!\n", Size );
+#  endif
+
+   if ( Size <= 0L )    return NULL;
+
+   if ( Size > Arena->Size[Slot] )
+   {
+      if ( Arena->Ptr[Slot] != NULL )  ::operator delete (Arena->Ptr[Slot]);
+
+      Arena->Ptr [Slot] = ::operator new (Size);
+      Arena->Size[Slot] = Size;
+      Arena->NAlloc ++;
+   }
+
+   return Arena->Ptr[Slot];
+
+} // FUNCTION : Mis_GetScratch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_GetScratchInfo
+// Description :  Get the total size and the number of allocations of all scratch arenas
+//
+// Note        :  1. Invoked by Aux_GetMemInfo()
+//                2. Since arenas never shrink, NByte is also the peak scratch memory of this process
+//                3. Must NOT be called inside an OpenMP parallel region using the scratch arenas
+//
+// Parameter   :  NByte  : Total size of all arenas in bytes
+//                NAlloc : Total number of (re)allocations
+//
+// Return      :  NByte, NAlloc
+//-------------------------------------------------------------------------------------------------------
+void Mis_GetScratchInfo( long &NByte, long &NAlloc )
+{
+
+   NByte  = 0L;
+   NAlloc = 0L;
+
+   for (int t=0; t<Scratch_NList; t++)
+   {
+      for (int s=0; s<NSCRATCH; s++)   NByte += Scratch_List[t]->Size[s];
+
+      NAlloc += Scratch_List[t]->NAlloc;
+   }
+
+} // FUNCTION : Mis_GetScratchInfo
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_FreeScratch
+// Description :  Free all scratch arenas
+//
+// Note        :  1. Invoked by End_MemFree()
+//                2. All arenas must have been released by Mis_ReleaseScratch()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_FreeScratch()
+{
+
+   if ( Scratch_NPool != Scratch_NList )
+      Aux_Error( ERROR_INFO, "%d scratch arena(s) have not been released !!\n", Scratch_NList-Scratch_NPool );
+
+   for (int t=0; t<Scratch_NList; t++)
+   {
+      for (int s=0; s<NSCRATCH; s++)
+         if ( Scratch_List[t]->Ptr[s] != NULL )    ::operator delete (Scratch_List[t]->Ptr[s]);
+
+      delete Scratch_List[t];
+   }
+
+   free( Scratch_List );
+   free( Scratch_Pool );
+
+   Scratch_List    = NULL;
+   Scratch_Pool    = NULL;
+   Scratch_NList   = 0;
+   Scratch_NPool   = 0;
+   Scratch_MaxList = 0;
+
+} // FUNCTION : Mis_FreeScratch
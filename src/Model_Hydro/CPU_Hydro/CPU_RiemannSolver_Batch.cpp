@@ -0,0 +1,468 @@
+#include "CUFLU.h"
+#include "EoS_Policy.h"
+
+#if ( MODEL == HYDRO  &&  defined RSOLVER_BATCH )
+
+
+
+// vectorize the loops over interfaces only when the EoS can be inlined
+// --> other EoS routines are invoked through EOS_CALL (see EoS_Policy.h) lane by lane, which is not vectorized
+#if ( EOS == EOS_GAMMA  ||  EOS == EOS_ISOTHERMAL )
+#  define EOS_INLINE
+#endif
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Con2PresCSqr_Batch
+// Description :  Compute the gas pressure and sound speed squared of a batch of conserved states
+//
+// Note        :  1. Invoked by Hydro_RiemannSolver_HLLC_Batch() and Hydro_RiemannSolver_HLLE_Batch()
+//                2. Same as Hydro_Con2Pres() + EoS_DensPres2CSqr() except that the pressure floor is applied by
+//                   an inlined version of Hydro_CheckMinPres()
+//                3. EOS_GAMMA and EOS_ISOTHERMAL are inlined and vectorized. Other EoSs are invoked through
+//                   EOS_CALL lane by lane.
+//                4. Input states are in the original (i.e., non-rotated) order, while the kinetic and magnetic
+//                   energies are summed in the rotated order to be consistent with the scalar solvers
+//
+// Parameter   :  NBatch            : Number of interfaces in the batch
+//                iN/T1/T2          : Indices of the normal and transverse momentum components
+//                bN/T1/T2          : Indices of the normal and transverse B field components (for MHD only)
+//                In                : Input conserved states
+//                Pres              : Array to store the output pressure
+//                CSqr              : Array to store the output sound speed squared
+//                MinPres           : Pressure floor
+//                EoS_DensEint2Pres : EoS routine to compute the gas pressure
+//                EoS_DensPres2CSqr : EoS routine to compute the sound speed squared
+//                EoS_AuxArray_*    : Auxiliary arrays for the EoS routines
+//                EoS_Table         : EoS tables
+//
+// Return      :  Pres[], CSqr[]
+//-------------------------------------------------------------------------------------------------------
+static void Hydro_Con2PresCSqr_Batch( const int NBatch, const int iN, const int iT1, const int iT2,
+                                      const int bN, const int bT1, const int bT2,
+                                      const real In[][RSOLVER_NBATCH], real Pres[], real CSqr[], const real MinPres,
+                                      const EoS_DE2P_t EoS_DensEint2Pres, const EoS_DP2C_t EoS_DensPres2CSqr,
+                                      const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
+                                      const real* const EoS_Table[EOS_NTABLE_MAX] )
+{
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2_Iso  = (real)EoS_AuxArray_Flt[0];
+#  endif
+
+#  ifdef EOS_INLINE
+#  pragma omp simd
+#  endif
+   for (int b=0; b<NBatch; b++)
+   {
+      const real Dens = In[0][b];
+      real Eint, P;
+
+//    internal energy (see Hydro_Con2Eint())
+      Eint  = In[4][b] - (real)0.5*( SQR(In[iN][b]) + SQR(In[iT1][b]) + SQR(In[iT2][b]) ) / Dens;
+#     ifdef MHD
+      Eint -= (real)0.5*(  SQR( In[bN][b] ) + ( SQR( In[bT1][b] ) + SQR( In[bT2][b] ) )  );
+#     endif
+
+#     if   ( EOS == EOS_GAMMA )
+      P       = Eint*Gamma_m1;
+      P       = ( P == P ) ? MAX( P, MinPres ) : P;
+      CSqr[b] = Gamma*P/Dens;
+
+#     elif ( EOS == EOS_ISOTHERMAL )
+      P       = Cs2_Iso*Dens;
+      P       = ( P == P ) ? MAX( P, MinPres ) : P;
+      CSqr[b] = Cs2_Iso;
+
+#     else
+      real Passive[ MAX(NCOMP_PASSIVE,1) ];
+
+      for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = In[ NCOMP_FLUID + v ][b];
+
+      P       = EOS_CALL( DensEint2Pres, EoS_DensEint2Pres )( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+      P       = ( P == P ) ? MAX( P, MinPres ) : P;
+      CSqr[b] = EOS_CALL( DensPres2CSqr, EoS_DensPres2CSqr )( Dens, P, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+#     endif
+
+      Pres[b] = P;
+   } // for (int b=0; b<NBatch; b++)
+
+
+#  ifdef CHECK_UNPHYSICAL_IN_FLUID
+   for (int b=0; b<NBatch; b++)
+   {
+      Hydro_IsUnphysical( UNPHY_MODE_SING, &In[0][b], "density",
+                          TINY_NUMBER, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                          ERROR_INFO, UNPHY_VERBOSE );
+      Hydro_IsUnphysical( UNPHY_MODE_SING, &Pres[b], "pressure",
+                          (real)0.0, HUGE_NUMBER, NULL_REAL, NULL, NULL, NULL, NULL, NULL, NULL,
+                          ERROR_INFO, UNPHY_VERBOSE );
+   }
+#  endif
+
+} // FUNCTION : Hydro_Con2PresCSqr_Batch
+
+
+
+#if ( RSOLVER == HLLC )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLC_Batch
+// Description :  Batched version of Hydro_RiemannSolver_HLLC() solving multiple interfaces per call
+//
+// Note        :  1. Input and output arrays use the SoA layout [NCOMP_TOTAL_PLUS_MAG][RSOLVER_NBATCH] so that the
+//                   loop over interfaces can be vectorized
+//                   --> The SIMD instruction set is selected by the compile-time option SIMD
+//                2. Input data should be conserved variables in the original (i.e., non-rotated) order
+//                   --> Spatial rotation is done through index mapping instead of data movement
+//                3. Only support HLLC_WAVESPEED == HLL_WAVESPEED_DAVIS and the HD version
+//                4. Same algorithm as Hydro_RiemannSolver_HLLC() but with all branches converted to selections
+//                5. Invoked by Hydro_ComputeFlux() when RSOLVER_BATCH is on
+//
+// Parameter   :  XYZ               : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NBatch            : Number of interfaces in the batch (<= RSOLVER_NBATCH)
+//                Flux_Out          : Array to store the output fluxes
+//                L/R_In            : Input left/right states (conserved variables)
+//                MinDens/Pres      : Density and pressure floors
+//                EoS_DensEint2Pres : EoS routine to compute the gas pressure
+//                EoS_DensPres2CSqr : EoS routine to compute the sound speed squared
+//                EoS_AuxArray_*    : Auxiliary arrays for the EoS routines
+//                EoS_Table         : EoS tables
+//
+// Return      :  Flux_Out[]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NBatch, real Flux_Out[][RSOLVER_NBATCH],
+                                     const real L_In[][RSOLVER_NBATCH], const real R_In[][RSOLVER_NBATCH],
+                                     const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                     const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                                     const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] )
+{
+
+// 1. indices of the normal and transverse momentum components (see Hydro_Rotate3D())
+   const int iN  = 1 + (XYZ  )%3;
+   const int iT1 = 1 + (XYZ+1)%3;
+   const int iT2 = 1 + (XYZ+2)%3;
+
+   const real ZERO = (real)0.0;
+   const real ONE  = (real)1.0;
+
+
+// 2. compute the left/right pressure and sound speed squared
+   real P_L[RSOLVER_NBATCH], P_R[RSOLVER_NBATCH], Cs2_L[RSOLVER_NBATCH], Cs2_R[RSOLVER_NBATCH];
+
+   Hydro_Con2PresCSqr_Batch( NBatch, iN, iT1, iT2, NULL_INT, NULL_INT, NULL_INT, L_In, P_L, Cs2_L, MinPres,
+                             EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Hydro_Con2PresCSqr_Batch( NBatch, iN, iT1, iT2, NULL_INT, NULL_INT, NULL_INT, R_In, P_R, Cs2_R, MinPres,
+                             EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+
+
+// 3. evaluate the HLLC fluxes
+   real _RhoL[RSOLVER_NBATCH], _RhoR[RSOLVER_NBATCH];
+
+#  pragma omp simd
+   for (int b=0; b<NBatch; b++)
+   {
+//    3-1. left/right states and wave speeds
+//         --> load all variables unconditionally so that the upwind selections below can be vectorized
+      const real Dens_L  = L_In[  0][b];
+      const real MomN_L  = L_In[ iN][b];
+      const real MomT1_L = L_In[iT1][b];
+      const real MomT2_L = L_In[iT2][b];
+      const real Engy_L  = L_In[  4][b];
+      const real Dens_R  = R_In[  0][b];
+      const real MomN_R  = R_In[ iN][b];
+      const real MomT1_R = R_In[iT1][b];
+      const real MomT2_R = R_In[iT2][b];
+      const real Engy_R  = R_In[  4][b];
+
+      _RhoL[b] = ONE / Dens_L;
+      _RhoR[b] = ONE / Dens_R;
+
+      const real u_L   = _RhoL[b]*MomN_L;
+      const real u_R   = _RhoR[b]*MomN_R;
+      const real Cs_L  = SQRT( Cs2_L[b] );
+      const real Cs_R  = SQRT( Cs2_R[b] );
+
+      const real W_L1  = u_L - Cs_L;
+      const real W_L2  = u_R - Cs_R;
+      const real W_R1  = u_L + Cs_L;
+      const real W_R2  = u_R + Cs_R;
+      const real W_L   = MIN( W_L1, W_L2 );
+      const real W_R   = MAX( W_R1, W_R2 );
+
+
+//    3-2. star-region velocity (V_S) and pressure (P_S)
+//         --> evaluate both candidates before selection since floating-point operations inside a branch
+//             cannot be if-converted
+      const real dCs_L   = (u_L-u_R)+Cs_R;
+      const real dCs_R   = (u_L-u_R)+Cs_L;
+      const real temp1_L = +Dens_L*(  ( W_L1 < W_L2 ) ? Cs_L : dCs_L  );
+      const real temp1_R = -Dens_R*(  ( W_R2 > W_R1 ) ? Cs_R : dCs_R  );
+      const real temp2   = ONE / ( temp1_L - temp1_R );
+      const real V_S     = temp2*( P_L[b] - P_R[b] + temp1_L*u_L - temp1_R*u_R );
+            real P_S     = temp2*(  temp1_L*( P_R[b] + temp1_R*u_R ) - temp1_R*( P_L[b] + temp1_L*u_L )  );
+      P_S = ( P_S == P_S ) ? MAX( P_S, MinPres ) : P_S;
+
+
+//    3-3. fluxes along the maximum wave speed of the upwind side
+      const bool Left   = ( V_S >= ZERO );
+      const real Dens   = ( Left ) ? Dens_L  : Dens_R;
+      const real MomN   = ( Left ) ? MomN_L  : MomN_R;
+      const real MomT1  = ( Left ) ? MomT1_L : MomT1_R;
+      const real MomT2  = ( Left ) ? MomT2_L : MomT2_R;
+      const real Engy   = ( Left ) ? Engy_L  : Engy_R;
+      const real Pres   = ( Left ) ? P_L[b]       : P_R[b];
+      const real Vel    = ( Left ) ? u_L          : u_R;
+      const real MaxV   = ( Left ) ? MIN( W_L, ZERO ) : MAX( W_R, ZERO );
+
+      const real Flux_LR0 = MomN               - MaxV*Dens;
+      const real Flux_LR1 = Vel*MomN + Pres    - MaxV*MomN;
+      const real Flux_LR2 = Vel*MomT1          - MaxV*MomT1;
+      const real Flux_LR3 = Vel*MomT2          - MaxV*MomT2;
+      const real Flux_LR4 = Vel*( Engy + Pres ) - MaxV*Engy;
+
+
+//    3-4. weightings of the left/right fluxes and contact wave
+//         --> deal with the special case of V_S=MaxV_L=0
+//         --> since V_S>=0>=MaxV_L on the left and V_S<0<=MaxV_R on the right, it is equivalent to V_S-MaxV=0
+      const real dV       = V_S - MaxV;
+      const bool Special  = ( dV == ZERO );
+      const real temp4    = ONE / (  ( Special ) ? ONE : dV  );
+      const real temp5    = temp4*V_S;
+      const real temp6    = -temp4*MaxV*P_S;
+      const real Coeff_LR = ( Special ) ? ONE  : temp5;
+      const real Coeff_S  = ( Special ) ? ZERO : temp6;
+
+
+//    3-5. store the fluxes in the original order
+      Flux_Out[  0][b] = Coeff_LR*Flux_LR0;
+      Flux_Out[ iN][b] = Coeff_LR*Flux_LR1 + Coeff_S;
+      Flux_Out[iT1][b] = Coeff_LR*Flux_LR2;
+      Flux_Out[iT2][b] = Coeff_LR*Flux_LR3;
+      Flux_Out[  4][b] = Coeff_LR*Flux_LR4 + Coeff_S*V_S;
+   } // for (int b=0; b<NBatch; b++)
+
+
+// 4. fluxes of passive scalars
+//    --> the loop over passive scalars is moved out of the loop over interfaces so that the latter can be vectorized
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int b=0; b<NBatch; b++)
+      {
+         const real FluxD = Flux_Out[FLUX_DENS][b];
+         const bool UseL  = ( FluxD >= ZERO );
+         const real vx    = FluxD*(  ( UseL ) ? _RhoL[b] : _RhoR[b]  );
+
+         Flux_Out[v][b] = (  ( UseL ) ? L_In[v][b] : R_In[v][b]  )*vx;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLC_Batch
+#endif // #if ( RSOLVER == HLLC )
+
+
+
+#if ( RSOLVER == HLLE )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLE_Batch
+// Description :  Batched version of Hydro_RiemannSolver_HLLE() solving multiple interfaces per call
+//
+// Note        :  1. See Hydro_RiemannSolver_HLLC_Batch()
+//                2. Only support HLLE_WAVESPEED == HLL_WAVESPEED_DAVIS and the HD/MHD versions
+//
+// Parameter   :  See Hydro_RiemannSolver_HLLC_Batch()
+//
+// Return      :  Flux_Out[]
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLE_Batch( const int XYZ, const int NBatch, real Flux_Out[][RSOLVER_NBATCH],
+                                     const real L_In[][RSOLVER_NBATCH], const real R_In[][RSOLVER_NBATCH],
+                                     const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                     const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                                     const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] )
+{
+
+// 1. indices of the normal and transverse components (see Hydro_Rotate3D())
+   const int iN  = 1 + (XYZ  )%3;
+   const int iT1 = 1 + (XYZ+1)%3;
+   const int iT2 = 1 + (XYZ+2)%3;
+#  ifdef MHD
+   const int bN  = MAG_OFFSET + (XYZ  )%3;
+   const int bT1 = MAG_OFFSET + (XYZ+1)%3;
+   const int bT2 = MAG_OFFSET + (XYZ+2)%3;
+#  else
+   const int bN  = NULL_INT;
+   const int bT1 = NULL_INT;
+   const int bT2 = NULL_INT;
+#  endif
+
+   const real ZERO = (real)0.0;
+   const real ONE  = (real)1.0;
+#  ifdef MHD
+   const real _TWO = (real)0.5;
+#  endif
+
+
+// 2. compute the left/right pressure and sound speed squared
+   real P_L[RSOLVER_NBATCH], P_R[RSOLVER_NBATCH], a2_L[RSOLVER_NBATCH], a2_R[RSOLVER_NBATCH];
+
+   Hydro_Con2PresCSqr_Batch( NBatch, iN, iT1, iT2, bN, bT1, bT2, L_In, P_L, a2_L, MinPres,
+                             EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Hydro_Con2PresCSqr_Batch( NBatch, iN, iT1, iT2, bN, bT1, bT2, R_In, P_R, a2_R, MinPres,
+                             EoS_DensEint2Pres, EoS_DensPres2CSqr, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+
+
+// 3. evaluate the left/right fluxes and maximum wave speeds
+//    --> loops over components are moved out of the loop over interfaces so that the latter can be vectorized
+   real Flux_L[NWAVE][RSOLVER_NBATCH], Flux_R[NWAVE][RSOLVER_NBATCH], MaxV_L[RSOLVER_NBATCH], MaxV_R[RSOLVER_NBATCH];
+   real _RhoL[RSOLVER_NBATCH], _RhoR[RSOLVER_NBATCH];
+
+#  pragma omp simd
+   for (int b=0; b<NBatch; b++)
+   {
+//    3-1. left/right states
+      _RhoL[b] = ONE / L_In[0][b];
+      _RhoR[b] = ONE / R_In[0][b];
+
+      const real u_L   = _RhoL[b]*L_In[iN][b];
+      const real u_R   = _RhoR[b]*R_In[iN][b];
+
+//    3-2. fast wave speed (Cf)
+#     ifdef MHD
+      const real Bx_L   = L_In[ bN][b];
+      const real By_L   = L_In[bT1][b];
+      const real Bz_L   = L_In[bT2][b];
+      const real Bx_R   = R_In[ bN][b];
+      const real By_R   = R_In[bT1][b];
+      const real Bz_R   = R_In[bT2][b];
+
+      const real Cax2_L = SQR( Bx_L )*_RhoL[b];
+      const real Cat2_L = ( SQR(By_L) + SQR(Bz_L) )*_RhoL[b];
+      const real Cax2_R = SQR( Bx_R )*_RhoR[b];
+      const real Cat2_R = ( SQR(By_R) + SQR(Bz_R) )*_RhoR[b];
+
+      const real Cf2_min_Cs2_L = SQRT( SQR(Cat2_L+Cax2_L-a2_L[b]) + (real)4.0*a2_L[b]*Cat2_L );
+      const real Cf2_min_Cs2_R = SQRT( SQR(Cat2_R+Cax2_R-a2_R[b]) + (real)4.0*a2_R[b]*Cat2_R );
+
+//         --> evaluate all candidates before selection since floating-point operations inside a branch
+//             cannot be if-converted
+      const real Cf2_L1 = MAX( Cax2_L, a2_L[b] );
+      const real Cf2_L2 = a2_L[b] + Cat2_L;
+      const real Cf2_L3 = _TWO*( Cat2_L + Cax2_L + a2_L[b] + Cf2_min_Cs2_L );
+      const real Cf2_R1 = MAX( Cax2_R, a2_R[b] );
+      const real Cf2_R2 = a2_R[b] + Cat2_R;
+      const real Cf2_R3 = _TWO*( Cat2_R + Cax2_R + a2_R[b] + Cf2_min_Cs2_R );
+
+      const real Cf2_L  = ( Cat2_L == ZERO ) ? Cf2_L1 : ( Cax2_L == ZERO ) ? Cf2_L2 : Cf2_L3;
+      const real Cf2_R  = ( Cat2_R == ZERO ) ? Cf2_R1 : ( Cax2_R == ZERO ) ? Cf2_R2 : Cf2_R3;
+
+      const real Cf_L  = SQRT( Cf2_L );
+      const real Cf_R  = SQRT( Cf2_R );
+#     else
+      const real Cf_L  = SQRT( a2_L[b] );
+      const real Cf_R  = SQRT( a2_R[b] );
+#     endif // #ifdef MHD ... else ...
+
+//    3-3. left/right maximum wave speeds
+      MaxV_L[b] = MIN(  MIN( u_L-Cf_L, u_R-Cf_R ), ZERO  );
+      MaxV_R[b] = MAX(  MAX( u_L+Cf_L, u_R+Cf_R ), ZERO  );
+
+//    3-4. left and right fluxes in the rotated frame (see Hydro_Con2Flux())
+      Flux_L[0][b] = L_In[iN][b];
+      Flux_L[1][b] = u_L*L_In[ iN][b] + P_L[b];
+      Flux_L[2][b] = u_L*L_In[iT1][b];
+      Flux_L[3][b] = u_L*L_In[iT2][b];
+      Flux_L[4][b] = u_L*( L_In[4][b] + P_L[b] );
+
+      Flux_R[0][b] = R_In[iN][b];
+      Flux_R[1][b] = u_R*R_In[ iN][b] + P_R[b];
+      Flux_R[2][b] = u_R*R_In[iT1][b];
+      Flux_R[3][b] = u_R*R_In[iT2][b];
+      Flux_R[4][b] = u_R*( R_In[4][b] + P_R[b] );
+
+#     ifdef MHD
+      const real Vy_L   = _RhoL[b]*L_In[iT1][b];
+      const real Vz_L   = _RhoL[b]*L_In[iT2][b];
+      const real Vy_R   = _RhoR[b]*R_In[iT1][b];
+      const real Vz_R   = _RhoR[b]*R_In[iT2][b];
+      const real Emag_L = _TWO*( SQR(Bx_L) + SQR(By_L) + SQR(Bz_L) );
+      const real Emag_R = _TWO*( SQR(Bx_R) + SQR(By_R) + SQR(Bz_R) );
+
+      Flux_L[1][b] += Emag_L - SQR(Bx_L);
+      Flux_L[2][b] -= Bx_L*By_L;
+      Flux_L[3][b] -= Bx_L*Bz_L;
+      Flux_L[4][b] += u_L*Emag_L - Bx_L*( Bx_L*u_L + By_L*Vy_L + Bz_L*Vz_L );
+      Flux_L[5][b]  = By_L*u_L - Bx_L*Vy_L;
+      Flux_L[6][b]  = Bz_L*u_L - Bx_L*Vz_L;
+
+      Flux_R[1][b] += Emag_R - SQR(Bx_R);
+      Flux_R[2][b] -= Bx_R*By_R;
+      Flux_R[3][b] -= Bx_R*Bz_R;
+      Flux_R[4][b] += u_R*Emag_R - Bx_R*( Bx_R*u_R + By_R*Vy_R + Bz_R*Vz_R );
+      Flux_R[5][b]  = By_R*u_R - Bx_R*Vy_R;
+      Flux_R[6][b]  = Bz_R*u_R - Bx_R*Vz_R;
+#     endif
+   } // for (int b=0; b<NBatch; b++)
+
+
+// 4. HLLE fluxes in the original order
+#  ifdef MHD
+   const int idx_wave[NWAVE] = { 0, iN, iT1, iT2, 4, bT1, bT2 };
+#  else
+   const int idx_wave[NWAVE] = { 0, iN, iT1, iT2, 4 };
+#  endif
+
+   for (int v=0; v<NWAVE; v++)
+   {
+      const int iv = idx_wave[v];
+
+#     pragma omp simd
+      for (int b=0; b<NBatch; b++)
+      {
+//       deal with the special case of MaxV_L=MaxV_R=0 by assuming Flux_L=Flux_R
+//       --> since MaxV_L<=0<=MaxV_R, it is equivalent to MaxV_R-MaxV_L=0
+         const real dMaxV           = MaxV_R[b] - MaxV_L[b];
+         const bool Special         = ( dMaxV == ZERO );
+         const real _MaxV_R_minus_L = ONE / (  ( Special ) ? ONE : dMaxV  );
+         const real FL              = Flux_L[v][b] - MaxV_L[b]*L_In[iv][b];
+         const real FR              = Flux_R[v][b] - MaxV_R[b]*R_In[iv][b];
+         const real FHLL            = _MaxV_R_minus_L*( MaxV_R[b]*FL - MaxV_L[b]*FR );
+
+         Flux_Out[iv][b] = ( Special ) ? FL : FHLL;
+      }
+   }
+
+// longitudinal magnetic flux is always zero
+#  ifdef MHD
+   for (int b=0; b<NBatch; b++)  Flux_Out[bN][b] = ZERO;
+#  endif
+
+
+// 5. fluxes of passive scalars
+//    --> the loop over passive scalars is moved out of the loop over interfaces so that the latter can be vectorized
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   {
+#     pragma omp simd
+      for (int b=0; b<NBatch; b++)
+      {
+         const real FluxD = Flux_Out[FLUX_DENS][b];
+         const bool UseL  = ( FluxD >= ZERO );
+         const real vx    = FluxD*(  ( UseL ) ? _RhoL[b] : _RhoR[b]  );
+
+         Flux_Out[v][b] = (  ( UseL ) ? L_In[v][b] : R_In[v][b]  )*vx;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLE_Batch
+#endif // #if ( RSOLVER == HLLE )
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  defined RSOLVER_BATCH )
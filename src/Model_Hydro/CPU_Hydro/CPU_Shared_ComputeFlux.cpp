@@ -64,6 +64,21 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
                                const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
                                const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
 #endif
+#ifdef RSOLVER_BATCH
+#if   ( RSOLVER == HLLE )
+void Hydro_RiemannSolver_HLLE_Batch( const int XYZ, const int NBatch, real Flux_Out[][RSOLVER_NBATCH],
+                                     const real L_In[][RSOLVER_NBATCH], const real R_In[][RSOLVER_NBATCH],
+                                     const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                     const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                                     const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
+#elif ( RSOLVER == HLLC )
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NBatch, real Flux_Out[][RSOLVER_NBATCH],
+                                     const real L_In[][RSOLVER_NBATCH], const real R_In[][RSOLVER_NBATCH],
+                                     const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
+                                     const EoS_DP2C_t EoS_DensPres2CSqr, const double EoS_AuxArray_Flt[],
+                                     const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
+#endif
+#endif
 
 #endif // #ifdef __CUDACC__ ... else ...
 
@@ -87,6 +102,9 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                4. This function is shared by MHM, MHM_RP, and CTU schemes
 //                5. For the unsplitting scheme in gravity (i.e., UNSPLIT_GRAVITY), this function also corrects the half-step
 //                   velocity by gravity when CorrHalfVel==true
+//                6. When RSOLVER_BATCH is on (CPU only), interfaces are accumulated into batches of RSOLVER_NBATCH
+//                   in the SoA layout and solved by the batched Riemann solvers in CPU_RiemannSolver_Batch.cpp
+//                   --> RSOLVER_RESCUE is still applied interface by interface
 //
 // Parameter   :  g_FC_Var        : Array storing the input face-centered conserved variables
 //                g_FC_Flux       : Array to store the output face-centered fluxes
@@ -143,6 +161,12 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
    real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
 
+#  ifdef RSOLVER_BATCH
+   real Batch_L[NCOMP_TOTAL_PLUS_MAG][RSOLVER_NBATCH], Batch_R[NCOMP_TOTAL_PLUS_MAG][RSOLVER_NBATCH];
+   real Batch_Flux[NCOMP_TOTAL_PLUS_MAG][RSOLVER_NBATCH];
+   int  Batch_IdxFlux[RSOLVER_NBATCH];
+#  endif
+
 #  ifdef UNSPLIT_GRAVITY
    const real   GraConst    = -(real)0.5*dt/dh;
    const int    didx_usg[3] = { 1, USG_NXT_F, SQR(USG_NXT_F) };
@@ -209,7 +233,8 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
       }
 
       const int size_ij = idx_flux_e[0]*idx_flux_e[1];
-      CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
+      const int NFace   = idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2];
+      CGPU_LOOP( idx, NFace )
       {
          const int i_flux   = idx % idx_flux_e[0];
          const int j_flux   = idx % size_ij / idx_flux_e[0];
@@ -281,89 +306,136 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 //       2. invoke Riemann solver
-#        if   ( RSOLVER == EXACT  &&  !defined MHD )
-         Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#        elif ( RSOLVER == ROE )
-         Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#        elif ( RSOLVER == HLLE )
-         Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                    EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
-                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#        elif ( RSOLVER == HLLC  &&  !defined MHD )
-         Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                    EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
-                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#        elif ( RSOLVER == HLLD  &&  defined MHD )
-         Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        ifdef RSOLVER_BATCH
+//       2-1. accumulate interfaces until the batch is full or the last interface is reached
+         const int b = idx % RSOLVER_NBATCH;
+
+         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         {
+            Batch_L[v][b] = ConVar_L[v];
+            Batch_R[v][b] = ConVar_R[v];
+         }
+         Batch_IdxFlux[b] = idx_flux;
+
+         if ( b != RSOLVER_NBATCH-1  &&  idx != NFace-1 )   continue;
+
+//       2-2. solve all interfaces in the batch at once
+         const int NBatch = b + 1;
+
+#        if   ( RSOLVER == HLLE )
+         Hydro_RiemannSolver_HLLE_Batch( d, NBatch, Batch_Flux, Batch_L, Batch_R, MinDens, MinPres,
+                                         EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                         EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        elif ( RSOLVER == HLLC )
+         Hydro_RiemannSolver_HLLC_Batch( d, NBatch, Batch_Flux, Batch_L, Batch_R, MinDens, MinPres,
+                                         EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                         EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
 #        else
-#        error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
+#        error : ERROR : unsupported batched Riemann solver (HLLE/HLLC) !!
 #        endif
 
+//       2-3. apply RSOLVER_RESCUE and store the fluxes interface by interface
+         for (int t=0; t<NBatch; t++)
+         {
+            const int idx_flux_t = Batch_IdxFlux[t];
+
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+            {
+               ConVar_L  [v] = Batch_L   [v][t];
+               ConVar_R  [v] = Batch_R   [v][t];
+               Flux_1Face[v] = Batch_Flux[v][t];
+            }
+
+#        else // #ifdef RSOLVER_BATCH
 
-//       3. switch to a different Riemann solver if the default one fails
-#        if ( RSOLVER_RESCUE != NONE )
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
          {
-//          only check NaN for now
-            if ( Flux_1Face[v] != Flux_1Face[v] )
+            const int idx_flux_t = idx_flux;
+
+#           if   ( RSOLVER == EXACT  &&  !defined MHD )
+            Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                       EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                       EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#           elif ( RSOLVER == ROE )
+            Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                       EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                       EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#           elif ( RSOLVER == HLLE )
+            Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                       EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                       EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                       EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#           elif ( RSOLVER == HLLC  &&  !defined MHD )
+            Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                       EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                       EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                       EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#           elif ( RSOLVER == HLLD  &&  defined MHD )
+            Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                       EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                       EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#           else
+#           error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
+#           endif
+#        endif // #ifdef RSOLVER_BATCH ... else ...
+
+
+//          3. switch to a different Riemann solver if the default one fails
+#           if ( RSOLVER_RESCUE != NONE )
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
             {
-#              ifdef CHECK_UNPHYSICAL_IN_FLUID
-               printf( "WARNING : default Riemann solver failed in Hydro_ComputeFlux() --> switch to RSOLVER_RESCUE (%d) !!\n", RSOLVER_RESCUE );
-#              endif
-
-#              if   ( RSOLVER_RESCUE == EXACT  &&  !defined MHD )
-               Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == ROE )
-               Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLE )
-               Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLC  &&  !defined MHD )
-               Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLD  &&  defined MHD )
-               Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              else
-#              error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
-#              endif
-
-//             check again
-#              ifdef CHECK_UNPHYSICAL_IN_FLUID
-               for (int w=0; w<NCOMP_TOTAL_PLUS_MAG; w++) {
-                  if ( Flux_1Face[w] != Flux_1Face[w] ) {
-                     printf( "ERROR : RSOLVER_RESCUE still failed !!\n" );
-                     break;
+//             only check NaN for now
+               if ( Flux_1Face[v] != Flux_1Face[v] )
+               {
+#                 ifdef CHECK_UNPHYSICAL_IN_FLUID
+                  printf( "WARNING : default Riemann solver failed in Hydro_ComputeFlux() --> switch to RSOLVER_RESCUE (%d) !!\n", RSOLVER_RESCUE );
+#                 endif
+
+#                 if   ( RSOLVER_RESCUE == EXACT  &&  !defined MHD )
+                  Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                             EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#                 elif ( RSOLVER_RESCUE == ROE )
+                  Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                             EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#                 elif ( RSOLVER_RESCUE == HLLE )
+                  Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                             EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                             EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#                 elif ( RSOLVER_RESCUE == HLLC  &&  !defined MHD )
+                  Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                             EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                             EoS->GuessHTilde_FuncPtr, EoS->HTilde2Temp_FuncPtr,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#                 elif ( RSOLVER_RESCUE == HLLD  &&  defined MHD )
+                  Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                             EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                             EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#                 else
+#                 error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
+#                 endif
+
+//                check again
+#                 ifdef CHECK_UNPHYSICAL_IN_FLUID
+                  for (int w=0; w<NCOMP_TOTAL_PLUS_MAG; w++) {
+                     if ( Flux_1Face[w] != Flux_1Face[w] ) {
+                        printf( "ERROR : RSOLVER_RESCUE still failed !!\n" );
+                        break;
+                     }
                   }
-               }
-#              endif
+#                 endif
 
-               break;
-            } // if ( Flux_1Face[v] != Flux_1Face[v] )
-         } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
-#        endif // #if ( RSOLVER_RESCUE != NONE )
+                  break;
+               } // if ( Flux_1Face[v] != Flux_1Face[v] )
+            } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+#           endif // #if ( RSOLVER_RESCUE != NONE )
 
 
-//       4. store the fluxes of all cells in g_FC_Flux[]
-//       --> including the magnetic components since they are required for CT
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
+//          4. store the fluxes of all cells in g_FC_Flux[]
+//          --> including the magnetic components since they are required for CT
+            for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_FC_Flux[d][v][idx_flux_t] = Flux_1Face[v];
+         } // for (int t=0; t<NBatch; t++) ... or a single interface
       } // i,j,k
    } // for (int d=0; d<3; d++)
 
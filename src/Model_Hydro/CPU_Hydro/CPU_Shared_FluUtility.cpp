@@ -4,6 +4,7 @@
 
 
 #include "CUFLU.h"
+#include "EoS_Policy.h"
 
 #if ( MODEL == HYDRO )
 
@@ -238,7 +239,7 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
    const real _LorentzFactor = real(1.0) / LorentzFactor;
    Out[0] = In[0]*_LorentzFactor;
 
-   EoS_HTilde2Temp( HTilde, &Temp, NULL, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   EOS_CALL( HTilde2Temp, EoS_HTilde2Temp )( HTilde, &Temp, NULL, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    Out[4] = Out[0]*Temp;
    Out[4] = Hydro_CheckMinPres( Out[4], MinPres );
@@ -276,7 +277,7 @@ void Hydro_Con2Pri( const real In[], real Out[], const real MinPres,
 
 //    recompute internal energy to be consistent with the updated pressure
       if ( EintOut != NULL  &&  Out[4] != Pres0 )
-         *EintOut = EoS_DensPres2Eint( Out[0], Out[4], In+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+         *EintOut = EOS_CALL( DensPres2Eint, EoS_DensPres2Eint )( Out[0], Out[4], In+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
    }
 #  endif // #ifdef SRHD ... else ...
 
@@ -351,7 +352,7 @@ void Hydro_Pri2Con( const real In[], real Out[], const bool FracPassive,
 
    LorentzFactor = SQRT( (real)1.0 + SQR(In[1]) + SQR(In[2]) + SQR(In[3]) );
    Temperature   = In[4]/In[0];
-   HTilde        = EoS_Temp2HTilde( Temperature, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   HTilde        = EOS_CALL( Temp2HTilde, EoS_Temp2HTilde )( Temperature, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
    Out[0]        = In[0]*LorentzFactor;
    Factor        = Out[0]*HTilde + Out[0];
    Out[1]        = In[1]*Factor;
@@ -410,8 +411,8 @@ void Hydro_Pri2Con( const real In[], real Out[], const bool FracPassive,
    const real Bz = In[ MAG_OFFSET + 2 ];
    Emag   = (real)0.5*( SQR(Bx) + SQR(By) + SQR(Bz) );
 #  endif
-   Eint   = ( EintIn == NULL ) ? EoS_DensPres2Eint( In[0], In[4], Out+NCOMP_FLUID, EoS_AuxArray_Flt,
-                                                    EoS_AuxArray_Int, EoS_Table )
+   Eint   = ( EintIn == NULL ) ? EOS_CALL( DensPres2Eint, EoS_DensPres2Eint )( In[0], In[4], Out+NCOMP_FLUID, EoS_AuxArray_Flt,
+                                                                               EoS_AuxArray_Int, EoS_Table )
                                : *EintIn;
    Out[4] = Hydro_ConEint2Etot( Out[0], Out[1], Out[2], Out[3], Eint, Emag );
 
@@ -572,7 +573,7 @@ real Hydro_Con2HTilde( const real Con[], const EoS_GUESS_t EoS_GuessHTilde, cons
    MSqr_DSqr  = SQR(Con[1]) + SQR(Con[2]) + SQR(Con[3]);
    MSqr_DSqr /= SQR(Con[0]);
 
-   GuessHTilde = EoS_GuessHTilde( Con, &Constant, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   GuessHTilde = EOS_CALL( GuessHTilde, EoS_GuessHTilde )( Con, &Constant, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    void (*FuncPtr)( real HTilde, void *params, real *Func, real *DiffFunc ) = &Hydro_HTildeFunction;
 
@@ -634,7 +635,7 @@ void Hydro_HTildeFunction( real HTilde, void *Params, real *Func, real *DiffFunc
 
 // recompute temperature only when the input Temp is NAN, which is used in Hydro_Con2HTilde()
    if ( Temp != Temp )
-      EoS_HTilde2Temp( HTilde, &Temp, &DiffTemp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+      EOS_CALL( HTilde2Temp, EoS_HTilde2Temp )( HTilde, &Temp, &DiffTemp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
 // Eq. 15
    const real H =  HTilde + (real)1.0;
@@ -936,8 +937,8 @@ bool Hydro_IsUnphysical( const IsUnphyMode_t Mode, const real Fields[], const ch
 //       --> for trivial EoS like EOS_GAMMA, checking internal energy is sufficient and pressure can be
 //           slightly negative if it's within machine precision
 #        if ( EOS != EOS_GAMMA )
-         const real Pres = EoS_DensEint2Pres( Fields[DENS], Eint, Fields+NCOMP_FLUID,
-                                              EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+         const real Pres = EOS_CALL( DensEint2Pres, EoS_DensEint2Pres )( Fields[DENS], Eint, Fields+NCOMP_FLUID,
+                                                                         EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
          if ( Pres < (real)0.0  ||  Pres > HUGE_NUMBER  ||  Pres != Pres )
             UnphyCell = true;
@@ -1159,7 +1160,7 @@ real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Pres = EoS_DensEint2Pres( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Pres = EOS_CALL( DensEint2Pres, EoS_DensEint2Pres )( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    if ( CheckMinPres )   Pres = Hydro_CheckMinPres( Pres, MinPres );
 
@@ -1396,7 +1397,7 @@ real Hydro_Con2Temp( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Temp = EoS_DensEint2Temp( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Temp = EOS_CALL( DensEint2Temp, EoS_DensEint2Temp )( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 #  endif // #ifdef SRHD ... else ...
 
    if ( CheckMinTemp )   Temp = Hydro_CheckMinTemp( Temp, MinTemp );
@@ -1469,7 +1470,7 @@ real Hydro_Con2Entr( const real Dens, const real MomX, const real MomY, const re
 
    Eint = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Engy, CheckMinEint_No, NULL_REAL, Emag,
                           NULL, NULL, NULL, NULL, NULL );
-   Entr = EoS_DensEint2Entr( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   Entr = EOS_CALL( DensEint2Entr, EoS_DensEint2Entr )( Dens, Eint, Passive, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
    if ( CheckMinEntr )   Entr = Hydro_CheckMinEntr( Entr, MinEntr );
 
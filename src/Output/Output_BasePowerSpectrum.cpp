@@ -7,8 +7,16 @@
 
 
 static void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *PS_total, double *NormDC );
+static void NormalizeBasePowerSpectrum( const double *PS_local, const long *Count_local, double *PS_total, double *NormDC );
+static void WriteBasePowerSpectrum( const char *FileName, const double *PS_total, const double NormDC );
+#if ( SUPPORT_FFTW == FFTW3 )
+static void Output_BasePowerSpectrum_Pencil( const char *FileName, const long TVar );
+#endif
 
 extern root_fftw::real_plan_nd     FFTW_Plan_PS;
+#if ( SUPPORT_FFTW == FFTW3 )
+extern FFTW_Pencil_t               FFTW_Pencil_PS;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Output_BasePowerSpectrum
@@ -31,6 +39,19 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
       Aux_Error( ERROR_INFO, "%s only works with CUBIC domain !!\n", __FUNCTION__ );
 
 
+// the pencil decomposition adopts a different data layout (see FFTW_Pencil_t)
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+   {
+      Output_BasePowerSpectrum_Pencil( FileName, TVar );
+
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d) ... done\n", __FUNCTION__, DumpID );
+
+      return;
+   }
+#  endif
+
+
 // 1. determine the FFT size
    const int Nx_Padded   = NX0_TOT[0]/2+1;
    const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
@@ -139,29 +160,7 @@ void Output_BasePowerSpectrum( const char *FileName, const long TVar )
 
 
 // 6. output the power spectrum
-   if ( MPI_Rank == 0 )
-   {
-//    check if the target file already exists
-      if ( Aux_CheckFileExist(FileName) )
-         Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
-
-//    output the power spectrum
-      const double WaveK0 = 2.0*M_PI/amr->BoxSize[0];
-      FILE *File = fopen( FileName, "w" );
-
-      fprintf( File, "# average value (DC) used for normalization = %20.14e\n", NormDC );
-      fprintf( File, "\n" );
-      fprintf( File, "#%*s %*s\n", StrLen_Flt, "k", StrLen_Flt, "Power" );
-
-//    DC mode is not output
-      for (int b=1; b<Nx_Padded; b++) {
-         fprintf( File, BlankPlusFormat_Flt, WaveK0*b );
-         fprintf( File, BlankPlusFormat_Flt, PS_total[b] );
-         fprintf( File, "\n");
-      }
-
-      fclose( File );
-   } // if ( MPI_Rank == 0 )
+   WriteBasePowerSpectrum( FileName, PS_total, NormDC );
 
 
 // 7. free memory
@@ -223,7 +222,7 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
 
    gamer_fftw::fft_complex *cdata=NULL;
    double PS_local[Nx_Padded];
-   long   Count_local[Nx_Padded], Count_total[Nx_Padded];
+   long   Count_local[Nx_Padded];
    int    bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
 
    root_fftw_r2c( FFTW_Plan_PS, VarK );
@@ -287,7 +286,37 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
    } // i,j,k
 
 
+// sum over all ranks and normalize
+   NormalizeBasePowerSpectrum( PS_local, Count_local, PS_total, NormDC );
+
+} // FUNCTION : GetBasePowerSpectrum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  NormalizeBasePowerSpectrum
+// Description :  Sum the binned power spectrum over all ranks and normalize it
+//
+// Note        :  Invoked by the functions "GetBasePowerSpectrum" and "Output_BasePowerSpectrum_Pencil"
+//
+// Parameter   :  PS_local    : Binned power spectrum of this rank
+//                Count_local : Number of wavenumbers in each bin of this rank
+//                PS_total    : Power spectrum summed over all MPI ranks
+//                NormDC      : Record of the average (DC) value used for normalization of power spectrum
+//
+// Return      :  PS_total, NormDC
+//-------------------------------------------------------------------------------------------------------
+void NormalizeBasePowerSpectrum( const double *PS_local, const long *Count_local, double *PS_total, double *NormDC )
+{
+
+   const int Nx        = NX0_TOT[0];
+   const int Ny        = NX0_TOT[1];
+   const int Nz        = NX0_TOT[2];
+   const int Nx_Padded = Nx/2 + 1;
+
 // sum over all ranks
+   long Count_total[Nx_Padded];
+
    MPI_Reduce( PS_local,    PS_total,    Nx_Padded, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
    MPI_Reduce( Count_local, Count_total, Nx_Padded, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
 
@@ -326,7 +355,198 @@ void GetBasePowerSpectrum( real *VarK, const int j_start, const int dj, double *
       *NormDC = AveVar;
    }
 
-} // FUNCTION : GetBasePowerSpectrum
+} // FUNCTION : NormalizeBasePowerSpectrum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteBasePowerSpectrum
+// Description :  Output the base-level power spectrum
+//
+// Note        :  Only the root rank writes the file
+//
+// Parameter   :  FileName : Name of the output file
+//                PS_total : Power spectrum summed over all MPI ranks
+//                NormDC   : Average (DC) value used for normalization of power spectrum
+//-------------------------------------------------------------------------------------------------------
+void WriteBasePowerSpectrum( const char *FileName, const double *PS_total, const double NormDC )
+{
+
+   const int Nx_Padded = NX0_TOT[0]/2 + 1;
+
+   if ( MPI_Rank == 0 )
+   {
+//    check if the target file already exists
+      if ( Aux_CheckFileExist(FileName) )
+         Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+//    output the power spectrum
+      const double WaveK0 = 2.0*M_PI/amr->BoxSize[0];
+      FILE *File = fopen( FileName, "w" );
+
+      fprintf( File, "# average value (DC) used for normalization = %20.14e\n", NormDC );
+      fprintf( File, "\n" );
+      fprintf( File, "#%*s %*s\n", StrLen_Flt, "k", StrLen_Flt, "Power" );
+
+//    DC mode is not output
+      for (int b=1; b<Nx_Padded; b++) {
+         fprintf( File, BlankPlusFormat_Flt, WaveK0*b );
+         fprintf( File, BlankPlusFormat_Flt, PS_total[b] );
+         fprintf( File, "\n");
+      }
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : WriteBasePowerSpectrum
+
+
+
+#if ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_BasePowerSpectrum_Pencil
+// Description :  Evaluate and output the base-level power spectrum using the pencil decomposition (OPT__FFTW_PENCIL)
+//
+// Note        :  1. Invoked by the function "Output_BasePowerSpectrum"
+//                2. k-space data are in the z-pencil layout [y][x][z] (see FFTW_Pencil_t)
+//
+// Parameter   :  FileName : Name of the output file
+//                TVar     : Target variable
+//-------------------------------------------------------------------------------------------------------
+void Output_BasePowerSpectrum_Pencil( const char *FileName, const long TVar )
+{
+
+   const FFTW_Pencil_t &P = FFTW_Pencil_PS;
+
+   const int Nx        = NX0_TOT[0];
+   const int Ny        = NX0_TOT[1];
+   const int Nz        = NX0_TOT[2];
+   const int Nx_Padded = Nx/2 + 1;
+   const int local_nx  = P.XC_Start[ P.Coord[0]+1 ] - P.XC_Start[ P.Coord[0] ];
+   const int local_ny  = P.YK_Start[ P.Coord[1]+1 ] - P.YK_Start[ P.Coord[1] ];
+   const int i_start   = P.XC_Start[ P.Coord[0] ];
+   const int j_start   = P.YK_Start[ P.Coord[1] ];
+
+
+// 1. allocate memory
+   double *PS_total     = NULL;
+   real   *VarK         = (real*) root_fftw::fft_malloc( sizeof(real)*P.TotalSize );
+   real   *Work         = (real*) root_fftw::fft_malloc( sizeof(real)*P.TotalSize );
+   long   *RecvBuf_PIdx = NULL;
+   int    *List_PID     [MPI_NRank];
+   int    *List_jk      [MPI_NRank];
+   long    List_NSendRow[MPI_NRank];
+   long    List_NRecvRow[MPI_NRank];
+   const bool ForPoisson = false;
+
+   if ( MPI_Rank == 0 )    PS_total = new double [Nx_Padded];
+
+
+// 2. initialize the particle density array (rho_ext) and collect particles to the target level
+#  ifdef MASSIVE_PARTICLES
+   const bool TimingSendPar_No = false;
+   const bool JustCountNPar_No = false;
+#  ifdef LOAD_BALANCE
+   const bool PredictPos       = amr->Par->PredictPos;
+   const bool SibBufPatch      = true;
+   const bool FaSibBufPatch    = true;
+#  else
+   const bool PredictPos       = false;
+   const bool SibBufPatch      = NULL_BOOL;
+   const bool FaSibBufPatch    = NULL_BOOL;
+#  endif
+
+   if ( TVar == _TOTAL_DENS ) {
+      Par_CollectParticle2OneLevel( 0, _PAR_MASS|_PAR_POSX|_PAR_POSY|_PAR_POSZ|_PAR_TYPE, PredictPos, Time[0],
+                                    SibBufPatch, FaSibBufPatch, JustCountNPar_No, TimingSendPar_No );
+
+      Prepare_PatchData_InitParticleDensityArray( 0, Time[0] );
+   } // if ( TVar == _TOTAL_DENS )
+#  endif // #ifdef MASSIVE_PARTICLES
+
+
+// 3. rearrange data from patch to pencil and perform the forward FFT
+   Patch2Pencil( VarK, P, &RecvBuf_PIdx, List_PID, List_jk, List_NSendRow, List_NRecvRow, Time[0], TVar, ForPoisson, false );
+
+   FFTW_Pencil_Forward( P, VarK, Work );
+
+
+// 4. estimate the power spectrum
+   const gamer_fftw::fft_complex *cdata = (gamer_fftw::fft_complex*) VarK;
+
+   double PS_local[Nx_Padded];
+   long   Count_local[Nx_Padded];
+   int    i, j, bin, bin_j, bin_k[Nz];
+   long   Idx;
+
+   for (int k=0; k<Nz; k++)   bin_k[k] = ( k <= Nz/2 ) ? k : k-Nz;
+
+   for (int b=0; b<Nx_Padded; b++)
+   {
+      PS_local   [b] = 0.0;
+      Count_local[b] = 0;
+   }
+
+   for (int jj=0; jj<local_ny; jj++)
+   {
+      j     = j_start + jj;
+      bin_j = ( j <= Ny/2 ) ? j : j-Ny;
+
+      for (int ii=0; ii<local_nx; ii++)
+      {
+         i = i_start + ii;
+
+         for (int k=0; k<Nz; k++)
+         {
+            Idx = ( (long)jj*local_nx + ii )*Nz + k;
+
+#           ifdef FLOAT8
+            bin = lround (   SQRT(   real( SQR(i) + SQR(bin_j) + SQR(bin_k[k]) )  )   );
+#           else
+            bin = lroundf(   SQRT(   real( SQR(i) + SQR(bin_j) + SQR(bin_k[k]) )  )   );
+#           endif
+
+            if ( bin < Nx_Padded )
+            {
+               PS_local   [bin] += double(  SQR( c_re(cdata[Idx]) ) + SQR( c_im(cdata[Idx])  ) );
+               Count_local[bin] ++;
+            }
+         } // k
+      } // ii
+   } // jj
+
+   double NormDC;  // to record the FFT DC value used for normalization
+   NormalizeBasePowerSpectrum( PS_local, Count_local, PS_total, &NormDC );
+
+
+// 5. output the power spectrum
+   WriteBasePowerSpectrum( FileName, PS_total, NormDC );
+
+
+// 6. free memory
+   root_fftw::fft_free( VarK );
+   root_fftw::fft_free( Work );
+   delete [] RecvBuf_PIdx;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      free( List_PID[r] );
+      free( List_jk [r] );
+   }
+
+   if ( MPI_Rank == 0 )    delete [] PS_total;
+
+// free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
+#  ifdef MASSIVE_PARTICLES
+   if ( TVar == _TOTAL_DENS ) {
+      Par_CollectParticle2OneLevel_FreeMemory( 0, SibBufPatch, FaSibBufPatch );
+
+      Prepare_PatchData_FreeParticleDensityArray( 0 );
+   }
+#  endif
+
+} // FUNCTION : Output_BasePowerSpectrum_Pencil
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
 
 
 
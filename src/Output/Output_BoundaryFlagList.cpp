@@ -45,16 +45,12 @@ void Output_BoundaryFlagList( const int option, const int lv, const char *commen
                                      amr->ParaVar->BuffFlag_NList  [lv][s];
       const int *List = ( option ) ? amr->ParaVar->BounFlag_PosList[lv][s] :
                                      amr->ParaVar->BuffFlag_PosList[lv][s];
-      const int FlagLayer = TABLE_05( s );
 
       fprintf( File, "Face = %d     Length = %d\n", s, NP );
 
-      for (int P=0; P<NP; P++)
-      {
-         fprintf( File, "%5d ", List[P] );
-
-         if ( (P+1)%FlagLayer == 0 )   fprintf( File, "  ||  " );
-      }
+//    each flagged patch is recorded as [position, bitmask of the flagged layers > 0]
+      for (int P=0; P<NP; P+=NFLAG_PER_BOUNP)
+         fprintf( File, "%5d 0x%02x  ||  ", List[P], List[P+1] );
 
       fprintf( File, "\n\n" );
    }
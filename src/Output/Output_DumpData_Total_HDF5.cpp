@@ -3,6 +3,9 @@
 #include "GAMER.h"
 #include "HDF5_Typedef.h"
 #include <ctime>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 void FillIn_KeyInfo  (   KeyInfo_t &KeyInfo, const int NFieldStored );
 void FillIn_Makefile (  Makefile_t &Makefile  );
@@ -13,6 +16,37 @@ static void GetCompound_KeyInfo  ( hid_t &H5_TypeID );
 static void GetCompound_Makefile ( hid_t &H5_TypeID );
 static void GetCompound_SymConst ( hid_t &H5_TypeID );
 static void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored );
+static void  ParallelIO_Init();
+static void  ParallelIO_End();
+static hid_t ParallelIO_OpenFile( const char *FileName, const char *GroupName, hid_t &H5_GroupID );
+static void  ParallelIO_WriteSlab( const hid_t H5_GroupID, const char *SetName, const hid_t H5_SpaceID_File,
+                                   const hid_t H5_TypeID, const void *Data, const long Offset, const int Count,
+                                   const long NElem1 );
+static bool  AsyncIO_Init( const char *FileName, const int NFieldStored );
+static long  AsyncIO_GetAddress( const hid_t H5_SetID );
+static void  AsyncIO_Stage( const long SetAddr, const long Offset, const void *Data, const long Size );
+static void  AsyncIO_Start();
+static void *AsyncIO_Write( void *Arg );
+
+// MPI communicators for OPT__OUTPUT_HDF5_COLLECTIVE and OPT__OUTPUT_HDF5_AGGREGATE
+#ifndef SERIAL
+static MPI_Comm H5_AggComm    = MPI_COMM_NULL;   // ranks sharing the same writer (i.e., rank 0 in H5_AggComm)
+static MPI_Comm H5_WriterComm = MPI_COMM_NULL;   // all writers (MPI_COMM_NULL on non-writers)
+#endif
+
+// staged grid and particle data for OPT__OUTPUT_HDF5_ASYNC
+static char      AsyncIO_FileName[MAX_STRING];
+static char     *AsyncIO_Buf          = NULL;    // staging buffer of all chunks
+static long      AsyncIO_BufSize      = 0L;      // size of AsyncIO_Buf in bytes
+static long      AsyncIO_BufUsed      = 0L;      // size of the staged data in bytes
+static int       AsyncIO_NChunk       = 0;       // number of staged chunks
+static int       AsyncIO_MaxNChunk    = 0;       // maximum number of chunks
+static long     *AsyncIO_ChunkFileOff = NULL;    // file offset of each chunk in bytes
+static long     *AsyncIO_ChunkBufOff  = NULL;    // offset of each chunk in AsyncIO_Buf in bytes
+static long     *AsyncIO_ChunkSize    = NULL;    // size of each chunk in bytes
+static bool      AsyncIO_Active       = false;   // whether the I/O thread is running
+static bool      AsyncIO_Failed       = false;   // whether the I/O thread failed to write data
+static pthread_t AsyncIO_Thread;
 
 
 
@@ -106,6 +140,23 @@ Procedure for outputting new variables:
 //                        --> Currently we store different attributes in separate datasets
 //                        --> Particles are stored in the order of their associated GIDs as well, but the order of
 //                            particles in the same patch is not specified
+//                11. By default, grid and particle data are written by one rank at a time
+//                    --> OPT__OUTPUT_HDF5_COLLECTIVE: all writers write collectively through MPI-IO
+//                        (requires HDF5 built with parallel support)
+//                    --> OPT__OUTPUT_HDF5_AGGREGATE: gather data onto one writer per node first to reduce the
+//                        number of MPI-IO clients (must work with OPT__OUTPUT_HDF5_COLLECTIVE)
+//                    --> Both options do not change the file layout
+//                12. OPT__OUTPUT_HDF5_ASYNC: grid and particle data are copied to a staging buffer and written
+//                    by a background thread of each rank while the simulation continues
+//                    --> Rank 0 still writes all metadata (e.g., Info and Tree) synchronously and creates
+//                        all datasets with contiguous layout and early allocation
+//                    --> Each rank then writes its staged data directly to the file offsets of these datasets
+//                        so the file layout is unchanged
+//                    --> Fall back to the synchronous mode if the staged data exceed OUTPUT_HDF5_ASYNC_MAX_MEM
+//                        on any rank
+//                    --> Only one snapshot can be in flight at a time
+//                        --> Output_DumpData_Total_HDF5_Flush() must be invoked before the next dump and
+//                            before the program ends
 //
 // Parameter   :  FileName : Name of the output file
 //
@@ -390,20 +441,20 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    LB_AllgatherPatchCount( pc );
 
 // 2. prepare all HDF5 variables
-   hsize_t H5_SetDims_LBIdx, H5_SetDims_Cr[2], H5_SetDims_Fa, H5_SetDims_Son, H5_SetDims_Sib[2], H5_SetDims_Field[4];
+   hsize_t H5_SetDims_Field[4];
    hsize_t H5_MemDims_Field[4], H5_Count_Field[4], H5_Offset_Field[4];
    hid_t   H5_MemID_Field;
    hid_t   H5_FileID, H5_GroupID_Info, H5_GroupID_Tree, H5_GroupID_GridData;
-   hid_t   H5_SetID_LBIdx, H5_SetID_Cr, H5_SetID_Fa, H5_SetID_Son, H5_SetID_Sib, H5_SetID_Field;
+   hid_t   H5_SetID_Field;
    hid_t   H5_SetID_KeyInfo, H5_SetID_Makefile, H5_SetID_SymConst, H5_SetID_InputPara;
-   hid_t   H5_SpaceID_Scalar, H5_SpaceID_LBIdx, H5_SpaceID_Cr, H5_SpaceID_Fa, H5_SpaceID_Son, H5_SpaceID_Sib, H5_SpaceID_Field;
+   hid_t   H5_SpaceID_Scalar, H5_SpaceID_Field;
    hid_t   H5_TypeID_Com_KeyInfo, H5_TypeID_Com_Makefile, H5_TypeID_Com_SymConst, H5_TypeID_Com_InputPara;
    hid_t   H5_DataCreatePropList;
    hid_t   H5_AttID_Cvt2Phy;
    herr_t  H5_Status;
 #  ifdef PARTICLE
-   hsize_t H5_SetDims_NPar, H5_SetDims_ParData[1], H5_MemDims_ParData[1],  H5_Count_ParData[1], H5_Offset_ParData[1];
-   hid_t   H5_SetID_NPar, H5_SpaceID_NPar, H5_SpaceID_ParData, H5_GroupID_Particle, H5_SetID_ParData, H5_MemID_ParData;
+   hsize_t H5_SetDims_ParData[1], H5_MemDims_ParData[1],  H5_Count_ParData[1], H5_Offset_ParData[1];
+   hid_t   H5_SpaceID_ParData, H5_GroupID_Particle, H5_SetID_ParData, H5_MemID_ParData;
 #  endif
 #  ifdef MHD
    hsize_t H5_SetDims_FCMag[4], H5_MemDims_FCMag[4], H5_Count_FCMag[4], H5_Offset_FCMag[4];
@@ -423,6 +474,29 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 // 2-3. create the "scalar" dataspace
    H5_SpaceID_Scalar = H5Screate( H5S_SCALAR );
 
+// 2-4. set the I/O mode of grid and particle data
+//      --> wait until the previous asynchronous dump finishes
+   Output_DumpData_Total_HDF5_Flush();
+
+   const bool AsyncIO    = ( OPT__OUTPUT_HDF5_ASYNC  &&  AsyncIO_Init( FileName, NFieldStored ) );
+   const bool ParallelIO = ( !AsyncIO  &&  ( OPT__OUTPUT_HDF5_COLLECTIVE || OPT__OUTPUT_HDF5_AGGREGATE ) );
+
+   if ( ParallelIO )    ParallelIO_Init();
+
+// allocate the file space of all datasets in advance for the asynchronous and collective I/O
+   if ( AsyncIO )
+   H5_Status             = H5Pset_alloc_time( H5_DataCreatePropList, H5D_ALLOC_TIME_EARLY );
+#  ifdef H5_HAVE_PARALLEL
+   if ( OPT__OUTPUT_HDF5_COLLECTIVE  &&  ParallelIO )
+   H5_Status             = H5Pset_alloc_time( H5_DataCreatePropList, H5D_ALLOC_TIME_EARLY );
+#  endif
+
+// file addresses of all datasets for the asynchronous I/O
+   long H5_Addr_Field[NFIELD_STORED_MAX];
+#  ifdef MHD
+   long H5_Addr_FCMag[NCOMP_MAG];
+#  endif
+
 
 
 // 3. output the simulation information
@@ -488,22 +562,45 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 // 4. output the AMR tree structure (father, son, sibling, LBIdx, corner, and the number of particles --> sorted by GID)
-   int root = 0;
-
+//    --> each rank writes the tree of its own real patches at the offsets pc.GID_Offset[] so that the tree of all
+//        patches is never gathered onto a single rank
 // 4-1. allocate lists
-   LB_LocalPatchExchangeList  lel;
-   LB_GlobalPatchExchangeList gel( pc, root );
+   LB_LocalPatchExchangeList lel;
 
 // 4-2. collect and sort LBIdx from all ranks
-   LB_AllgatherLBIdx( pc, lel, &gel );
+//      --> not required for LOAD_BALANCE, for which LB_FillLocalPatchExchangeList() resolves the GIDs of remote
+//          patches by exchanging their LBIdx with the home ranks only
+#  ifndef LOAD_BALANCE
+   LB_AllgatherLBIdx( pc, lel );
+#  endif
 
 // 4-3. store the local tree
    LB_FillLocalPatchExchangeList( pc, lel );
 
-// 4-4. gather data from all ranks
-   LB_FillGlobalPatchExchangeList( pc, lel, gel, root );
+// 4-4. prepare the dataspaces of all tree datasets
+#  ifdef PARTICLE
+   const int    NTreeSet = 6;
+#  else
+   const int    NTreeSet = 5;
+#  endif
+   const char  *TreeSetName [6] = { "LBIdx", "Corner", "Father", "Son", "Sibling", "NPar" };
+   const hid_t  TreeTypeID  [6] = { H5T_NATIVE_LONG, H5T_NATIVE_INT, H5T_NATIVE_INT, H5T_NATIVE_INT, H5T_NATIVE_INT,
+                                    H5T_NATIVE_INT };
+   const int    TreeNElem1  [6] = { 1, 3, 1, 1, 26, 1 };
+   hid_t        H5_SpaceID_Tree[6];
+   hsize_t      H5_SetDims_Tree[2], H5_MemDims_Tree[2], H5_Offset_Tree[2], H5_Count_Tree[2];
+   hid_t        H5_SetID_Tree, H5_MemID_Tree;
+
+   for (int v=0; v<NTreeSet; v++)
+   {
+      H5_SetDims_Tree[0] = pc.NPatchAllLv;
+      H5_SetDims_Tree[1] = TreeNElem1[v];
+
+      H5_SpaceID_Tree[v] = H5Screate_simple( ( TreeNElem1[v] == 1 ) ? 1 : 2, H5_SetDims_Tree, NULL );
+      if ( H5_SpaceID_Tree[v] < 0 )    Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", TreeSetName[v] );
+   }
 
-// 4-5. dump the tree info
+// 4-5. create the "Tree" group and datasets
    if ( MPI_Rank == 0 )
    {
 //    reopen file
@@ -513,95 +610,113 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_GroupID_Tree = H5Gcreate( H5_FileID, "Tree", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
       if ( H5_GroupID_Tree < 0 )    Aux_Error( ERROR_INFO, "failed to create the group \"%s\" !!\n", "Tree" );
 
-//    4-5-1. LBIdx
-      H5_SetDims_LBIdx = pc.NPatchAllLv;
-      H5_SpaceID_LBIdx = H5Screate_simple( 1, &H5_SetDims_LBIdx, NULL );
-      H5_SetID_LBIdx   = H5Dcreate( H5_GroupID_Tree, "LBIdx", H5T_NATIVE_LONG, H5_SpaceID_LBIdx,
+      for (int v=0; v<NTreeSet; v++)
+      {
+         H5_SetID_Tree = H5Dcreate( H5_GroupID_Tree, TreeSetName[v], TreeTypeID[v], H5_SpaceID_Tree[v],
                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+         if ( H5_SetID_Tree < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", TreeSetName[v] );
 
-      if ( H5_SetID_LBIdx < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "LBIdx" );
+//       attach the attribute for converting corner to physical coordinates
+         if ( v == 1 )
+         {
+            H5_AttID_Cvt2Phy = H5Acreate( H5_SetID_Tree, "Cvt2Phy", H5T_NATIVE_DOUBLE, H5_SpaceID_Scalar,
+                                          H5P_DEFAULT, H5P_DEFAULT );
 
-      H5_Status = H5Dwrite( H5_SetID_LBIdx, H5T_NATIVE_LONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.LBIdxList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_LBIdx );
-      H5_Status = H5Sclose( H5_SpaceID_LBIdx );
+            if ( H5_AttID_Cvt2Phy < 0 )   Aux_Error( ERROR_INFO, "failed to create the attribute \"%s\" !!\n", "Cvt2Phy" );
 
-//    4-5-2. corner
-      H5_SetDims_Cr[0] = pc.NPatchAllLv;
-      H5_SetDims_Cr[1] = 3;
-      H5_SpaceID_Cr    = H5Screate_simple( 2, H5_SetDims_Cr, NULL );
-      H5_SetID_Cr      = H5Dcreate( H5_GroupID_Tree, "Corner", H5T_NATIVE_INT, H5_SpaceID_Cr,
-                                    H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+            H5_Status = H5Awrite( H5_AttID_Cvt2Phy, H5T_NATIVE_DOUBLE, &amr->dh[TOP_LEVEL] );
+            H5_Status = H5Aclose( H5_AttID_Cvt2Phy );
+         }
 
-      if ( H5_SetID_Cr < 0 )    Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Corner" );
+         H5_Status = H5Dclose( H5_SetID_Tree );
+      }
 
-//    attach the attribute for converting corner to physical coordinates
-      H5_AttID_Cvt2Phy = H5Acreate( H5_SetID_Cr, "Cvt2Phy", H5T_NATIVE_DOUBLE, H5_SpaceID_Scalar,
-                                    H5P_DEFAULT, H5P_DEFAULT );
+//    close file
+      H5_Status = H5Gclose( H5_GroupID_Tree );
+      H5_Status = H5Fclose( H5_FileID );
+   } // if ( MPI_Rank == 0 )
 
-      if ( H5_AttID_Cvt2Phy < 0 )   Aux_Error( ERROR_INFO, "failed to create the attribute \"%s\" !!\n", "Cvt2Phy" );
+   MPI_Barrier( MPI_COMM_WORLD );
 
-      H5_Status = H5Awrite( H5_AttID_Cvt2Phy, H5T_NATIVE_DOUBLE, &amr->dh[TOP_LEVEL] );
-      H5_Status = H5Aclose( H5_AttID_Cvt2Phy );
+// 4-6. dump the local tree one level at a time
+//      --> all ranks work together when ParallelIO is on, and take turns otherwise
+//      --> AsyncIO does not apply since the tree data are small
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const void *TreeData[6] = { lel.LBIdxList_Local[lv], lel.CrList_Local[lv], lel.FaList_Local[lv],
+                                  lel.SonList_Local[lv], lel.SibList_Local[lv],
+#                                 ifdef PARTICLE
+                                  lel.NParList_Local[lv]
+#                                 else
+                                  NULL
+#                                 endif
+                                };
+
+      const int NTurn = ( ParallelIO ) ? 1 : MPI_NRank;
+
+      for (int TRank=0; TRank<NTurn; TRank++)
+      {
+         if ( ParallelIO  ||  MPI_Rank == TRank )
+         {
+            if ( ParallelIO )
+               H5_FileID = ParallelIO_OpenFile( FileName, "Tree", H5_GroupID_Tree );
 
-      H5_Status = H5Dwrite( H5_SetID_Cr, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.CrList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_Cr );
-      H5_Status = H5Sclose( H5_SpaceID_Cr );
+            else
+            {
+//             HDF5 file must be synchronized before being written by the next rank
+               SyncHDF5File( FileName );
 
-//    4-5-3. father
-      H5_SetDims_Fa = pc.NPatchAllLv;
-      H5_SpaceID_Fa = H5Screate_simple( 1, &H5_SetDims_Fa, NULL );
-      H5_SetID_Fa   = H5Dcreate( H5_GroupID_Tree, "Father", H5T_NATIVE_INT, H5_SpaceID_Fa,
-                                 H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+               H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
+               if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
 
-      if ( H5_SetID_Fa < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Father" );
+               H5_GroupID_Tree = H5Gopen( H5_FileID, "Tree", H5P_DEFAULT );
+               if ( H5_GroupID_Tree < 0 )    Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Tree" );
+            }
 
-      H5_Status = H5Dwrite( H5_SetID_Fa, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.FaList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_Fa );
-      H5_Status = H5Sclose( H5_SpaceID_Fa );
+            for (int v=0; v<NTreeSet; v++)
+            {
+               if ( ParallelIO )
+               {
+                  ParallelIO_WriteSlab( H5_GroupID_Tree, TreeSetName[v], H5_SpaceID_Tree[v],
+                                        TreeTypeID[v], TreeData[v], pc.GID_Offset[lv], amr->NPatchComma[lv][1], TreeNElem1[v] );
+                  continue;
+               }
 
-//    4-5-4. son
-      H5_SetDims_Son = pc.NPatchAllLv;
-      H5_SpaceID_Son = H5Screate_simple( 1, &H5_SetDims_Son, NULL );
-      H5_SetID_Son   = H5Dcreate( H5_GroupID_Tree, "Son", H5T_NATIVE_INT, H5_SpaceID_Son,
-                                  H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+               H5_MemDims_Tree[0] = amr->NPatchComma[lv][1];
+               H5_MemDims_Tree[1] = TreeNElem1[v];
+               H5_Offset_Tree [0] = pc.GID_Offset[lv];
+               H5_Offset_Tree [1] = 0;
+               H5_Count_Tree  [0] = amr->NPatchComma[lv][1];
+               H5_Count_Tree  [1] = TreeNElem1[v];
 
-      if ( H5_SetID_Son < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Son" );
+               H5_MemID_Tree = H5Screate_simple( ( TreeNElem1[v] == 1 ) ? 1 : 2, H5_MemDims_Tree, NULL );
+               if ( H5_MemID_Tree < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemID_Tree" );
 
-      H5_Status = H5Dwrite( H5_SetID_Son, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.SonList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_Son );
-      H5_Status = H5Sclose( H5_SpaceID_Son );
+               H5_Status = H5Sselect_hyperslab( H5_SpaceID_Tree[v], H5S_SELECT_SET, H5_Offset_Tree, NULL, H5_Count_Tree, NULL );
+               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for \"%s\" !!\n", TreeSetName[v] );
 
-//    4-5-5. sibling
-      H5_SetDims_Sib[0] = pc.NPatchAllLv;
-      H5_SetDims_Sib[1] = 26;
-      H5_SpaceID_Sib    = H5Screate_simple( 2, H5_SetDims_Sib, NULL );
-      H5_SetID_Sib      = H5Dcreate( H5_GroupID_Tree, "Sibling", H5T_NATIVE_INT, H5_SpaceID_Sib,
-                                     H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+               H5_SetID_Tree = H5Dopen( H5_GroupID_Tree, TreeSetName[v], H5P_DEFAULT );
 
-      if ( H5_SetID_Sib < 0 )    Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "Sibling" );
+               H5_Status = H5Dwrite( H5_SetID_Tree, TreeTypeID[v], H5_MemID_Tree, H5_SpaceID_Tree[v], H5P_DEFAULT, TreeData[v] );
+               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write \"%s\" (lv %d) !!\n", TreeSetName[v], lv );
 
-      H5_Status = H5Dwrite( H5_SetID_Sib, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.SibList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_Sib );
-      H5_Status = H5Sclose( H5_SpaceID_Sib );
+               H5_Status = H5Dclose( H5_SetID_Tree );
+               H5_Status = H5Sclose( H5_MemID_Tree );
+            } // for (int v=0; v<NTreeSet; v++)
 
-//    4-5-6. NPar
-#     ifdef PARTICLE
-      H5_SetDims_NPar = pc.NPatchAllLv;
-      H5_SpaceID_NPar = H5Screate_simple( 1, &H5_SetDims_NPar, NULL );
-      H5_SetID_NPar   = H5Dcreate( H5_GroupID_Tree, "NPar", H5T_NATIVE_INT, H5_SpaceID_NPar,
-                                   H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
+            if ( H5_FileID >= 0 )
+            {
+               H5_Status = H5Gclose( H5_GroupID_Tree );
+               H5_Status = H5Fclose( H5_FileID );
+            }
+         } // if ( ParallelIO  ||  MPI_Rank == TRank )
 
-      if ( H5_SetID_NPar < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "NPar" );
+         MPI_Barrier( MPI_COMM_WORLD );
 
-      H5_Status = H5Dwrite( H5_SetID_NPar, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, gel.NParList_AllLv );
-      H5_Status = H5Dclose( H5_SetID_NPar );
-      H5_Status = H5Sclose( H5_SpaceID_NPar );
-#     endif
+      } // for (int TRank=0; TRank<NTurn; TRank++)
+   } // for (int lv=0; lv<NLEVEL; lv++)
 
-//    close file
-      H5_Status = H5Gclose( H5_GroupID_Tree );
-      H5_Status = H5Fclose( H5_FileID );
-   } // if ( MPI_Rank == 0 )
+   for (int v=0; v<NTreeSet; v++)   H5_Status = H5Sclose( H5_SpaceID_Tree[v] );
 
 
 
@@ -654,6 +769,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
          H5_SetID_Field = H5Dcreate( H5_GroupID_GridData, FieldLabelOut[v], H5T_GAMER_REAL, H5_SpaceID_Field,
                                      H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
          if ( H5_SetID_Field < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", FieldLabelOut[v] );
+         if ( AsyncIO )    H5_Addr_Field[v] = AsyncIO_GetAddress( H5_SetID_Field );
          H5_Status = H5Dclose( H5_SetID_Field );
       }
 
@@ -664,6 +780,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
          H5_SetID_FCMag = H5Dcreate( H5_GroupID_GridData, MagLabel[v], H5T_GAMER_REAL, H5_SpaceID_FCMag[v],
                                      H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
          if ( H5_SetID_FCMag < 0 )  Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", MagLabel[v] );
+         if ( AsyncIO )    H5_Addr_FCMag[v] = AsyncIO_GetAddress( H5_SetID_FCMag );
          H5_Status = H5Dclose( H5_SetID_FCMag );
       }
 #     endif
@@ -673,6 +790,14 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_Status = H5Fclose( H5_FileID );
    } // if ( MPI_Rank == 0 )
 
+   if ( AsyncIO )
+   {
+      MPI_Bcast( H5_Addr_Field, NFieldStored, MPI_LONG, 0, MPI_COMM_WORLD );
+#     ifdef MHD
+      MPI_Bcast( H5_Addr_FCMag, NCOMP_MAG,    MPI_LONG, 0, MPI_COMM_WORLD );
+#     endif
+   }
+
 
 // 5-2. start to dump data (serial instead of parallel)
    const bool IntPhase_No         = false;
@@ -731,19 +856,34 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       }
 #     endif
 
-      for (int TRank=0; TRank<MPI_NRank; TRank++)
+//    all ranks work together when AsyncIO or ParallelIO is on
+      const int NTurn = ( AsyncIO || ParallelIO ) ? 1 : MPI_NRank;
+
+      for (int TRank=0; TRank<NTurn; TRank++)
       {
-         if ( MPI_Rank == TRank )
+         if ( AsyncIO  ||  ParallelIO  ||  MPI_Rank == TRank )
          {
-//          HDF5 file must be synchronized before being written by the next rank
-            SyncHDF5File( FileName );
+            if ( AsyncIO )
+            {
+               H5_FileID           = -1;
+               H5_GroupID_GridData = -1;
+            }
 
-//          reopen the file and group
-            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+            else if ( ParallelIO )
+               H5_FileID = ParallelIO_OpenFile( FileName, "GridData", H5_GroupID_GridData );
+
+            else
+            {
+//             HDF5 file must be synchronized before being written by the next rank
+               SyncHDF5File( FileName );
 
-            H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
-            if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+//             reopen the file and group
+               H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
+               if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+               H5_GroupID_GridData = H5Gopen( H5_FileID, "GridData", H5P_DEFAULT );
+               if ( H5_GroupID_GridData < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "GridData" );
+            }
 
 
 //          5-2-1. dump cell-centered data
@@ -772,6 +912,26 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the grid data !!\n" );
 
 
+//          5-2-1-2-1. memory space of the fluid slab for OPT__PATCH_SLAB
+//                     --> fluid variables are written directly from the slab without copying to FieldData[]
+//                     --> the slab is viewed as a 2D array [NPatch][Stride/sizeof(real)], from which we select
+//                         the CUBE(PS1) elements of the target field in each row
+            long  FluSlabStride  = 0;
+            char *FluSlab        = ( OPT__PATCH_SLAB  &&  !AsyncIO  &&  !ParallelIO ) ?
+                                   amr->SlabView( SLAB_FLU, amr->FluSg[lv], lv, amr->NPatchComma[lv][1], FluSlabStride ) : NULL;
+            hid_t H5_MemID_FluSlab = -1;
+
+            if ( FluSlab != NULL )
+            {
+               if ( FluSlabStride == 0 )  FluSlabStride = NCOMP_TOTAL*FieldSizeOnePatch;
+
+               const hsize_t H5_MemDims_FluSlab[2] = { (hsize_t)amr->NPatchComma[lv][1], (hsize_t)( FluSlabStride/sizeof(real) ) };
+
+               H5_MemID_FluSlab = H5Screate_simple( 2, H5_MemDims_FluSlab, NULL );
+               if ( H5_MemID_FluSlab < 0 )   Aux_Error( ERROR_INFO, "failed to create the space \"%s\" !!\n", "H5_MemDims_FluSlab" );
+            }
+
+
 //          output one field at one level in one rank at a time
             FieldData = new real [ amr->NPatchComma[lv][1] ][PS1][PS1][PS1];
 
@@ -1113,6 +1273,26 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 //             e. fluid variables
                else if ( v >= FluDumpIdx0  &&  v < FluDumpIdx0+NCOMP_TOTAL )
                {
+//                e1. write directly from the fluid slab
+                  if ( FluSlab != NULL )
+                  {
+                     const hsize_t H5_Offset_FluSlab[2] = { 0, (hsize_t)v*CUBE(PS1) };
+                     const hsize_t H5_Count_FluSlab [2] = { (hsize_t)amr->NPatchComma[lv][1], CUBE(PS1) };
+
+                     H5_Status = H5Sselect_hyperslab( H5_MemID_FluSlab, H5S_SELECT_SET, H5_Offset_FluSlab, NULL, H5_Count_FluSlab, NULL );
+                     if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the fluid slab !!\n" );
+
+                     H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
+
+                     H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_FluSlab, H5_SpaceID_Field, H5P_DEFAULT, FluSlab );
+                     if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+
+                     H5_Status = H5Dclose( H5_SetID_Field );
+
+                     continue;
+                  }
+
+//                e2. copy to FieldData[]
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
                      memcpy( FieldData[PID], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v], FieldSizeOnePatch );
                }
@@ -1122,12 +1302,23 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-2-1-4. write data to disk
-               H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
+               if ( AsyncIO )
+                  AsyncIO_Stage( H5_Addr_Field[v], (long)pc.GID_Offset[lv]*CUBE(PS1)*sizeof(real), FieldData,
+                                 (long)amr->NPatchComma[lv][1]*CUBE(PS1)*sizeof(real) );
+
+               else if ( ParallelIO )
+                  ParallelIO_WriteSlab( H5_GroupID_GridData, FieldLabelOut[v], H5_SpaceID_Field,
+                                        H5T_GAMER_REAL, FieldData, pc.GID_Offset[lv], amr->NPatchComma[lv][1], CUBE(PS1) );
 
-               H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT, FieldData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
+               else
+               {
+                  H5_SetID_Field = H5Dopen( H5_GroupID_GridData, FieldLabelOut[v], H5P_DEFAULT );
+
+                  H5_Status = H5Dwrite( H5_SetID_Field, H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT, FieldData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write a field (lv %d, v %d) !!\n", lv, v );
 
-               H5_Status = H5Dclose( H5_SetID_Field );
+                  H5_Status = H5Dclose( H5_SetID_Field );
+               }
             } // for (int v=0; v<NFieldStored; v++)
 
 
@@ -1135,6 +1326,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             delete [] FieldData;
 
             H5_Status = H5Sclose( H5_MemID_Field );
+            if ( H5_MemID_FluSlab >= 0 )  H5_Status = H5Sclose( H5_MemID_FluSlab );
 
 //          free memory used for outputting particle density
 #           ifdef MASSIVE_PARTICLES
@@ -1184,12 +1376,24 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //             5-2-2-4. write data to disk
-               H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
+               if ( AsyncIO )
+                  AsyncIO_Stage( H5_Addr_FCMag[v], (long)pc.GID_Offset[lv]*PS1P1*SQR(PS1)*sizeof(real), FCMagData,
+                                 (long)amr->NPatchComma[lv][1]*PS1P1*SQR(PS1)*sizeof(real) );
 
-               H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5P_DEFAULT, FCMagData );
-               if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+               else if ( ParallelIO )
+                  ParallelIO_WriteSlab( H5_GroupID_GridData, MagLabel[v], H5_SpaceID_FCMag[v],
+                                        H5T_GAMER_REAL, FCMagData, pc.GID_Offset[lv], amr->NPatchComma[lv][1], PS1P1*SQR(PS1) );
+
+               else
+               {
+                  H5_SetID_FCMag = H5Dopen( H5_GroupID_GridData, MagLabel[v], H5P_DEFAULT );
+
+                  H5_Status = H5Dwrite( H5_SetID_FCMag, H5T_GAMER_REAL, H5_MemID_FCMag, H5_SpaceID_FCMag[v], H5P_DEFAULT, FCMagData );
+                  if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write magnetic field (lv %d, v %d) !!\n", lv, v );
+
+                  H5_Status = H5Dclose( H5_SetID_FCMag );
+               }
 
-               H5_Status = H5Dclose( H5_SetID_FCMag );
                H5_Status = H5Sclose( H5_MemID_FCMag );
             } // for (int v=0; v<NCOMP_MAG; v++)
 
@@ -1198,13 +1402,16 @@ void Output_DumpData_Total_HDF5( const char *FileName )
             delete [] FCMagData;
 #           endif // #ifdef MHD
 
-            H5_Status = H5Gclose( H5_GroupID_GridData );
-            H5_Status = H5Fclose( H5_FileID );
-         } // if ( MPI_Rank == TRank )
+            if ( H5_FileID >= 0 )
+            {
+               H5_Status = H5Gclose( H5_GroupID_GridData );
+               H5_Status = H5Fclose( H5_FileID );
+            }
+         } // if ( AsyncIO  ||  ParallelIO  ||  MPI_Rank == TRank )
 
          MPI_Barrier( MPI_COMM_WORLD );
 
-      } // for (int TRank=0; TRank<MPI_NRank; TRank++)
+      } // for (int TRank=0; TRank<NTurn; TRank++)
 
       delete [] PID0List;
    } // for (int lv=0; lv<NLEVEL; lv++)
@@ -1234,6 +1441,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    real_par (*ParBuf1v1Lv)             = NULL;   // buffer storing the data of one particle attribute at one level
 
    long  GParID_Offset[NLEVEL];  // GParID = global particle index (==> unique for each particle)
+   long  H5_Addr_ParData[PAR_NATT_STORED];
    long  NParLv_AllRank[NLEVEL];
    long  MaxNPar1Lv, NParInBuf, ParID;
 
@@ -1283,6 +1491,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
          H5_SetID_ParData = H5Dcreate( H5_GroupID_Particle, ParAttLabel[v], H5T_GAMER_REAL_PAR, H5_SpaceID_ParData,
                                        H5P_DEFAULT, H5_DataCreatePropList, H5P_DEFAULT );
          if ( H5_SetID_ParData < 0 )   Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", ParAttLabel[v] );
+         if ( AsyncIO )    H5_Addr_ParData[v] = AsyncIO_GetAddress( H5_SetID_ParData );
          H5_Status = H5Dclose( H5_SetID_ParData );
       }
 
@@ -1291,23 +1500,40 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_Status = H5Fclose( H5_FileID );
    } // if ( MPI_Rank == 0 )
 
+   if ( AsyncIO )    MPI_Bcast( H5_Addr_ParData, PAR_NATT_STORED, MPI_LONG, 0, MPI_COMM_WORLD );
+
 
 // 6-3. start to dump particle data (one level, one rank, and one attribute at a time)
 //      --> note that particles must be outputted in the same order as their associated patches
+//      --> all ranks work together when AsyncIO or ParallelIO is on
+   const int NTurn = ( AsyncIO || ParallelIO ) ? 1 : MPI_NRank;
+
    for (int lv=0; lv<NLEVEL; lv++)
-   for (int TRank=0; TRank<MPI_NRank; TRank++)
+   for (int TRank=0; TRank<NTurn; TRank++)
    {
-      if ( MPI_Rank == TRank )
+      if ( AsyncIO  ||  ParallelIO  ||  MPI_Rank == TRank )
       {
-//       HDF5 file must be synchronized before being written by the next rank
-         SyncHDF5File( FileName );
+         if ( AsyncIO )
+         {
+            H5_FileID           = -1;
+            H5_GroupID_Particle = -1;
+         }
+
+         else if ( ParallelIO )
+            H5_FileID = ParallelIO_OpenFile( FileName, "Particle", H5_GroupID_Particle );
 
-//       reopen the file and group
-         H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
-         if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+         else
+         {
+//          HDF5 file must be synchronized before being written by the next rank
+            SyncHDF5File( FileName );
 
-         H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
-         if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+//          reopen the file and group
+            H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5P_DEFAULT );
+            if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+            H5_GroupID_Particle = H5Gopen( H5_FileID, "Particle", H5P_DEFAULT );
+            if ( H5_GroupID_Particle < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", "Particle" );
+         }
 
 
 //       6-3-1. determine the memory space
@@ -1346,24 +1572,39 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 //          6-3-4. write data to disk
-            H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
+            if ( AsyncIO )
+               AsyncIO_Stage( H5_Addr_ParData[v], GParID_Offset[lv]*sizeof(real_par), ParBuf1v1Lv,
+                              amr->Par->NPar_Lv[lv]*sizeof(real_par) );
 
-            H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL_PAR, H5_MemID_ParData, H5_SpaceID_ParData, H5P_DEFAULT, ParBuf1v1Lv );
-            if ( H5_Status < 0 )
-               Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
+            else if ( ParallelIO )
+               ParallelIO_WriteSlab( H5_GroupID_Particle, ParAttLabel[v], H5_SpaceID_ParData,
+                                     H5T_GAMER_REAL_PAR, ParBuf1v1Lv, GParID_Offset[lv], amr->Par->NPar_Lv[lv], 1 );
 
-            H5_Status = H5Dclose( H5_SetID_ParData );
+            else
+            {
+               H5_SetID_ParData = H5Dopen( H5_GroupID_Particle, ParAttLabel[v], H5P_DEFAULT );
+
+               H5_Status = H5Dwrite( H5_SetID_ParData, H5T_GAMER_REAL_PAR, H5_MemID_ParData, H5_SpaceID_ParData, H5P_DEFAULT, ParBuf1v1Lv );
+               if ( H5_Status < 0 )
+                  Aux_Error( ERROR_INFO, "failed to write a particle attribute (lv %d, v %d) !!\n", lv, v );
+
+               H5_Status = H5Dclose( H5_SetID_ParData );
+            }
          } // for (int v=0; v<PAR_NATT_STORED; v++)
 
 //       free resource
          H5_Status = H5Sclose( H5_MemID_ParData );
-         H5_Status = H5Gclose( H5_GroupID_Particle );
-         H5_Status = H5Fclose( H5_FileID );
-      } // if ( MPI_Rank == TRank )
+
+         if ( H5_FileID >= 0 )
+         {
+            H5_Status = H5Gclose( H5_GroupID_Particle );
+            H5_Status = H5Fclose( H5_FileID );
+         }
+      } // if ( AsyncIO  ||  ParallelIO  ||  MPI_Rank == TRank )
 
       MPI_Barrier( MPI_COMM_WORLD );
 
-   } // for (int TRank=0; TRank<MPI_NRank; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
+   } // for (int TRank=0; TRank<NTurn; TRank++) ... for (int lv=0; lv<NLEVEL; lv++)
 
    H5_Status = H5Sclose( H5_SpaceID_ParData );
 
@@ -1482,6 +1723,11 @@ void Output_DumpData_Total_HDF5( const char *FileName )
    H5_Status = H5Sclose( H5_SpaceID_Scalar );
    H5_Status = H5Pclose( H5_DataCreatePropList );
 
+   if ( ParallelIO )    ParallelIO_End();
+
+// 9. start writing the staged data in the background
+   if ( AsyncIO )       AsyncIO_Start();
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d)     ... done\n", __FUNCTION__, DumpID );
 
 } // FUNCTION : Output_DumpData_Total_HDF5
@@ -3680,4 +3926,528 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 
 
 
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ParallelIO_Init
+// Description :  Set the MPI communicators for OPT__OUTPUT_HDF5_COLLECTIVE and OPT__OUTPUT_HDF5_AGGREGATE
+//
+// Note        :  1. OPT__OUTPUT_HDF5_AGGREGATE on : ranks on the same node share one writer (the lowest rank)
+//                   OPT__OUTPUT_HDF5_AGGREGATE off: every rank is a writer
+//                2. H5_WriterComm includes all writers and is MPI_COMM_NULL on non-writers
+//                3. Must be freed by ParallelIO_End()
+//-------------------------------------------------------------------------------------------------------
+void ParallelIO_Init()
+{
+
+#  ifdef SERIAL
+   Aux_Error( ERROR_INFO, "OPT__OUTPUT_HDF5_COLLECTIVE and OPT__OUTPUT_HDF5_AGGREGATE do not support SERIAL !!\n" );
+#  else
+
+#  ifndef H5_HAVE_PARALLEL
+   if ( OPT__OUTPUT_HDF5_COLLECTIVE )
+      Aux_Error( ERROR_INFO, "OPT__OUTPUT_HDF5_COLLECTIVE requires HDF5 built with parallel support !!\n" );
+#  endif
+
+// 1. ranks sharing the same writer
+   if ( OPT__OUTPUT_HDF5_AGGREGATE )
+      MPI_Comm_split_type( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, MPI_Rank, MPI_INFO_NULL, &H5_AggComm );
+   else
+      MPI_Comm_dup( MPI_COMM_SELF, &H5_AggComm );
+
+// 2. all writers
+   int AggRank;
+   MPI_Comm_rank( H5_AggComm, &AggRank );
+   MPI_Comm_split( MPI_COMM_WORLD, (AggRank==0)?0:MPI_UNDEFINED, MPI_Rank, &H5_WriterComm );
+
+#  endif // #ifdef SERIAL ... else ...
+
+} // FUNCTION : ParallelIO_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ParallelIO_End
+// Description :  Free the MPI communicators set by ParallelIO_Init()
+//-------------------------------------------------------------------------------------------------------
+void ParallelIO_End()
+{
+
+#  ifndef SERIAL
+   if ( H5_WriterComm != MPI_COMM_NULL )  MPI_Comm_free( &H5_WriterComm );
+   if ( H5_AggComm    != MPI_COMM_NULL )  MPI_Comm_free( &H5_AggComm    );
+#  endif
+
+} // FUNCTION : ParallelIO_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ParallelIO_OpenFile
+// Description :  Open the target HDF5 file on all writers for the collective I/O
+//
+// Note        :  1. Collective operation in H5_WriterComm
+//                2. Do nothing on non-writers
+//
+// Parameter   :  FileName   : Name of the target HDF5 file
+//                GroupName  : Name of the target group
+//                H5_GroupID : HDF5 group ID to be returned (-1 if the file is not opened)
+//
+// Return      :  HDF5 file ID on writers, and -1 otherwise
+//                H5_GroupID
+//-------------------------------------------------------------------------------------------------------
+hid_t ParallelIO_OpenFile( const char *FileName, const char *GroupName, hid_t &H5_GroupID )
+{
+
+   hid_t H5_FileID = -1;
+   H5_GroupID = -1;
+
+#  if ( !defined SERIAL  &&  defined H5_HAVE_PARALLEL )
+   if ( H5_WriterComm != MPI_COMM_NULL )
+   {
+      const hid_t H5_FileAccPropList = H5Pcreate( H5P_FILE_ACCESS );
+
+      H5Pset_fapl_mpio( H5_FileAccPropList, H5_WriterComm, MPI_INFO_NULL );
+
+      H5_FileID = H5Fopen( FileName, H5F_ACC_RDWR, H5_FileAccPropList );
+      if ( H5_FileID < 0 )    Aux_Error( ERROR_INFO, "failed to open the HDF5 file \"%s\" !!\n", FileName );
+
+      H5_GroupID = H5Gopen( H5_FileID, GroupName, H5P_DEFAULT );
+      if ( H5_GroupID < 0 )   Aux_Error( ERROR_INFO, "failed to open the group \"%s\" !!\n", GroupName );
+
+      H5Pclose( H5_FileAccPropList );
+   }
+#  endif
+
+   return H5_FileID;
+
+} // FUNCTION : ParallelIO_OpenFile
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ParallelIO_WriteSlab
+// Description :  Write a contiguous slab from each rank to the target dataset in parallel
+//
+// Note        :  1. Collective operation in MPI_COMM_WORLD
+//                2. Each rank owns the items [Offset, Offset+Count) along the first dimension of the dataset
+//                   --> Items are the patches for grid data and the particles for particle data
+//                   --> The slabs of different ranks must not overlap
+//                3. Slabs are first gathered onto the writer of each H5_AggComm and sorted by their offsets
+//                   --> Adjacent slabs are merged into a single hyperslab
+//                4. All writers write in one collective MPI-IO call
+//                   --> OPT__OUTPUT_HDF5_AGGREGATE must work with OPT__OUTPUT_HDF5_COLLECTIVE, which is checked
+//                       by Aux_Check_Parameter()
+//
+// Parameter   :  H5_GroupID      : HDF5 group ID returned by ParallelIO_OpenFile()
+//                SetName         : Name of the target dataset
+//                H5_SpaceID_File : Dataspace of the target dataset
+//                H5_TypeID       : HDF5 data type of the target dataset
+//                Data            : Data to be written by this rank
+//                Offset          : Index of the first item of this rank along the first dimension
+//                Count           : Number of items of this rank
+//                NElem1          : Number of elements per item (e.g., CUBE(PS1) for a patch)
+//-------------------------------------------------------------------------------------------------------
+void ParallelIO_WriteSlab( const hid_t H5_GroupID, const char *SetName, const hid_t H5_SpaceID_File,
+                           const hid_t H5_TypeID, const void *Data, const long Offset, const int Count,
+                           const long NElem1 )
+{
+
+#  ifdef SERIAL
+   Aux_Error( ERROR_INFO, "OPT__OUTPUT_HDF5_COLLECTIVE and OPT__OUTPUT_HDF5_AGGREGATE do not support SERIAL !!\n" );
+#  else
+
+   const long ItemSize = (long)H5Tget_size( H5_TypeID )*NElem1;
+
+   if ( ItemSize > __INT_MAX__ )
+      Aux_Error( ERROR_INFO, "ItemSize (%ld) > __INT_MAX__ !!\n", ItemSize );
+
+   int AggRank, AggNRank;
+   MPI_Comm_rank( H5_AggComm, &AggRank  );
+   MPI_Comm_size( H5_AggComm, &AggNRank );
+
+   const bool IsWriter = ( AggRank == 0 );
+
+
+// 1. gather the offsets and counts of all ranks onto the writer
+   long  SlabInfo[2] = { Offset, (long)Count };
+   long *SlabInfo_All = NULL, *SlabOffset = NULL;
+   int  *SlabIdx = NULL, *RecvCount = NULL, *RecvDisp = NULL;
+   long  NItem = 0L;
+
+   if ( IsWriter )
+   {
+      SlabInfo_All = new long [ 2*AggNRank ];
+      SlabOffset   = new long [ AggNRank ];
+      SlabIdx      = new int  [ AggNRank ];
+      RecvCount    = new int  [ AggNRank ];
+      RecvDisp     = new int  [ AggNRank ];
+   }
+
+   MPI_Gather( SlabInfo, 2, MPI_LONG, SlabInfo_All, 2, MPI_LONG, 0, H5_AggComm );
+
+
+// 2. sort slabs by their offsets so that the gathered data follow the order in the file
+   if ( IsWriter )
+   {
+      for (int r=0; r<AggNRank; r++)   SlabOffset[r] = SlabInfo_All[2*r];
+
+      Mis_Heapsort( AggNRank, SlabOffset, SlabIdx );
+
+      for (int t=0; t<AggNRank; t++)
+      {
+         const int r = SlabIdx[t];
+
+         RecvCount[r] = (int)SlabInfo_All[ 2*r + 1 ];
+         RecvDisp [r] = (int)NItem;
+         NItem       += RecvCount[r];
+      }
+
+      if ( NItem > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "number of items to be written by a single writer (%ld) > __INT_MAX__ !!\n", NItem );
+   }
+
+
+// 3. gather data onto the writer
+   char *AggData = NULL;
+
+   if ( AggNRank == 1 )
+      AggData = (char*)Data;
+
+   else
+   {
+      MPI_Datatype MPI_Item;
+      MPI_Type_contiguous( (int)ItemSize, MPI_BYTE, &MPI_Item );
+      MPI_Type_commit( &MPI_Item );
+
+      if ( IsWriter )   AggData = new char [ MAX( NItem, 1L )*ItemSize ];
+
+      MPI_Gatherv( (void*)Data, Count, MPI_Item, AggData, RecvCount, RecvDisp, MPI_Item, 0, H5_AggComm );
+
+      MPI_Type_free( &MPI_Item );
+   }
+
+
+// 4. write data to disk
+   if ( IsWriter )
+   {
+//    4-1. select the union of all slabs in the file space
+      const int NDim = H5Sget_simple_extent_ndims( H5_SpaceID_File );
+      hsize_t H5_Dims[4], H5_Offset[4], H5_Count[4];
+
+      if ( NDim < 1  ||  NDim > 4 )    Aux_Error( ERROR_INFO, "incorrect number of dimensions (%d) !!\n", NDim );
+
+      H5Sget_simple_extent_dims( H5_SpaceID_File, H5_Dims, NULL );
+
+      for (int d=1; d<NDim; d++)
+      {
+         H5_Offset[d] = 0;
+         H5_Count [d] = H5_Dims[d];
+      }
+
+      const hid_t H5_FileSpace = H5Scopy( H5_SpaceID_File );
+      bool  FirstSlab = true;
+      herr_t H5_Status;
+
+      H5Sselect_none( H5_FileSpace );
+
+      for (int t=0; t<AggNRank; t++)
+      {
+         const int  r     = SlabIdx[t];
+         const long Start = SlabInfo_All[ 2*r ];
+         const long Len   = RecvCount[r];
+
+         if ( Len == 0L )  continue;
+
+//       merge the adjacent slabs
+         long End = Start + Len;
+         while ( t+1 < AggNRank  &&  ( RecvCount[ SlabIdx[t+1] ] == 0  ||  SlabInfo_All[ 2*SlabIdx[t+1] ] == End ) )
+            End += RecvCount[ SlabIdx[++t] ];
+
+         H5_Offset[0] = Start;
+         H5_Count [0] = End - Start;
+
+         H5_Status = H5Sselect_hyperslab( H5_FileSpace, (FirstSlab)?H5S_SELECT_SET:H5S_SELECT_OR, H5_Offset, NULL, H5_Count, NULL );
+         if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the dataset \"%s\" !!\n", SetName );
+
+         FirstSlab = false;
+      }
+
+//    4-2. memory space
+      hsize_t H5_MemDims[1] = { (hsize_t)MAX( NItem*NElem1, 1L ) };
+      const hid_t H5_MemSpace = H5Screate_simple( 1, H5_MemDims, NULL );
+      if ( NItem == 0L )   H5Sselect_none( H5_MemSpace );
+
+//    4-3. collective write
+#     ifdef H5_HAVE_PARALLEL
+      const hid_t H5_SetID        = H5Dopen( H5_GroupID, SetName, H5P_DEFAULT );
+      const hid_t H5_XferPropList = H5Pcreate( H5P_DATASET_XFER );
+      if ( H5_SetID < 0 )  Aux_Error( ERROR_INFO, "failed to open the dataset \"%s\" !!\n", SetName );
+
+      H5Pset_dxpl_mpio( H5_XferPropList, H5FD_MPIO_COLLECTIVE );
+
+      H5_Status = H5Dwrite( H5_SetID, H5_TypeID, H5_MemSpace, H5_FileSpace, H5_XferPropList, AggData );
+      if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to write the dataset \"%s\" !!\n", SetName );
+
+      H5Pclose( H5_XferPropList );
+      H5Dclose( H5_SetID );
+#     endif
+
+      H5Sclose( H5_MemSpace );
+      H5Sclose( H5_FileSpace );
+   } // if ( IsWriter )
+
+
+// 5. free memory
+   if ( AggData != Data )  delete [] AggData;
+
+   delete [] SlabInfo_All;
+   delete [] SlabOffset;
+   delete [] SlabIdx;
+   delete [] RecvCount;
+   delete [] RecvDisp;
+
+#  endif // #ifdef SERIAL ... else ...
+
+} // FUNCTION : ParallelIO_WriteSlab
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_Init
+// Description :  Allocate the staging buffer for OPT__OUTPUT_HDF5_ASYNC
+//
+// Note        :  1. Collective operation in MPI_COMM_WORLD
+//                2. Staging buffer stores all grid and particle data of this rank
+//                3. Return false without allocating anything if the staging buffer exceeds
+//                   OUTPUT_HDF5_ASYNC_MAX_MEM on any rank
+//                   --> Output_DumpData_Total_HDF5() will then write data synchronously
+//
+// Parameter   :  FileName     : Name of the target HDF5 file
+//                NFieldStored : Number of cell-centered fields to be stored
+//
+// Return      :  true/false --> staging buffer is/isn't allocated
+//-------------------------------------------------------------------------------------------------------
+bool AsyncIO_Init( const char *FileName, const int NFieldStored )
+{
+
+   if ( AsyncIO_Active )   Aux_Error( ERROR_INFO, "previous asynchronous data dump has not been flushed !!\n" );
+
+
+// 1. get the size of the staging buffer
+   long BufSize = 0L, BufSize_Max;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+      BufSize += (long)amr->NPatchComma[lv][1]*( NFieldStored*CUBE(PS1) + NCOMP_MAG*PS1P1*SQR(PS1) )*sizeof(real);
+
+#  ifdef PARTICLE
+   for (int lv=0; lv<NLEVEL; lv++)
+      BufSize += amr->Par->NPar_Lv[lv]*PAR_NATT_STORED*sizeof(real_par);
+#  endif
+
+   MPI_Allreduce( &BufSize, &BufSize_Max, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   if ( BufSize_Max > (long)( OUTPUT_HDF5_ASYNC_MAX_MEM*1024.0*1024.0 ) )
+   {
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : staging buffer (%.2f MB) > OUTPUT_HDF5_ASYNC_MAX_MEM (%.2f MB) --> dump \"%s\" synchronously !!\n",
+                      BufSize_Max/1024.0/1024.0, OUTPUT_HDF5_ASYNC_MAX_MEM, FileName );
+
+      return false;
+   }
+
+
+// 2. allocate memory
+   const int MaxNChunk = NLEVEL*( NFieldStored + NCOMP_MAG )
+#                       ifdef PARTICLE
+                        + NLEVEL*PAR_NATT_STORED
+#                       endif
+                        ;
+
+   strcpy( AsyncIO_FileName, FileName );
+
+   AsyncIO_BufSize      = BufSize;
+   AsyncIO_BufUsed      = 0L;
+   AsyncIO_NChunk       = 0;
+   AsyncIO_MaxNChunk    = MaxNChunk;
+   AsyncIO_Buf          = new char [ MAX( BufSize, 1L ) ];
+   AsyncIO_ChunkFileOff = new long [MaxNChunk];
+   AsyncIO_ChunkBufOff  = new long [MaxNChunk];
+   AsyncIO_ChunkSize    = new long [MaxNChunk];
+   AsyncIO_Failed       = false;
+
+   return true;
+
+} // FUNCTION : AsyncIO_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_GetAddress
+// Description :  Get the file address of the raw data of the target dataset
+//
+// Note        :  1. Target dataset must use contiguous layout with early allocation
+//
+// Parameter   :  H5_SetID : Target HDF5 dataset
+//
+// Return      :  File address in bytes (-1 if the dataset is empty)
+//-------------------------------------------------------------------------------------------------------
+long AsyncIO_GetAddress( const hid_t H5_SetID )
+{
+
+   const haddr_t H5_Addr = H5Dget_offset( H5_SetID );
+
+   return ( H5_Addr == HADDR_UNDEF ) ? -1L : (long)H5_Addr;
+
+} // FUNCTION : AsyncIO_GetAddress
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_Stage
+// Description :  Copy data to the staging buffer of the asynchronous I/O
+//
+// Parameter   :  SetAddr : File address of the target dataset returned by AsyncIO_GetAddress()
+//                Offset  : Offset of the data in the target dataset in bytes
+//                Data    : Data to be staged
+//                Size    : Size of the data in bytes
+//-------------------------------------------------------------------------------------------------------
+void AsyncIO_Stage( const long SetAddr, const long Offset, const void *Data, const long Size )
+{
+
+   if ( Size == 0L )    return;
+
+// check
+   if ( SetAddr < 0L )
+      Aux_Error( ERROR_INFO, "dataset of \"%s\" has not been allocated !!\n", AsyncIO_FileName );
+
+   if ( AsyncIO_NChunk >= AsyncIO_MaxNChunk )
+      Aux_Error( ERROR_INFO, "number of chunks exceeds the limit (%d) !!\n", AsyncIO_MaxNChunk );
+
+   if ( AsyncIO_BufUsed + Size > AsyncIO_BufSize )
+      Aux_Error( ERROR_INFO, "staging buffer overflow (%ld + %ld > %ld) !!\n", AsyncIO_BufUsed, Size, AsyncIO_BufSize );
+
+
+   AsyncIO_ChunkFileOff[AsyncIO_NChunk] = SetAddr + Offset;
+   AsyncIO_ChunkBufOff [AsyncIO_NChunk] = AsyncIO_BufUsed;
+   AsyncIO_ChunkSize   [AsyncIO_NChunk] = Size;
+
+   memcpy( AsyncIO_Buf+AsyncIO_BufUsed, Data, Size );
+
+   AsyncIO_BufUsed += Size;
+   AsyncIO_NChunk  ++;
+
+} // FUNCTION : AsyncIO_Stage
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_Start
+// Description :  Launch the I/O thread to write all staged data
+//
+// Note        :  1. Must be invoked after all HDF5 objects of the target file have been closed on all ranks
+//-------------------------------------------------------------------------------------------------------
+void AsyncIO_Start()
+{
+
+   if ( pthread_create( &AsyncIO_Thread, NULL, AsyncIO_Write, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to create the I/O thread for \"%s\" !!\n", AsyncIO_FileName );
+
+   AsyncIO_Active = true;
+
+} // FUNCTION : AsyncIO_Start
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AsyncIO_Write
+// Description :  Write all staged data to the target file
+//
+// Note        :  1. Executed by the I/O thread launched by AsyncIO_Start()
+//                2. Use POSIX I/O only since neither HDF5 nor MPI is guaranteed to be thread-safe
+//                3. Do not call Aux_Error() here; errors are reported by Output_DumpData_Total_HDF5_Flush()
+//
+// Parameter   :  Arg : Useless
+//-------------------------------------------------------------------------------------------------------
+void *AsyncIO_Write( void *Arg )
+{
+
+   const int FileDes = open( AsyncIO_FileName, O_WRONLY );
+
+   if ( FileDes < 0 )
+   {
+      AsyncIO_Failed = true;
+      return NULL;
+   }
+
+   for (int t=0; t<AsyncIO_NChunk; t++)
+   {
+      const char *Ptr    = AsyncIO_Buf + AsyncIO_ChunkBufOff[t];
+      long        Offset = AsyncIO_ChunkFileOff[t];
+      long        Size   = AsyncIO_ChunkSize[t];
+
+//    pwrite() may write fewer bytes than requested
+      while ( Size > 0L )
+      {
+         const ssize_t NWrite = pwrite( FileDes, Ptr, Size, Offset );
+
+         if ( NWrite <= 0 )
+         {
+            AsyncIO_Failed = true;
+            break;
+         }
+
+         Ptr    += NWrite;
+         Offset += NWrite;
+         Size   -= NWrite;
+      }
+
+      if ( AsyncIO_Failed )   break;
+   }
+
+   if ( fsync( FileDes ) != 0  ||  close( FileDes ) != 0 )  AsyncIO_Failed = true;
+
+   return NULL;
+
+} // FUNCTION : AsyncIO_Write
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_DumpData_Total_HDF5_Flush
+// Description :  Wait until the asynchronous data dump of this rank finishes and free the staging buffer
+//
+// Note        :  1. Invoked by Output_DumpData_Total_HDF5() and End_GAMER()
+//                2. Do nothing if there is no asynchronous data dump in flight
+//-------------------------------------------------------------------------------------------------------
+void Output_DumpData_Total_HDF5_Flush()
+{
+
+   if ( !AsyncIO_Active )  return;
+
+   if ( pthread_join( AsyncIO_Thread, NULL ) != 0 )
+      Aux_Error( ERROR_INFO, "failed to join the I/O thread for \"%s\" !!\n", AsyncIO_FileName );
+
+   AsyncIO_Active = false;
+
+   if ( AsyncIO_Failed )
+      Aux_Error( ERROR_INFO, "failed to write the HDF5 file \"%s\" asynchronously !!\n", AsyncIO_FileName );
+
+   delete [] AsyncIO_Buf;
+   delete [] AsyncIO_ChunkFileOff;
+   delete [] AsyncIO_ChunkBufOff;
+   delete [] AsyncIO_ChunkSize;
+
+   AsyncIO_Buf          = NULL;
+   AsyncIO_ChunkFileOff = NULL;
+   AsyncIO_ChunkBufOff  = NULL;
+   AsyncIO_ChunkSize    = NULL;
+   AsyncIO_BufSize      = 0L;
+   AsyncIO_BufUsed      = 0L;
+   AsyncIO_NChunk       = 0;
+
+} // FUNCTION : Output_DumpData_Total_HDF5_Flush
+
+
+
 #endif // #ifdef SUPPORT_HDF5
@@ -2,6 +2,25 @@
 
 #if ( defined PARTICLE  &&  defined LOAD_BALANCE )
 
+static void SendParticleData_Alltoall( const int NParAtt, int *SendBuf_NPatchEachRank, int *SendBuf_NParEachPatch,
+                                       long *SendBuf_LBIdxEachPatch, real_par *SendBuf_ParDataEachPatch,
+                                       int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
+                                       real_par *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, long &NRecvParTotal,
+                                       const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
+                                       const bool Exchange_ParDataEachRank );
+static void SendParticleData_NBX( const int NParAtt, int *SendBuf_NPatchEachRank, int *SendBuf_NParEachPatch,
+                                  long *SendBuf_LBIdxEachPatch, real_par *SendBuf_ParDataEachPatch,
+                                  int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
+                                  real_par *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, long &NRecvParTotal,
+                                  const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
+                                  const bool Exchange_ParDataEachRank );
+
+
+// persistent buffer used by SendParticleData_NBX() to pack the messages sent to other ranks
+// --> the receive buffer and the communicator are owned by MPI_Alltoallv_Sparse_NBX()
+static char *NBX_SendPool     = NULL;
+static long  NBX_SendPoolSize = 0L;
+
 
 
 
@@ -19,6 +38,10 @@
 //                   Par_LB_ExchangeParticleBetweenPatch()
 //                   --> Par_LB_ExchangeParticleBetweenPatch() is called by
 //                       Par_PassParticle2Sibling() and Par_PassParticle2Son_MultiPatch()
+//                5. Two algorithms are supported, which give identical results
+//                   (1) PAR_SPARSE_EXCHANGE == false: collective MPI_Alltoall(v) among all ranks
+//                   (2) PAR_SPARSE_EXCHANGE == true : point-to-point messages with only the ranks actually involved
+//                       --> see SendParticleData_NBX()
 //
 // Parameter   :  NParAtt                  : Number of particle attributes to be sent
 //                SendBuf_NPatchEachRank   : MPI send buffer --> number of patches sent to each rank
@@ -94,6 +117,68 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 #  endif
 
 
+// exchange data
+   if ( amr->Par->SparseExchange )
+      SendParticleData_NBX     ( NParAtt, SendBuf_NPatchEachRank, SendBuf_NParEachPatch, SendBuf_LBIdxEachPatch,
+                                 SendBuf_ParDataEachPatch, RecvBuf_NPatchEachRank, RecvBuf_NParEachPatch,
+                                 RecvBuf_LBIdxEachPatch, RecvBuf_ParDataEachPatch, NRecvPatchTotal, NRecvParTotal,
+                                 Exchange_NPatchEachRank, Exchange_LBIdxEachRank, Exchange_ParDataEachRank );
+   else
+      SendParticleData_Alltoall( NParAtt, SendBuf_NPatchEachRank, SendBuf_NParEachPatch, SendBuf_LBIdxEachPatch,
+                                 SendBuf_ParDataEachPatch, RecvBuf_NPatchEachRank, RecvBuf_NParEachPatch,
+                                 RecvBuf_LBIdxEachPatch, RecvBuf_ParDataEachPatch, NRecvPatchTotal, NRecvParTotal,
+                                 Exchange_NPatchEachRank, Exchange_LBIdxEachRank, Exchange_ParDataEachRank );
+
+
+// stop timing
+#  ifdef TIMING
+   if ( Timer != NULL )
+   {
+      Timer->Stop();
+
+      if ( OPT__TIMING_MPI )
+      {
+         dtime = Timer->GetValue() - time0;
+
+//       output to the same log file as LB_GetBufferData
+         char FileName[100];
+         sprintf( FileName, "Record__TimingMPI_Rank%05d", MPI_Rank );
+
+         FILE *File = fopen( FileName, "a" );
+
+         const double SendMB = (double)NSendParTotal*NParAtt*sizeof(real_par)*1.0e-6;
+         const double RecvMB = (double)NRecvParTotal*NParAtt*sizeof(real_par)*1.0e-6;
+
+         fprintf( File, "%19s %4d %4s %10s %10s %10.5f %8.3f %8.3f %10.3f %10.3f\n",
+                  Timer_Comment, NParAtt, "X", "X", "X", dtime, SendMB, RecvMB, SendMB/dtime, RecvMB/dtime );
+
+         fclose( File );
+      } // if ( OPT__TIMING_MPI )
+   } // if ( Timer != NULL )
+#  endif // #ifdef TIMING
+
+} // FUNCTION : Par_LB_SendParticleData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SendParticleData_Alltoall
+// Description :  Exchange particles between different MPI ranks using collective communication among all ranks
+//
+// Note        :  1. Invoked by Par_LB_SendParticleData() when PAR_SPARSE_EXCHANGE is off
+//
+// Parameter   :  See Par_LB_SendParticleData()
+//
+// Return      :  See Par_LB_SendParticleData()
+//-------------------------------------------------------------------------------------------------------
+void SendParticleData_Alltoall( const int NParAtt, int *SendBuf_NPatchEachRank, int *SendBuf_NParEachPatch,
+                                long *SendBuf_LBIdxEachPatch, real_par *SendBuf_ParDataEachPatch,
+                                int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
+                                real_par *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, long &NRecvParTotal,
+                                const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
+                                const bool Exchange_ParDataEachRank )
+{
+
 // 1. get the number of patches received from each rank
    if ( Exchange_NPatchEachRank )
    {
@@ -205,35 +290,277 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
    delete [] RecvCount_NParEachPatch;
    delete [] RecvDisp_NParEachPatch;
 
+} // FUNCTION : SendParticleData_Alltoall
 
-// stop timing
-#  ifdef TIMING
-   if ( Timer != NULL )
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SendParticleData_NBX
+// Description :  Exchange particles between different MPI ranks using point-to-point communication with only
+//                the ranks actually involved
+//
+// Note        :  1. Invoked by Par_LB_SendParticleData() when PAR_SPARSE_EXCHANGE is on
+//                2. Messages are exchanged by MPI_Alltoallv_Sparse_NBX(), which finds the source ranks by
+//                   the nonblocking consensus algorithm (NBX)
+//                   --> Only O(number of neighbouring ranks) messages per rank instead of three collective calls
+//                       involving all ranks
+//                3. Each message packs all data sent to the same rank: [NPatch][NParEachPatch][LBIdxEachPatch][ParData]
+//                   --> LBIdxEachPatch and ParData are included only if Exchange_LBIdxEachRank and
+//                       Exchange_ParDataEachRank are on, respectively
+//                   --> Ranks without any patch to be sent receive no message
+//                   --> Data sent to this rank itself are copied directly
+//                4. Received data are stored in the order of the source rank, which is the same as
+//                   SendParticleData_Alltoall()
+//                5. The send buffer is kept between calls and only grows
+//                   --> Call Par_LB_SendParticleData_MemFree() to free memory
+//
+// Parameter   :  See Par_LB_SendParticleData()
+//
+// Return      :  See Par_LB_SendParticleData()
+//-------------------------------------------------------------------------------------------------------
+void SendParticleData_NBX( const int NParAtt, int *SendBuf_NPatchEachRank, int *SendBuf_NParEachPatch,
+                           long *SendBuf_LBIdxEachPatch, real_par *SendBuf_ParDataEachPatch,
+                           int *&RecvBuf_NPatchEachRank, int *&RecvBuf_NParEachPatch, long *&RecvBuf_LBIdxEachPatch,
+                           real_par *&RecvBuf_ParDataEachPatch, int &NRecvPatchTotal, long &NRecvParTotal,
+                           const bool Exchange_NPatchEachRank, const bool Exchange_LBIdxEachRank,
+                           const bool Exchange_ParDataEachRank )
+{
+
+   const long ParDataBytes = (long)NParAtt*sizeof(real_par);
+
+
+// 1. get the offset and the number of particles of the data sent to each rank
+   long *Send_PatchDisp = new long [MPI_NRank];   // offset in SendBuf_NParEachPatch[] and SendBuf_LBIdxEachPatch[]
+   long *Send_ParDisp   = new long [MPI_NRank];   // offset in SendBuf_ParDataEachPatch[] in the unit of particles
+   long *Send_NPar      = new long [MPI_NRank];   // number of particles sent to each rank
+
+   for (int r=0; r<MPI_NRank; r++)
    {
-      Timer->Stop();
+      Send_PatchDisp[r] = ( r == 0 ) ? 0L : Send_PatchDisp[r-1] + SendBuf_NPatchEachRank[r-1];
+      Send_ParDisp  [r] = ( r == 0 ) ? 0L : Send_ParDisp  [r-1] + Send_NPar[r-1];
+      Send_NPar     [r] = 0L;
 
-      if ( OPT__TIMING_MPI )
+      for (int p=0; p<SendBuf_NPatchEachRank[r]; p++)    Send_NPar[r] += SendBuf_NParEachPatch[ Send_PatchDisp[r] + p ];
+   }
+
+
+// 2. pack data sent to each target rank except this rank itself
+// 2-1. get the message size
+   long *Send_MsgSize = new long [MPI_NRank];
+   long *Send_MsgDisp = new long [MPI_NRank];
+   long  SendPoolSize = 0L;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Send_MsgDisp[r] = SendPoolSize;
+
+      if ( r == MPI_Rank  ||  SendBuf_NPatchEachRank[r] == 0 )
       {
-         dtime = Timer->GetValue() - time0;
+         Send_MsgSize[r] = 0L;
+         continue;
+      }
 
-//       output to the same log file as LB_GetBufferData
-         char FileName[100];
-         sprintf( FileName, "Record__TimingMPI_Rank%05d", MPI_Rank );
+      Send_MsgSize[r] = sizeof(int) + SendBuf_NPatchEachRank[r]*sizeof(int);
+      if ( Exchange_LBIdxEachRank   )   Send_MsgSize[r] += SendBuf_NPatchEachRank[r]*sizeof(long);
+      if ( Exchange_ParDataEachRank )   Send_MsgSize[r] += Send_NPar[r]*ParDataBytes;
 
-         FILE *File = fopen( FileName, "a" );
+      if ( Send_MsgSize[r] > __INT_MAX__ )
+         Aux_Error( ERROR_INFO, "message size sent to rank %d (%ld bytes) > __INT_MAX__ (please set PAR_SPARSE_EXCHANGE to 0) !!\n",
+                    r, Send_MsgSize[r] );
 
-         const double SendMB = (double)NSendParTotal*NParAtt*sizeof(real_par)*1.0e-6;
-         const double RecvMB = (double)NRecvParTotal*NParAtt*sizeof(real_par)*1.0e-6;
+      SendPoolSize += Send_MsgSize[r];
+   }
 
-         fprintf( File, "%19s %4d %4s %10s %10s %10.5f %8.3f %8.3f %10.3f %10.3f\n",
-                  Timer_Comment, NParAtt, "X", "X", "X", dtime, SendMB, RecvMB, SendMB/dtime, RecvMB/dtime );
+   if ( SendPoolSize > NBX_SendPoolSize )
+   {
+      free( NBX_SendPool );
+      NBX_SendPool     = (char*)malloc( SendPoolSize );
+      NBX_SendPoolSize = SendPoolSize;
+   }
 
-         fclose( File );
-      } // if ( OPT__TIMING_MPI )
-   } // if ( Timer != NULL )
-#  endif // #ifdef TIMING
+// 2-2. pack data
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Send_MsgSize[r] == 0L )  continue;
 
-} // FUNCTION : Par_LB_SendParticleData
+      const int NPatch = SendBuf_NPatchEachRank[r];
+      char     *Ptr    = NBX_SendPool + Send_MsgDisp[r];
+
+      memcpy( Ptr, &NPatch, sizeof(int) );
+      Ptr += sizeof(int);
+
+      memcpy( Ptr, SendBuf_NParEachPatch + Send_PatchDisp[r], NPatch*sizeof(int) );
+      Ptr += NPatch*sizeof(int);
+
+      if ( Exchange_LBIdxEachRank )
+      {
+         memcpy( Ptr, SendBuf_LBIdxEachPatch + Send_PatchDisp[r], NPatch*sizeof(long) );
+         Ptr += NPatch*sizeof(long);
+      }
+
+      if ( Exchange_ParDataEachRank )
+      {
+         memcpy( Ptr, SendBuf_ParDataEachPatch + Send_ParDisp[r]*NParAtt, Send_NPar[r]*ParDataBytes );
+         Ptr += Send_NPar[r]*ParDataBytes;
+      }
+   } // for (int r=0; r<MPI_NRank; r++)
+
+
+// 3. exchange messages with only the ranks actually involved
+   char *RecvPool     = NULL;
+   long *Recv_MsgSize = new long [MPI_NRank];   // zero if no message is received from a rank
+   long *Recv_MsgDisp = new long [MPI_NRank];   // offset of the message from each rank in RecvPool
+
+   MPI_Alltoallv_Sparse_NBX( NBX_SendPool, Send_MsgSize, Send_MsgDisp, RecvPool, Recv_MsgSize, Recv_MsgDisp );
+
+
+// 4. unpack data in the order of the source rank
+// 4-1. get the pointers to the data received from each rank
+   const int      **Recv_NParPtr  = new const int*      [MPI_NRank];
+   const long     **Recv_LBIdxPtr = new const long*     [MPI_NRank];
+   const real_par **Recv_DataPtr  = new const real_par* [MPI_NRank];
+   int             *Recv_NPatch   = new int             [MPI_NRank];
+   long            *Recv_NPar     = new long            [MPI_NRank];
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )
+      {
+         Recv_NPatch  [r] = SendBuf_NPatchEachRank[r];
+         Recv_NParPtr [r] = SendBuf_NParEachPatch + Send_PatchDisp[r];
+         Recv_LBIdxPtr[r] = ( Exchange_LBIdxEachRank   ) ? SendBuf_LBIdxEachPatch   + Send_PatchDisp[r]         : NULL;
+         Recv_DataPtr [r] = ( Exchange_ParDataEachRank ) ? SendBuf_ParDataEachPatch + Send_ParDisp  [r]*NParAtt : NULL;
+      }
+
+      else if ( Recv_MsgSize[r] == 0L )
+      {
+         Recv_NPatch  [r] = 0;
+         Recv_NParPtr [r] = NULL;
+         Recv_LBIdxPtr[r] = NULL;
+         Recv_DataPtr [r] = NULL;
+      }
+
+      else
+      {
+         const char *Ptr = RecvPool + Recv_MsgDisp[r];
+
+         memcpy( &Recv_NPatch[r], Ptr, sizeof(int) );
+         Ptr += sizeof(int);
+
+         Recv_NParPtr[r] = (const int*)Ptr;
+         Ptr += Recv_NPatch[r]*sizeof(int);
+
+         if ( Exchange_LBIdxEachRank )
+         {
+            Recv_LBIdxPtr[r] = (const long*)Ptr;
+            Ptr += Recv_NPatch[r]*sizeof(long);
+         }
+         else
+            Recv_LBIdxPtr[r] = NULL;
+
+         Recv_DataPtr[r] = ( Exchange_ParDataEachRank ) ? (const real_par*)Ptr : NULL;
+      }
+
+      Recv_NPar[r] = 0L;
+      for (int p=0; p<Recv_NPatch[r]; p++)
+      {
+         int NPar;
+         memcpy( &NPar, Recv_NParPtr[r] + p, sizeof(int) );
+         Recv_NPar[r] += NPar;
+      }
+   } // for (int r=0; r<MPI_NRank; r++)
+
+// 4-2. set the number of patches received from each rank
+   if ( Exchange_NPatchEachRank )
+   {
+      RecvBuf_NPatchEachRank = new int [MPI_NRank];
+
+      for (int r=0; r<MPI_NRank; r++)  RecvBuf_NPatchEachRank[r] = Recv_NPatch[r];
+   }
+
+#  ifdef DEBUG_PARTICLE
+   else
+   {
+      for (int r=0; r<MPI_NRank; r++)
+         if ( RecvBuf_NPatchEachRank[r] != Recv_NPatch[r] )
+            Aux_Error( ERROR_INFO, "number of patches received from rank %d (%d) != expected (%d) !!\n",
+                       r, Recv_NPatch[r], RecvBuf_NPatchEachRank[r] );
+   }
+#  endif
+
+   NRecvPatchTotal = 0;
+   NRecvParTotal   = 0L;
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NRecvPatchTotal += Recv_NPatch[r];
+      NRecvParTotal   += Recv_NPar  [r];
+   }
+
+// 4-3. copy data to the output arrays
+//      --> use memcpy() since data in RecvPool may not be aligned
+   RecvBuf_NParEachPatch = new int [NRecvPatchTotal];
+
+   if ( Exchange_LBIdxEachRank )
+      RecvBuf_LBIdxEachPatch = new long [NRecvPatchTotal];
+
+// reuse the MPI recv buffer declared in LB_GetBufferData for better MPI performance
+   if ( Exchange_ParDataEachRank )
+      RecvBuf_ParDataEachPatch = (real_par *)LB_GetBufferData_MemAllocate_Recv( NRecvParTotal*ParDataBytes );
+
+   long PatchDisp = 0L, ParDisp = 0L;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Recv_NPatch[r] == 0 )    continue;
+
+      memcpy( RecvBuf_NParEachPatch + PatchDisp, Recv_NParPtr[r], Recv_NPatch[r]*sizeof(int) );
+
+      if ( Exchange_LBIdxEachRank )
+      memcpy( RecvBuf_LBIdxEachPatch + PatchDisp, Recv_LBIdxPtr[r], Recv_NPatch[r]*sizeof(long) );
+
+      if ( Exchange_ParDataEachRank )
+      memcpy( RecvBuf_ParDataEachPatch + ParDisp*NParAtt, Recv_DataPtr[r], Recv_NPar[r]*ParDataBytes );
+
+      PatchDisp += Recv_NPatch[r];
+      ParDisp   += Recv_NPar  [r];
+   }
+
+
+// 5. free memory
+   delete [] Send_PatchDisp;
+   delete [] Send_ParDisp;
+   delete [] Send_NPar;
+   delete [] Send_MsgSize;
+   delete [] Send_MsgDisp;
+   delete [] Recv_MsgSize;
+   delete [] Recv_MsgDisp;
+   delete [] Recv_NParPtr;
+   delete [] Recv_LBIdxPtr;
+   delete [] Recv_DataPtr;
+   delete [] Recv_NPatch;
+   delete [] Recv_NPar;
+
+} // FUNCTION : SendParticleData_NBX
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_LB_SendParticleData_MemFree
+// Description :  Free the send buffer used by SendParticleData_NBX()
+//
+// Note        :  1. Invoked by End_MemFree()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Par_LB_SendParticleData_MemFree()
+{
+
+   free( NBX_SendPool );
+
+   NBX_SendPool     = NULL;
+   NBX_SendPoolSize = 0L;
+
+} // FUNCTION : Par_LB_SendParticleData_MemFree
 
 
 
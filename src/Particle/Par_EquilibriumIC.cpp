@@ -8,10 +8,18 @@
 
 Par_EquilibriumIC::Par_EquilibriumIC()
 {
+
+   Table_MassProf_r = NULL;
+   Table_MassProf_M = NULL;
+
 }
 
 Par_EquilibriumIC::~Par_EquilibriumIC()
 {
+
+   delete [] Table_MassProf_r;
+   delete [] Table_MassProf_M;
+
 }
 
 
@@ -73,7 +81,7 @@ void Par_EquilibriumIC::Load_Physical_Params( const FP filename_para, const int
    params.Cloud_Center   = new double[3];     // central coordinates
    params.Cloud_BulkVel  = new double[3];     // bulk velocity
 
-   Aux_Message( stdout, "Reading physical parameters input file:%s\n",filename_para.Params_Filenames[cloud_idx].c_str() );
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "Reading physical parameters input file:%s\n",filename_para.Params_Filenames[cloud_idx].c_str() );
 
    //for(int k=0;k<filenames.Cloud_Num;k++){
    // (1) load the problem-specific runtime parameters
@@ -144,12 +152,12 @@ void Par_EquilibriumIC::Load_Physical_Params( const FP filename_para, const int
    }//if ( MPI_Rank == 0 )
 
    // (3) Warn against small R0
-   if ( params.Cloud_R0<amr->dh[MAX_LEVEL] )Aux_Message( stdout, "WARNING : Characteristic length R0:%f is smaller than spatial resolution %f!\n",params.Cloud_R0,amr->dh[MAX_LEVEL] );
+   if ( MPI_Rank == 0  &&  params.Cloud_R0<amr->dh[MAX_LEVEL] )Aux_Message( stdout, "WARNING : Characteristic length R0:%f is smaller than spatial resolution %f!\n",params.Cloud_R0,amr->dh[MAX_LEVEL] );
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Setting runtime parameters ... done\n" );
 
    // (4) Check Cloud_Type and table filenames
    // Checking Cloud_Type
-   Aux_Message( stdout, "Checking Cloud_Type\n" );
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "Checking Cloud_Type\n" );
    int flag = 0;
    if      (convertToString(params.Cloud_Type)=="Plummer"  )   flag=1;
    else if (convertToString(params.Cloud_Type)=="NFW"      )   flag=1;
@@ -164,7 +172,7 @@ void Par_EquilibriumIC::Load_Physical_Params( const FP filename_para, const int
    }
 
    // Checking Density_Table_Name
-   Aux_Message( stdout, "Checking Density_Table_Name\n" );
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "Checking Density_Table_Name\n" );
    if(convertToString(params.Cloud_Type)=="Table"){
       char c[MAX_STRING];
       strcpy( c, convertToString(params.Density_Table_Name).c_str() );
@@ -178,7 +186,7 @@ void Par_EquilibriumIC::Load_Physical_Params( const FP filename_para, const int
    }
 
    // Checking ExtPot_Table_Name
-   Aux_Message( stdout, "Checking ExtPot_Table_Name\n" );
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "Checking ExtPot_Table_Name\n" );
    if(params.AddExtPot){
       const char * c = convertToString(params.ExtPot_Table_Name).c_str();
       fstream file;
@@ -198,7 +206,9 @@ void Par_EquilibriumIC::Load_Physical_Params( const FP filename_para, const int
 // Function    :  Init
 // Description :  Initialize all necessary tables of physical parameters, including radius, mass, density, gravitational potential
 //
-// Note        :
+// Note        :  1. Invoked by all MPI ranks, which construct identical tables
+//                2. Also construct the cumulative mass profile used by Par_SetEquilibriumIC()
+//                   --> Shared read-only by all OpenMP threads
 //
 // Parameter   :
 //
@@ -223,16 +233,12 @@ void Par_EquilibriumIC::Init()
    int_prob_dens           = NULL;
    psi                     = NULL;
 
-   //Set random seeds
-   Random_Num_Gen = new RandomNumber_t( 1 );
-   Random_Num_Gen->SetSeed( 0, params.Cloud_RSeed );
-
    //Initialize densities with Table
    if(convertToString(params.Cloud_Type)=="Table"){
       int Tcol_r[1]   =  {0};
       int Tcol_rho[1] =  {1};
       int Row_r_Table;
-      Aux_Message( stdout, "Loading Density Profile Table:%s\n", convertToString(params.Density_Table_Name).c_str());
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "Loading Density Profile Table:%s\n", convertToString(params.Density_Table_Name).c_str());
 
       Row_r_Table= Aux_LoadTable( Table_r, convertToString(params.Density_Table_Name).c_str(), 1, Tcol_r,true,true );
 
@@ -285,34 +291,6 @@ void Par_EquilibriumIC::Init()
       Init_Prob_Dens();
    }
 
-} // FUNCTION : Init
-
-
-
-//-------------------------------------------------------------------------------------------------------
-// Function    :  Par_SetEquilibriumIC
-// Description :  Set particle's initial conditions (IC) for a cloud that is in equilibrium state
-//
-// Note        :
-//
-// Parameter   :  Mass_AllRank : An array of all particles' masses
-//                Pos_AllRank  : An array of all particles' position vectors
-//                Vel_AllRank  : An array of all particles' velocity vectors
-//                Par_Idx0     : Starting index of particles in this cloud
-//
-// Return      :  Mass_AllRank
-//                Pos_AllRank
-//                Vel_AllRank
-//-------------------------------------------------------------------------------------------------------
-void Par_EquilibriumIC::Par_SetEquilibriumIC( real_par *Mass_AllRank, real_par *Pos_AllRank[3], real_par *Vel_AllRank[3], const long Par_Idx0 )
-{
-
-   double *Table_MassProf_r = NULL;
-   double *Table_MassProf_M = NULL;
-   double  TotM, ParM, dr, RanM, RanR, EstM, ErrM, ErrM_Max=-1.0, RanVec[3];
-   double  Vmax, RanV, RanProb, Prob;
-
-
    // determine the total enclosed mass within the maximum radius
    TotM = Set_Mass( params.Cloud_MaxR);
    ParM = TotM / (params.Cloud_Par_Num);
@@ -321,7 +299,7 @@ void Par_EquilibriumIC::Par_SetEquilibriumIC( real_par *Mass_AllRank, real_par *
    Table_MassProf_r = new double [params.Cloud_MassProfNBin];
    Table_MassProf_M = new double [params.Cloud_MassProfNBin];
 
-   dr = params.Cloud_MaxR / (params.Cloud_MassProfNBin-1);
+   const double dr = params.Cloud_MaxR / (params.Cloud_MassProfNBin-1);
 
    for (int b=0; b<params.Cloud_MassProfNBin; b++)
    {
@@ -329,15 +307,54 @@ void Par_EquilibriumIC::Par_SetEquilibriumIC( real_par *Mass_AllRank, real_par *
       Table_MassProf_M[b] = Set_Mass(Table_MassProf_r[b]);
    }
 
+} // FUNCTION : Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_SetEquilibriumIC
+// Description :  Set particle's initial conditions (IC) for a cloud that is in equilibrium state
+//
+// Note        :  1. Set the particles [ParID0, ParID0+NPar) of this cloud, where the particle ParID0+p
+//                   is stored in the p-th element of the input arrays
+//                   --> Each MPI rank can set its own subset of particles without constructing the
+//                       entire cloud on a single rank
+//                2. Random numbers are drawn from Random(), which depends only on the random seed,
+//                   the particle index in this cloud, and the number of draws of this particle
+//                   --> Results are independent of the numbers of MPI ranks and OpenMP threads
+//                3. Init() must be invoked in advance
+//
+// Parameter   :  Mass_ThisRank : An array of particles' masses
+//                Pos_ThisRank  : An array of particles' position vectors
+//                Vel_ThisRank  : An array of particles' velocity vectors
+//                ParID0        : Index of the first particle to be set in this cloud
+//                NPar          : Number of particles to be set
+//
+// Return      :  Mass_ThisRank
+//                Pos_ThisRank
+//                Vel_ThisRank
+//-------------------------------------------------------------------------------------------------------
+void Par_EquilibriumIC::Par_SetEquilibriumIC( real_par *Mass_ThisRank, real_par *Pos_ThisRank[3], real_par *Vel_ThisRank[3],
+                                              const long ParID0, const long NPar )
+{
+
+   double ErrM_Max=-1.0, ErrM_Max_AllRank;
+
+
    // set particle attributes
-   for (long p=Par_Idx0; p<Par_Idx0+params.Cloud_Par_Num; p++)
+#  pragma omp parallel for reduction( max:ErrM_Max ) schedule( static )
+   for (long p=0; p<NPar; p++)
    {
+      const long ParID = ParID0 + p;
+      long   RanCount  = 0;
+      double RanM, RanR, RanV, EstM, ErrM, RanVec[3];
+
       // mass
-      Mass_AllRank[p] = ParM;
+      Mass_ThisRank[p] = ParM;
 
       //       position
       //       --> sample from the cumulative mass profile with linear interpolation
-      RanM = Random_Num_Gen->GetValue( 0, 0.0, 1.0 )*TotM;
+      RanM = Random( ParID, RanCount, 0.0, 1.0 )*TotM;
       RanR = Mis_InterpolateFromTable( params.Cloud_MassProfNBin, Table_MassProf_M, Table_MassProf_r, RanM );
 
       //       record the maximum error
@@ -346,34 +363,35 @@ void Par_EquilibriumIC::Par_SetEquilibriumIC( real_par *Mass_AllRank, real_par *
       ErrM_Max = fmax( ErrM, ErrM_Max );
 
       //       randomly set the position vector with a given radius
-      RanVec_FixRadius( RanR, RanVec );
-      for (int d=0; d<3; d++)    Pos_AllRank[d][p] = RanVec[d] + params.Cloud_Center[d];
+      RanVec_FixRadius( RanR, RanVec, ParID, RanCount );
+      for (int d=0; d<3; d++)    Pos_ThisRank[d][p] = RanVec[d] + params.Cloud_Center[d];
 
       //       check periodicity
       for (int d=0; d<3; d++)
       {
          if ( OPT__BC_FLU[d*2] == BC_FLU_PERIODIC )
-         Pos_AllRank[d][p] = FMOD( Pos_AllRank[d][p]+(real_par)amr->BoxSize[d], (real_par)amr->BoxSize[d] );
+         Pos_ThisRank[d][p] = FMOD( Pos_ThisRank[d][p]+(real_par)amr->BoxSize[d], (real_par)amr->BoxSize[d] );
       }
 
       //       velocity
       double a3=RanR/params.Cloud_R0;
 
-      RanV = Set_Velocity(a3);
+      RanV = Set_Velocity(a3, ParID, RanCount);
 
       //       randomly set the velocity vector with the given amplitude (RanV*Vmax)
-      RanVec_FixRadius( RanV, RanVec );
-      for (int d=0; d<3; d++)    Vel_AllRank[d][p] = RanVec[d] + params.Cloud_BulkVel[d];
+      RanVec_FixRadius( RanV, RanVec, ParID, RanCount );
+      for (int d=0; d<3; d++)    Vel_ThisRank[d][p] = RanVec[d] + params.Cloud_BulkVel[d];
 
-   } // for (long p=0; p<NPar_AllRank; p++)
+   } // for (long p=0; p<NPar; p++)
 
-   Aux_Message( stdout, "   Total enclosed mass within MaxR  = %13.7e\n",  TotM );
-   Aux_Message( stdout, "   Particle mass                    = %13.7e\n",  ParM );
-   Aux_Message( stdout, "   Maximum mass interpolation error = %13.7e\n",  ErrM_Max );
+   MPI_Reduce( &ErrM_Max, &ErrM_Max_AllRank, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
 
-   // free memory
-   delete [] Table_MassProf_r;
-   delete [] Table_MassProf_M;
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "   Total enclosed mass within MaxR  = %13.7e\n",  TotM );
+      Aux_Message( stdout, "   Particle mass                    = %13.7e\n",  ParM );
+      Aux_Message( stdout, "   Maximum mass interpolation error = %13.7e\n",  ErrM_Max_AllRank );
+   }
 
 } // FUNCTION : Par_SetEquilibriumIC
 
@@ -513,11 +531,13 @@ double Par_EquilibriumIC::Set_Density( double x )
 //
 // Note        :
 //
-// Parameter   :  r : radius
+// Parameter   :  x        : radius normalized by Cloud_R0
+//                ParID    : Particle index in this cloud for Random()
+//                RanCount : Number of random numbers already drawn for this particle
 //
-// Return      :  Particle velocity
+// Return      :  Particle velocity, RanCount
 //-------------------------------------------------------------------------------------------------------
-double Par_EquilibriumIC::Set_Velocity( const double x )
+double Par_EquilibriumIC::Set_Velocity( const double x, const long ParID, long &RanCount )
 {
 
    double index,sum=0;
@@ -533,7 +553,7 @@ double Par_EquilibriumIC::Set_Velocity( const double x )
    double sum_rad,sum_mes=0,par,psi_ass;
    int index_ass=0;
 
-   sum_rad = Random_Num_Gen->GetValue( 0, 0.0, 1.0 );
+   sum_rad = Random( ParID, RanCount, 0.0, 1.0 );
    sum_rad*=sum;
 
    for(int k =0;k<params.Cloud_MassProfNBin;k++){
@@ -1049,12 +1069,14 @@ int Par_EquilibriumIC::GetParams( const char *filename, const char *keyword, con
 // Note        :  Uniformly random sample in theta and phi does NOT give a uniformly random sample in 3D space
 //                --> Uniformly random sample in a 3D sphere and then normalize all vectors to the given radius
 //
-// Parameter   :  r      : Input radius
-//                RanVec : Array to store the random 3D vector
+// Parameter   :  r        : Input radius
+//                RanVec   : Array to store the random 3D vector
+//                ParID    : Particle index in this cloud for Random()
+//                RanCount : Number of random numbers already drawn for this particle
 //
-// Return      :  RanVec
+// Return      :  RanVec, RanCount
 //-------------------------------------------------------------------------------------------------------
-void Par_EquilibriumIC::RanVec_FixRadius( const double r, double RanVec[] )
+void Par_EquilibriumIC::RanVec_FixRadius( const double r, double RanVec[], const long ParID, long &RanCount )
 {
 
    double Norm, RanR2;
@@ -1065,7 +1087,7 @@ void Par_EquilibriumIC::RanVec_FixRadius( const double r, double RanVec[] )
 
       for (int d=0; d<3; d++)
       {
-         RanVec[d]  = Random_Num_Gen->GetValue( 0, -1.0, +1.0 );
+         RanVec[d]  = Random( ParID, RanCount, -1.0, +1.0 );
          RanR2     += SQR( RanVec[d] );
       }
    } while ( RanR2 > 1.0 );
@@ -1078,6 +1100,45 @@ void Par_EquilibriumIC::RanVec_FixRadius( const double r, double RanVec[] )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Random
+// Description :  Counter-based random number generator
+//
+// Note        :  1. Return the RanCount-th random number of the particle ParID, which is a pure function
+//                   of ( Cloud_RSeed, ParID, RanCount )
+//                   --> Each particle has an independent stream, which makes it thread-safe and independent
+//                       of which MPI rank and OpenMP thread sets the particle
+//                2. Hash the key with the SplitMix64 finalizer and keep the leading 53 bits
+//                3. RanCount is incremented by one
+//
+// Parameter   :  ParID    : Particle index in this cloud
+//                RanCount : Number of random numbers already drawn for this particle
+//                Min/Max  : Range of the random number
+//
+// Return      :  Uniform random number in [Min, Max), RanCount
+//-------------------------------------------------------------------------------------------------------
+double Par_EquilibriumIC::Random( const long ParID, long &RanCount, const double Min, const double Max )
+{
+
+   ulong Key[3] = { (ulong)params.Cloud_RSeed, (ulong)ParID, (ulong)RanCount };
+   ulong z      = 0;
+
+   for (int k=0; k<3; k++)
+   {
+      z += Key[k] + 0x9e3779b97f4a7c15UL;
+      z  = ( z ^ (z>>30) )*0xbf58476d1ce4e5b9UL;
+      z  = ( z ^ (z>>27) )*0x94d049bb133111ebUL;
+      z  =   z ^ (z>>31);
+   }
+
+   RanCount ++;
+
+   return Min + (Max-Min)*(double)(z>>11)/9007199254740992.0;
+
+} // FUNCTION : Random
+
+
+
 // Statistics
 double Par_EquilibriumIC::ave( double* a, int start, int fin )
 {
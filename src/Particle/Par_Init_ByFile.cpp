@@ -3,6 +3,13 @@
 #ifdef PARTICLE
 
 
+// maximum size of the buffer for loading PAR_IC in bytes
+static const long ParIC_ChunkSize = 64L*1024L*1024L;
+
+template <typename T>
+static void Par_ConvertIC( const T *In, real_par *Out, const long NPar, const int Stride );
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -35,6 +42,9 @@
 //                   --> No need to provide particle acceleration and time
 //                8. For LOAD_BALANCE, the number of particles in each rank must be set in advance
 //                   --> Currently it's set by Init_Parallelization()
+//                9. Data are streamed into the particle repository in chunks of at most ParIC_ChunkSize bytes
+//                   --> For PAR_IC_FORMAT_ATT_ID with the same floating-point precision on disk and in real_par,
+//                       data are read into the particle repository directly without any buffer
 //
 // Parameter   :  None
 //
@@ -103,11 +113,26 @@ void Par_Init_ByFile()
    for (int r=0; r<MPI_Rank; r++)   FileOffset = FileOffset + long(NParAttPerLoad)*NPar_EachRank[r]*load_data_size;
 
 
-// load data
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... " );
+// map the attributes on disk to the particle repository
+// --> assuming that the orders of the particle attributes stored on the disk and in Par->Attribute[] are the same
+// --> no need to skip acceleration and time since they are always put at the end of the attribute list
+   int AttOut[NParAtt];
+
+   for (int v_in=0, v_out=0; v_in<NParAtt; v_in++, v_out++)
+   {
+      if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
+      if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
+
+      AttOut[v_in] = v_out;
+   }
+
+
+// load data and store them into the particle repository chunk by chunk
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data into particle repository ... " );
 
-// allocate buffer for loading PAR_IC
-   char* ParData_ThisRank = new char [ NParThisRank*NParAtt*load_data_size ];
+   const bool ReadDirect   = ( NParAttPerLoad == 1  &&  load_data_size == sizeof(real_par) );
+   const long NParPerChunk = MAX( ParIC_ChunkSize/(NParAttPerLoad*load_data_size), 1L );
+   char      *Buffer       = ( ReadDirect ) ? NULL : new char [ MIN(NParPerChunk,NParThisRank)*NParAttPerLoad*load_data_size ];
 
 // note that fread() may fail for large files if sizeof(size_t) == 4 instead of 8
    FILE *File = fopen( FileName, "rb" );
@@ -115,50 +140,37 @@ void Par_Init_ByFile()
    for (int v=0; v<NParAtt; v+=NParAttPerLoad)
    {
       fseek( File, FileOffset+v*NParAllRank*load_data_size, SEEK_SET );
-      fread( ParData_ThisRank+v*NParThisRank*load_data_size, load_data_size, long(NParAttPerLoad)*NParThisRank, File );
-   }
 
-   fclose( File );
+      for (long p0=0; p0<NParThisRank; p0+=NParPerChunk)
+      {
+         const long NPar  = MIN( NParPerChunk, NParThisRank-p0 );
+         const long NLoad = long(NParAttPerLoad)*NPar;
+         char      *Load  = ( ReadDirect ) ? (char*)( amr->Par->Attribute[ AttOut[v] ] + p0 ) : Buffer;
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+         if ( (long)fread( Load, load_data_size, NLoad, File ) != NLoad )
+            Aux_Error( ERROR_INFO, "failed to load %ld values from the file <%s> !!\n", NLoad, FileName );
 
+         if ( ReadDirect )    continue;
 
-// store data into the particle repository
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Storing data into particle repository ... " );
+//       [id][att] or [att][id]
+         for (int u=0; u<NParAttPerLoad; u++)
+         {
+            real_par *Out = amr->Par->Attribute[ AttOut[v+u] ] + p0;
 
-   real_par *ParData1 = new real_par [NParAtt];
+            if ( PAR_IC_FLOAT8 )    Par_ConvertIC( (double*)Buffer+u, Out, NPar, NParAttPerLoad );
+            else                    Par_ConvertIC( (float* )Buffer+u, Out, NPar, NParAttPerLoad );
+         }
+      } // for (long p0=0; p0<NParThisRank; p0+=NParPerChunk)
+   } // for (int v=0; v<NParAtt; v+=NParAttPerLoad)
 
-   for (long p=0; p<NParThisRank; p++)
-   {
-//    collect data for the target particle
-//    [id][att]
-      if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAtt; v++) ParData1[v] = (real_par)( *((double*)(ParData_ThisRank+(p*NParAtt+v)*load_data_size)) );
-         else
-            for (int v=0; v<NParAtt; v++) ParData1[v] = (real_par)( *((float* )(ParData_ThisRank+(p*NParAtt+v)*load_data_size)) );
-      }
-
-//    [att][id]
-      else
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAtt; v++) ParData1[v] = (real_par)( *((double*)(ParData_ThisRank+(v*NParThisRank+p)*load_data_size)) );
-         else
-            for (int v=0; v<NParAtt; v++) ParData1[v] = (real_par)( *((float* )(ParData_ThisRank+(v*NParThisRank+p)*load_data_size)) );
-      }
-
-//    assuming that the orders of the particle attributes stored on the disk and in Par->Attribute[] are the same
-//    --> no need to skip acceleration and time since they are always put at the end of the attribute list
-      for (int v_in=0, v_out=0; v_in<NParAtt; v_in++, v_out++)
-      {
-         if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
-         if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
+   fclose( File );
+
+   delete [] Buffer;
 
-         amr->Par->Attribute[v_out][p] = ParData1[v_in];
-      }
 
+// set the attributes not stored on the disk
+   for (long p=0; p<NParThisRank; p++)
+   {
       if ( SingleParMass )    amr->Par->Mass[p] = amr->Par->ParICMass;
       if ( SingleParType )    amr->Par->Type[p] = amr->Par->ParICType;
 
@@ -166,9 +178,6 @@ void Par_Init_ByFile()
       amr->Par->Time[p] = Time[0];
    }
 
-   delete [] ParData_ThisRank;
-   delete [] ParData1;
-
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 
@@ -178,4 +187,31 @@ void Par_Init_ByFile()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_ConvertIC
+// Description :  Convert the particle data loaded from PAR_IC to real_par
+//
+// Note        :  1. Invoked by Par_Init_ByFile()
+//                2. Separate loop for Stride == 1 (i.e., PAR_IC_FORMAT_ATT_ID) so that it can be vectorized
+//
+// Parameter   :  In     : Input array
+//                Out    : Output array
+//                NPar   : Number of particles
+//                Stride : Distance between the same attribute of adjacent particles in In[]
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+void Par_ConvertIC( const T *In, real_par *Out, const long NPar, const int Stride )
+{
+
+   if ( Stride == 1 )
+      for (long p=0; p<NPar; p++)   Out[p] = (real_par)In[p];
+   else
+      for (long p=0; p<NPar; p++)   Out[p] = (real_par)In[p*Stride];
+
+} // FUNCTION : Par_ConvertIC
+
+
+
 #endif // #ifdef PARTICLE
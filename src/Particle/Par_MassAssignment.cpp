@@ -5,6 +5,9 @@
 static bool WithinRho( const int idxRho[], const int RhoSize );
 static bool FarAwayParticle( real_par ParPosX, real_par ParPosY, real_par ParPosZ, const bool Periodic[], const real_par PeriodicSize_Phy[],
                              const real_par EdgeL[], const real_par EdgeR[] );
+#ifdef BITWISE_REPRODUCIBILITY
+static bool SortedByRows( real_par *Pos[], const long NPar );
+#endif
 
 
 
@@ -120,10 +123,12 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
 
 // 2. set up attribute arrays, copy particle position since they might be modified during the position prediction
+//    --> temporary arrays are taken from the scratch arena of this thread to avoid allocation for every call
+   Mis_AcquireScratch();
+
    real_par *Mass   = NULL;
    real_par *Pos[3] = { NULL, NULL, NULL };
    real_par *PType  = NULL;
-   long  ParID, Idx;
 
    if ( UseInputMassPos )
    {
@@ -136,15 +141,17 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
    else
    {
-      Mass = new real_par [NPar];
-
-      for (int d=0; d<3; d++)    Pos[d] = new real_par [NPar];
+      real_par *AttBuf = (real_par*)Mis_GetScratch( SCRATCH_PAR_ATT, 5*NPar*sizeof(real_par) );
 
-      PType = new real_par [NPar];
+      Mass   = AttBuf + 0*NPar;
+      Pos[0] = AttBuf + 1*NPar;
+      Pos[1] = AttBuf + 2*NPar;
+      Pos[2] = AttBuf + 3*NPar;
+      PType  = AttBuf + 4*NPar;
 
       for (long p=0; p<NPar; p++)
       {
-         ParID = ParList[p];
+         const long ParID = ParList[p];
 
          Mass  [p] = amr->Par->Mass[ParID];
          Pos[0][p] = amr->Par->PosX[ParID];
@@ -161,15 +168,28 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
 // 3-1/2: sort particles by their position to fix the order of mass assignment
 //        --> necessary for achieving bitwise reproducibility
+//        --> skip sorting if particles are already in order, for which Mis_SortByRows() returns an identity table
+//        --> Sort_IdxTable == NULL <--> identity table
+   long *Sort_IdxTable = NULL;
+
 #  ifdef BITWISE_REPRODUCIBILITY
-   long *Sort_IdxTable = new long [NPar];
-   const int Sort_Order[3] = { 0, 1, 2 };
+   if (  ! SortedByRows( Pos, NPar )  )
+   {
+      const int Sort_Order[3] = { 0, 1, 2 };
+
+      Sort_IdxTable = (long*)Mis_GetScratch( SCRATCH_PAR_SORT, NPar*sizeof(long) );
 
-   Mis_SortByRows( Pos, Sort_IdxTable, (long)NPar, Sort_Order, 3 );
+      Mis_SortByRows( Pos, Sort_IdxTable, (long)NPar, Sort_Order, 3 );
+   }
 #  endif
 
 
 // 4. deposit particle mass
+//    --> particles are processed in blocks of PAR_MA_NBLOCK
+//        (1) compute the cell indices and weightings of all particles in a block, which has no data dependency
+//            and can thus be vectorized
+//        (2) accumulate the cloud of each particle onto Rho[] in the same order as the particle list
+//            --> results are independent of PAR_MA_NBLOCK
    const double _dh       = 1.0 / dh;
    const double _dh3      = CUBE(_dh);
    const double Ghost_Phy = amr->Par->GhostSize*dh;
@@ -177,10 +197,18 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
    typedef real (*vla)[RhoSize][RhoSize];
    vla Rho3D = ( vla )Rho;
 
-   int      idxRho[3];   // array index for Rho
-   real     ParDens;     // mass density of the cloud
+   int      NCloud = NULL_INT;   // number of cells along each direction covered by the cloud of each particle
+   int      idxRho[3];           // array index for Rho
    real_par EdgeWithGhostL[3], EdgeWithGhostR[3], PeriodicSize_Phy[3];
 
+   switch ( IntScheme )
+   {
+      case ( PAR_INTERP_NGP ):   NCloud = 1;    break;
+      case ( PAR_INTERP_CIC ):   NCloud = 2;    break;
+      case ( PAR_INTERP_TSC ):   NCloud = 3;    break;
+      default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
+   }
+
    for (int d=0; d<3; d++)
    {
       EdgeWithGhostL  [d] = real_par( EdgeL[d] - Ghost_Phy );
@@ -190,232 +218,147 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
       PeriodicSize_Phy[d] = real_par( PeriodicSize[d]*dh );
    }
 
+   real_par BlkPos [3][PAR_MA_NBLOCK];     // particle position
+   bool     BlkSkip   [PAR_MA_NBLOCK];     // true --> particle has no contribution to Rho[]
+   real     BlkDens   [PAR_MA_NBLOCK];     // mass density of the cloud
+   int      BlkCell[3][3][PAR_MA_NBLOCK];  // array index of the left/central/right cells along each direction
+   double   BlkFrac[3][3][PAR_MA_NBLOCK];  // weighting of the left/central/right cells along each direction
 
-   switch ( IntScheme )
+   for (long p0=0; p0<NPar; p0+=PAR_MA_NBLOCK)
    {
-//    4.1 NGP
-      case ( PAR_INTERP_NGP ):
+      const int NBlk = (int)MIN( (long)PAR_MA_NBLOCK, NPar-p0 );
+
+//    4.1 copy particle position to contiguous arrays and set the cloud densities
+      for (int b=0; b<NBlk; b++)
       {
-         for (long p=0; p<NPar; p++)
-         {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.1.0 ignore tracer particles
-//                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
-            if ( PType[Idx] == PTYPE_TRACER )
-               continue;
-
-//          4.1.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-//          4.1.2 calculate the nearest grid index
-            for (int d=0; d<3; d++)
-            {
-               idxRho[d] = (int)FLOOR( ( Pos[d][Idx] - EdgeL[d] )*_dh );
+         const long Idx = ( Sort_IdxTable == NULL ) ? p0+b : Sort_IdxTable[p0+b];
 
-//             periodicity
-               if ( Periodic[d] )
-               {
-                  idxRho[d] = ( idxRho[d] + PeriodicSize[d] ) % PeriodicSize[d];
+         for (int d=0; d<3; d++)    BlkPos[d][b] = Pos[d][Idx];
 
-#                 ifdef DEBUG_PARTICLE
-                  if ( idxRho[d] < 0  ||  idxRho[d] >= PeriodicSize[d] )
-                     Aux_Error( ERROR_INFO, "incorrect idxRho[%d] = %d (PeriodicSize = %d) !!\n",
-                                d, idxRho[d], PeriodicSize[d] );
-#                 endif
-               }
-            }
+//       4.1.1 ignore tracer particles
+//             --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
+//       4.1.2 discard particles far away from the target region
+         BlkSkip[b] = (  PType[Idx] == PTYPE_TRACER  ||
+                         ( CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
+                                                              Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR ) )  );
 
-//          4.1.3 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real_par)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+//       check inactive particles (which have negative mass)
+#        ifdef DEBUG_PARTICLE
+         if ( !BlkSkip[b]  &&  Mass[Idx] < (real_par)0.0 )
+            Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
+#        endif
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = (real)Mass[Idx]*_dh3;
-
-            if (  WithinRho( idxRho, RhoSize )  )
-               Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += ParDens;
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_NGP
-      break;
+         if ( UnitDens )   BlkDens[b] = (real)1.0;
+         else              BlkDens[b] = (real)Mass[Idx]*_dh3;
+      } // for (int b=0; b<NBlk; b++)
 
 
-//    4.2 CIC
-      case ( PAR_INTERP_CIC ):
+//    4.2 calculate the array indices and weightings of the nearby cells
+      for (int d=0; d<3; d++)
       {
-         int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
-         double dr      [3];     // distance to the center of the left cell
-         double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
-
-         for (long p=0; p<NPar; p++)
+         switch ( IntScheme )
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.2.0 ignore tracer particles
-//                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
-            if ( PType[Idx] == PTYPE_TRACER )
-               continue;
-
-//          4.2.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-            for (int d=0; d<3; d++)
+//          4.2.1 NGP: the nearest cell
+            case ( PAR_INTERP_NGP ):
             {
-//             4.2.2 calculate the array index of the left and right cells
-               dr      [d]  = (double)( Pos[d][Idx] - (real_par)EdgeL[d] )*_dh - 0.5;
-               idxLR[0][d]  = (int)FLOOR( dr[d] );
-               idxLR[1][d]  = idxLR[0][d] + 1;
-               dr      [d] -= (double)idxLR[0][d];
-
-//             periodicity
-               if ( Periodic[d] )
+#              pragma omp simd
+               for (int b=0; b<NBlk; b++)
+                  BlkCell[d][0][b] = (int)FLOOR( ( BlkPos[d][b] - EdgeL[d] )*_dh );
+            }
+            break;
+
+//          4.2.2 CIC: the left and right cells, where dr is the distance to the center of the left cell
+            case ( PAR_INTERP_CIC ):
+            {
+#              pragma omp simd
+               for (int b=0; b<NBlk; b++)
                {
-                  for (int t=0; t<2; t++)
-                  {
-                     idxLR[t][d] = ( idxLR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
-
-#                    ifdef DEBUG_PARTICLE
-                     if ( idxLR[t][d] < 0  ||  idxLR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLR[t][d], PeriodicSize[d] );
-#                    endif
-                  }
+                  double dr   = (double)( BlkPos[d][b] - (real_par)EdgeL[d] )*_dh - 0.5;
+                  const int i = (int)FLOOR( dr );
+                  dr         -= (double)i;
+
+                  BlkCell[d][0][b] = i;
+                  BlkCell[d][1][b] = i + 1;
+                  BlkFrac[d][0][b] = 1.0 - dr;
+                  BlkFrac[d][1][b] =       dr;
                }
+            }
+            break;
 
-//             4.2.3 get the weighting of the nearby 8 cells
-               Frac[0][d] = 1.0 - dr[d];
-               Frac[1][d] =       dr[d];
-            } // for (int d=0; d<3; d++)
-
-//          4.2.4 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real_par)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
-
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = (real)Mass[Idx]*_dh3;
-
-            for (int k=0; k<2; k++) {  idxRho[2] = idxLR[k][2];
-            for (int j=0; j<2; j++) {  idxRho[1] = idxLR[j][1];
-            for (int i=0; i<2; i++) {  idxRho[0] = idxLR[i][0];
+//          4.2.3 TSC: the left, central, and right cells, where dr is the distance to the left edge of the central cell
+            case ( PAR_INTERP_TSC ):
+            {
+#              pragma omp simd
+               for (int b=0; b<NBlk; b++)
+               {
+                  double dr   = (double)( BlkPos[d][b] - (real_par)EdgeL[d] )*_dh;
+                  const int i = (int)FLOOR( dr );
+                  dr         -= (double)i;
+
+                  BlkCell[d][0][b] = i - 1;
+                  BlkCell[d][1][b] = i;
+                  BlkCell[d][2][b] = i + 1;
+                  BlkFrac[d][0][b] = 0.5*SQR( 1.0 - dr );
+                  BlkFrac[d][1][b] = 0.5*( 1.0 + 2.0*dr - 2.0*SQR(dr) );
+                  BlkFrac[d][2][b] = 0.5*SQR( dr );
+               }
+            }
+            break;
+         } // switch ( IntScheme )
 
-               if (  WithinRho( idxRho, RhoSize )  )
-                  Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
+//       periodicity
+         if ( Periodic[d] )
+         {
+            for (int t=0; t<NCloud; t++)
+            for (int b=0; b<NBlk; b++)
+            {
+               BlkCell[d][t][b] = ( BlkCell[d][t][b] + PeriodicSize[d] ) % PeriodicSize[d];
 
-            }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_CIC
-      break;
+#              ifdef DEBUG_PARTICLE
+               if (  !BlkSkip[b]  &&  ( BlkCell[d][t][b] < 0  ||  BlkCell[d][t][b] >= PeriodicSize[d] )  )
+                  Aux_Error( ERROR_INFO, "incorrect cell index [%d][%d] = %d (PeriodicSize = %d) !!\n",
+                             t, d, BlkCell[d][t][b], PeriodicSize[d] );
+#              endif
+            }
+         }
+      } // for (int d=0; d<3; d++)
 
 
-//    4.3 TSC
-      case ( PAR_INTERP_TSC ):
+//    4.3 assign mass if within Rho[]
+      if ( IntScheme == PAR_INTERP_NGP )
       {
-         int    idxLCR[3][3];    // array index of the left (idxLCR[0][d]), central (idxLCR[1][d]) and right (idxLCR[2][d]) cells
-         double dr       [3];    // distance to the left edge of the central cell
-         double Frac  [3][3];    // weighting of the left (Frac[0][d]), central (Frac[1][d]) and right (Frac[2][d]) cells
-
-         for (long p=0; p<NPar; p++)
+         for (int b=0; b<NBlk; b++)
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
-
-//          4.3.0 ignore tracer particles
-//                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
-            if ( PType[Idx] == PTYPE_TRACER )
-               continue;
-
-//          4.3.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
-
-            for (int d=0; d<3; d++)
-            {
-//             4.3.2 calculate the array index of the left, central, and right cells
-               dr       [d]  = (double)( Pos[d][Idx] - (real_par)EdgeL[d] )*_dh;
-               idxLCR[1][d]  = (int)FLOOR( dr[d] );
-               idxLCR[0][d]  = idxLCR[1][d] - 1;
-               idxLCR[2][d]  = idxLCR[1][d] + 1;
-               dr       [d] -= (double)idxLCR[1][d];
-
-//             periodicity
-               if ( Periodic[d] )
-               {
-                  for (int t=0; t<3; t++)
-                  {
-                     idxLCR[t][d] = ( idxLCR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
-
-#                    ifdef DEBUG_PARTICLE
-                     if ( idxLCR[t][d] < 0  ||  idxLCR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLCR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLCR[t][d], PeriodicSize[d] );
-#                    endif
-                  }
-               }
+            if ( BlkSkip[b] )    continue;
 
-//             4.3.3 get the weighting of the nearby 27 cells
-               Frac[0][d] = 0.5*SQR( 1.0 - dr[d] );
-               Frac[1][d] = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
-               Frac[2][d] = 0.5*SQR( dr[d] );
-            } // for (int d=0; d<3; d++)
+            for (int d=0; d<3; d++)    idxRho[d] = BlkCell[d][0][b];
 
-//          4.3.4 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+            if (  WithinRho( idxRho, RhoSize )  )
+               Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += BlkDens[b];
+         }
+      }
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = (real)Mass[Idx]*_dh3;
+      else
+      {
+         for (int b=0; b<NBlk; b++)
+         {
+            if ( BlkSkip[b] )    continue;
 
-            for (int k=0; k<3; k++) {  idxRho[2] = idxLCR[k][2];
-            for (int j=0; j<3; j++) {  idxRho[1] = idxLCR[j][1];
-            for (int i=0; i<3; i++) {  idxRho[0] = idxLCR[i][0];
+            for (int k=0; k<NCloud; k++) {  idxRho[2] = BlkCell[2][k][b];
+            for (int j=0; j<NCloud; j++) {  idxRho[1] = BlkCell[1][j][b];
+            for (int i=0; i<NCloud; i++) {  idxRho[0] = BlkCell[0][i][b];
 
                if (  WithinRho( idxRho, RhoSize )  )
-                  Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
+                  Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += BlkDens[b]*BlkFrac[0][i][b]*BlkFrac[1][j][b]*BlkFrac[2][k][b];
+
             }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_TSC
-      break;
+         }
+      }
+   } // for (long p0=0; p0<NPar; p0+=PAR_MA_NBLOCK)
 
-      default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
-   } // switch ( IntScheme )
 
-
-// 5. free memory
-   if ( !UseInputMassPos )
-   {
-      delete [] Mass;
-      delete [] PType;
-      for (int d=0; d<3; d++)    delete [] Pos[d];
-   }
-
-#  ifdef BITWISE_REPRODUCIBILITY
-   delete [] Sort_IdxTable;
-#  endif
+// 5. release the scratch arena
+   Mis_ReleaseScratch();
 
 } // FUNCTION : Par_MassAssignment
 
@@ -505,4 +448,40 @@ bool FarAwayParticle( real_par ParPosX, real_par ParPosY, real_par ParPosZ, cons
 
 
 
+#ifdef BITWISE_REPRODUCIBILITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SortedByRows
+// Description :  Check whether particles are already sorted by their position
+//
+// Note        :  1. Use the same order as Par_MassAssignment(): x first, then y, and then z
+//                2. Require a strictly increasing order so that the result is the same as Mis_SortByRows()
+//                   --> Particles at exactly the same position are always sent to Mis_SortByRows()
+//
+// Parameter   :  Pos  : Particle position arrays
+//                NPar : Number of particles
+//
+// Return      :  true --> Mis_SortByRows() would return an identity table
+//-------------------------------------------------------------------------------------------------------
+bool SortedByRows( real_par *Pos[], const long NPar )
+{
+
+   for (long p=1; p<NPar; p++)
+   {
+      if      ( Pos[0][p] > Pos[0][p-1] )   continue;
+      else if ( Pos[0][p] < Pos[0][p-1] )   return false;
+
+      if      ( Pos[1][p] > Pos[1][p-1] )   continue;
+      else if ( Pos[1][p] < Pos[1][p-1] )   return false;
+
+      if      ( Pos[2][p] > Pos[2][p-1] )   continue;
+      else                                  return false;
+   }
+
+   return true;
+
+} // FUNCTION : SortedByRows
+#endif // #ifdef BITWISE_REPRODUCIBILITY
+
+
+
 #endif // #ifdef PARTICLE
@@ -0,0 +1,162 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_SortParticle
+// Description :  Reorder and compact the particle repository so that particles belonging to the same patch
+//                are stored contiguously
+//
+// Note        :  1. Invoked by main() every PAR_SORT_INTERVAL root-level steps
+//                2. Patches are ordered by level first and then by the space-filling-curve index LB_Idx
+//                   (for LOAD_BALANCE) or by patch ID (otherwise)
+//                   --> Particles of adjacent patches are also close in memory
+//                   --> Particle order within each patch is unchanged so that all results (e.g., the mass
+//                       assignment) remain bitwise identical
+//                3. Inactive particles are removed from the repository
+//                   --> NPar_AcPlusInac == NPar_Active and NPar_Inactive == 0 after calling this function
+//                4. Particle indices change after calling this function. Therefore, it must NOT be invoked when
+//                   any particle index is stored outside ParList[] of real patches (e.g., ParList_Copy[] and
+//                   ParList_Escp[])
+//                5. Only one attribute array is reallocated at a time to minimize the memory overhead
+//
+// Parameter   :  None
+//
+// Return      :  amr->Par, ParList[] of all real patches
+//-------------------------------------------------------------------------------------------------------
+void Par_SortParticle()
+{
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "   %s ...", __FUNCTION__ );
+
+
+   Particle_t *Par = amr->Par;
+
+   int  *PIDOrder [NLEVEL];
+   long *ParOffset[NLEVEL];
+
+
+// 1. sort real patches on each level
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NReal = amr->NPatchComma[lv][1];
+
+      PIDOrder [lv] = new int  [NReal];
+      ParOffset[lv] = new long [NReal];
+
+#     ifdef LOAD_BALANCE
+      long *LBIdx = new long [NReal];
+
+      for (int PID=0; PID<NReal; PID++)   LBIdx[PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+      if ( NReal > 0 )  Mis_Heapsort( NReal, LBIdx, PIDOrder[lv] );
+
+      delete [] LBIdx;
+
+#     else
+      for (int PID=0; PID<NReal; PID++)   PIDOrder[lv][PID] = PID;
+#     endif
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// 2. set the offset of each patch in the new repository
+   long NPar_Sorted = 0L;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int t=0; t<amr->NPatchComma[lv][1]; t++)
+   {
+      const int PID = PIDOrder[lv][t];
+
+      ParOffset[lv][PID] = NPar_Sorted;
+      NPar_Sorted       += amr->patch[0][lv][PID]->NPar;
+   }
+
+   if ( NPar_Sorted != Par->NPar_Active )
+      Aux_Error( ERROR_INFO, "number of particles in real patches (%ld) != NPar_Active (%ld) !!\n",
+                 NPar_Sorted, Par->NPar_Active );
+
+
+// 3. copy particle attributes to the new arrays
+   const long NewParListSize = MAX( 1L, NPar_Sorted );   // must > 0
+
+   for (int v=0; v<PAR_NATT_TOTAL; v++)
+   {
+      const real_par *OldAtt = Par->Attribute[v];
+            real_par *NewAtt = (real_par*)malloc( NewParListSize*sizeof(real_par) );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+#        pragma omp parallel for schedule( runtime )
+         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+         {
+            const patch_t *Patch  = amr->patch[0][lv][PID];
+            real_par      *NewPtr = NewAtt + ParOffset[lv][PID];
+
+            for (int p=0; p<Patch->NPar; p++)   NewPtr[p] = OldAtt[ Patch->ParList[p] ];
+         }
+      }
+
+      free( Par->Attribute[v] );
+      Par->Attribute[v] = NewAtt;
+   } // for (int v=0; v<PAR_NATT_TOTAL; v++)
+
+
+// 4. reset the particle lists of all real patches
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         patch_t *Patch = amr->patch[0][lv][PID];
+
+         for (int p=0; p<Patch->NPar; p++)   Patch->ParList[p] = ParOffset[lv][PID] + p;
+      }
+   }
+
+
+// 5. reset particle parameters
+   Par->NPar_AcPlusInac = NPar_Sorted;
+   Par->NPar_Inactive   = 0L;
+   Par->ParListSize     = NewParListSize;
+
+
+// 6. reset attribute pointers
+   Par->Mass = Par->Attribute[PAR_MASS];
+   Par->PosX = Par->Attribute[PAR_POSX];
+   Par->PosY = Par->Attribute[PAR_POSY];
+   Par->PosZ = Par->Attribute[PAR_POSZ];
+   Par->VelX = Par->Attribute[PAR_VELX];
+   Par->VelY = Par->Attribute[PAR_VELY];
+   Par->VelZ = Par->Attribute[PAR_VELZ];
+   Par->Time = Par->Attribute[PAR_TIME];
+   Par->Type = Par->Attribute[PAR_TYPE];
+#  ifdef STORE_PAR_ACC
+   Par->AccX = Par->Attribute[PAR_ACCX];
+   Par->AccY = Par->Attribute[PAR_ACCY];
+   Par->AccZ = Par->Attribute[PAR_ACCZ];
+#  endif
+
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] PIDOrder [lv];
+      delete [] ParOffset[lv];
+   }
+
+
+// 7. check
+#  ifdef DEBUG_PARTICLE
+   Par_Aux_Check_Particle( __FUNCTION__ );
+#  endif
+
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Par_SortParticle
+
+
+
+#endif // #ifdef PARTICLE
@@ -36,6 +36,7 @@
 //                   --> Use "TimeNew" to determine the target time
 //                   --> StoreAcc must be on, and UseStoredAcc must be off
 //                9. Does not update any tracer particle, which is done by Par_UpdateTracerParticle()
+//               10. For OPT__LB_MEASURED_COST, record the time spent on each patch group for load balancing
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach (also used by PAR_UPSTEP_ACC_ONLY)
@@ -227,6 +228,10 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
 //    nothing to do if there are no target particles in the target patch group
       if ( !GotYou )    continue;
 
+#     ifdef LOAD_BALANCE
+      const double Cost_t0 = ( OPT__LB_MEASURED_COST ) ? MPI_Wtime() : 0.0;
+#     endif
+
 
 //    2. prepare the potential data for the patch group with particles (need NSIDE_26 for ParGhost>0 )
       if ( !UseStoredAcc  &&  UsePot )
@@ -614,6 +619,13 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
             } // amr->Par->Integ
          } // for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)`
       } // for (int PID=PID0, P=0; PID<PID0+8; PID++, P++)
+
+//    record the time spent on this patch group
+//    --> divide it by the number of threads to be consistent with the wall-clock time measured in InvokeSolver()
+#     ifdef LOAD_BALANCE
+      if ( OPT__LB_MEASURED_COST )
+         LB_RecordMeasuredCost( lv, 1, &PID0, ( MPI_Wtime() - Cost_t0 )/OMP_NTHREAD );
+#     endif
    } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
 
 // 7. free memory
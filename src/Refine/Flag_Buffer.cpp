@@ -12,7 +12,12 @@
 // Note        :  1. All flags should be initialized as "false" by calling Flag_Real() in advance
 //                2. ParaVar->BuffFlag_NList[] and ParaVar->BuffFlag_PosList[] must be prepared
 //                   in advance by calling Buf_RecordBoundaryFlag() and MPI_ExchangeBoundaryFlag()
-//                3. No OpenMP directives are applied in this function
+//                3. Each received entry stores the position of a flagged boundary patch and the bitmask of
+//                   its flagged layers > 0 (see Buf_RecordBoundaryFlag())
+//                   --> The boundary patch is located by a binary search in the sorted BounP_PosList[] so that
+//                       all entries can be processed independently with OpenMP
+//                4. Different threads may flag the same buffer patch, which is harmless since flags are only
+//                   set to true here (same as the flag-buffer extension in Flag_Real())
 //
 // Parameter   :  lv : Target refinement level to be flagged
 //-------------------------------------------------------------------------------------------------------
@@ -21,67 +26,74 @@ void Flag_Buffer( const int lv )
 
 // MirrorSib : the mirror-symmetric sibling index
    const int MirrorSib[26] = { 1,0,3,2,5,4,9,8,7,6,13,12,11,10,17,16,15,14,25,24,23,22,21,20,19,18 };
-   int BounPID, BuffPID, FlagPos, SibPID, TargetID, FlagLayer, Sib;
 
-   for (int s=0; s<26; s++)
+#  pragma omp parallel
    {
-      FlagLayer = TABLE_05( s );
-      TargetID  = 0;
-
-      for (int ID=0; ID<amr->ParaVar->BuffFlag_NList[lv][s]; ID+=FlagLayer)
+      for (int s=0; s<26; s++)
       {
-#        ifdef GAMER_DEBUG
-         if ( MPI_SibRank[s] < 0 )  Aux_Error( ERROR_INFO, "amr->ParaVar->BuffFlag_NList[%d][%d] = %d != 0 !!\n",
-                                               lv, s, amr->ParaVar->BuffFlag_NList[lv][s] );
-#        endif
+         const int  FlagLayer = TABLE_05( s );
+         const int  NFlag     = amr->ParaVar->BuffFlag_NList[lv][s] / NFLAG_PER_BOUNP;
+         const int  NBounP    = amr->ParaVar->BounP_NList[lv][s];
+         const int *BounPos   = amr->ParaVar->BounP_PosList[lv][s];
+         const int *FlagList  = amr->ParaVar->BuffFlag_PosList[lv][s];
 
-         FlagPos = amr->ParaVar->BuffFlag_PosList[lv][s][ID];
+         int FlagPos, LayerMask, TargetID, BounPID, BuffPID, SibPID;
 
-         while ( amr->ParaVar->BounP_PosList[lv][s][TargetID] != FlagPos )
+#        pragma omp for schedule( runtime ) nowait
+         for (int t=0; t<NFlag; t++)
          {
-            TargetID++;
+#           ifdef GAMER_DEBUG
+            if ( MPI_SibRank[s] < 0 )  Aux_Error( ERROR_INFO, "amr->ParaVar->BuffFlag_NList[%d][%d] = %d != 0 !!\n",
+                                                  lv, s, amr->ParaVar->BuffFlag_NList[lv][s] );
+#           endif
+
+            FlagPos   = FlagList[ NFLAG_PER_BOUNP*t + 0 ];
+            LayerMask = FlagList[ NFLAG_PER_BOUNP*t + 1 ];
+            TargetID  = Mis_BinarySearch( BounPos, 0, NBounP-1, FlagPos );
 
 //          BounPID must exist due to the proper-nesting condition
 #           ifdef GAMER_DEBUG
-            if ( TargetID >= amr->ParaVar->BounP_NList[lv][s] )
-               Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TargetID", TargetID );
+            if ( TargetID < 0 )
+               Aux_Error( ERROR_INFO, "FlagPos %d found no matching boundary patch (lv %d, s %d) !!\n", FlagPos, lv, s );
 #           endif
-         }
 
-         BounPID = amr->ParaVar->BounP_IDList[lv][s][TargetID];
-         BuffPID = amr->patch[0][lv][BounPID]->sibling[s];
+            BounPID = amr->ParaVar->BounP_IDList[lv][s][TargetID];
+            BuffPID = amr->patch[0][lv][BounPID]->sibling[s];
 
 
-//       BuffPID must exist and be a buffer patch since that the flagging status should be the same over all processes
-#        ifdef GAMER_DEBUG
-         if ( BuffPID < amr->NPatchComma[lv][1]  ||  BuffPID >= amr->num[lv] )
-            Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "BuffPID", BuffPID );
-#        endif
+//          BuffPID must exist and be a buffer patch since that the flagging status should be the same over all processes
+#           ifdef GAMER_DEBUG
+            if ( BuffPID < amr->NPatchComma[lv][1]  ||  BuffPID >= amr->num[lv] )
+               Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "BuffPID", BuffPID );
+#           endif
 
 
-//       flag the patch with layer = 0
-         amr->patch[0][lv][BuffPID]->flag = true;
+//          flag the patch with layer = 0
+            amr->patch[0][lv][BuffPID]->flag = true;
 
 
-//       flag the patch with layer > 0
-         for (int n=1; n<FlagLayer; n++)
-         {
-            if ( amr->ParaVar->BuffFlag_PosList[lv][s][ID+n] == BUFFER_IS_FLAGGED )
+//          flag the patch with layer > 0
+            for (int n=1; n<FlagLayer; n++)
             {
-               Sib    = TABLE_06( MirrorSib[s], n );
-               SibPID = amr->patch[0][lv][BuffPID]->sibling[Sib];
+               if ( LayerMask & ( 1 << n ) )
+               {
+                  SibPID = amr->patch[0][lv][BuffPID]->sibling[ TABLE_06( MirrorSib[s], n ) ];
 
-#              ifdef GAMER_DEBUG
-               if ( SibPID < 0 )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "SibPID", SibPID );
-#              endif
+#                 ifdef GAMER_DEBUG
+                  if ( SibPID < 0 )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "SibPID", SibPID );
+#                 endif
 
-               amr->patch[0][lv][SibPID]->flag = true;
+                  amr->patch[0][lv][SibPID]->flag = true;
+               }
             }
-         }
-      } // for (int ID=0; ID<BuffFlag_NList[lv][s]; ID+=FlagLayer)
+         } // for (int t=0; t<NFlag; t++)
+      } // for (int s=0; s<26; s++)
+   } // OpenMP parallel region
 
 
-//    deallocate the memory previously allocated by "MPI_ExchangeBoundaryFlag"
+// deallocate the memory previously allocated by "MPI_ExchangeBoundaryFlag"
+   for (int s=0; s<26; s++)
+   {
       if ( amr->ParaVar->BuffFlag_PosList[lv][s] != NULL )
       {
          delete [] amr->ParaVar->BuffFlag_PosList[lv][s];
@@ -89,8 +101,7 @@ void Flag_Buffer( const int lv )
       }
 
       amr->ParaVar->BuffFlag_NList[lv][s] = 0;
-
-   } // for (int s=0; s<26; s++)
+   }
 
 } // FUNCTION : Flag_Buffer
 
@@ -4,6 +4,11 @@
 void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 #endif
 
+// maximum signal speed used by OPT__DT_FLU_CACHE (declared in Flu_AdvanceDt.cpp)
+#if ( MODEL == HYDRO )
+extern bool Flu_MaxSpeed_Valid[NLEVEL];
+#endif
+
 
 
 
@@ -15,6 +20,11 @@ void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 //                2. Data of all sibling-buffer patches must be prepared in advance for creating new
 //                   fine-grid patches by spatial interpolation
 //                3. If LOAD_BALANCE is turned on and UseLBFunc==true, this function will invoke LB_Refine() instead
+//                4. New child patches are allocated and filled with data by multiple OpenMP threads
+//                   --> Their patch indices are reserved sequentially in advance so that the results do not
+//                       depend on the number of threads
+//                5. Invalidate the maximum signal speed at lv+1 recorded for OPT__DT_FLU_CACHE since it does not
+//                   cover the newly created patches
 //
 // Parameter   :  lv        : Target refinement level to be refined
 //                UseLBFunc : Invoke the load-balance alternative functions for the grid refinement
@@ -24,6 +34,12 @@ void ELBDM_GetPhase_DebugOnly( real *CData, const int CSize );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 {
 
+// new patches at lv+1 have not been measured by the fluid solver
+#  if ( MODEL == HYDRO )
+   if ( lv < NLEVEL-1 )    Flu_MaxSpeed_Valid[lv+1] = false;
+#  endif
+
+
 // invoke the load-balance refine function
 #  ifdef LOAD_BALANCE
    if ( UseLBFunc == USELB_YES )
@@ -59,9 +75,10 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int  FMagSg      = amr->MagSg[lv+1];      // sandglass of magnetic field  at level "lv+1"
 #  endif
 
-   int *Cr            = NULL;    // corner coordinates
    int *BufGrandTable = NULL;    // table recording the patch IDs of grandson buffer patches
    int *BufSonTable   = NULL;    // table recording the linking index of each buffer father patch to BufGrandTable
+   int  NNewFa        = 0;       // number of father patches to be refined
+   int *NewFaPID      = NULL;    // patch indices of father patches to be refined
 
 
 // parameters for spatial interpolation
@@ -77,14 +94,9 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int CStart_Flu[3] = { CGhost_Flu, CGhost_Flu, CGhost_Flu };
    const int CSize_Flu3[3] = { CSize_Flu, CSize_Flu, CSize_Flu };
 
-// coarse- and fine-grid fluid arrays for interpolation
-   real *Flu_CData1D = new real [ NCOMP_TOTAL*CUBE(CSize_Flu) ];
-   real *Flu_FData1D = new real [ NCOMP_TOTAL*CUBE(FSize_CC ) ];
-// 1D array -> 3D array
+// 1D array -> 3D array for the coarse- and fine-grid fluid arrays
    typedef real (*vla_FluC)[CSize_Flu][CSize_Flu][CSize_Flu];
    typedef real (*vla_FluF)[FSize_CC ][FSize_CC ][FSize_CC ];
-   vla_FluC Flu_CData = ( vla_FluC )Flu_CData1D;
-   vla_FluF Flu_FData = ( vla_FluF )Flu_FData1D;
 
 #  ifdef GRAVITY
    int NSide_Pot, CGhost_Pot;
@@ -93,14 +105,9 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int CSize_Pot     = PS1 + 2*CGhost_Pot;
    const int CStart_Pot[3] = { CGhost_Pot, CGhost_Pot, CGhost_Pot };
 
-// coarse- and fine-grid potential arrays for interpolation
-   real *Pot_CData1D = new real [ CUBE(CSize_Pot) ];
-   real *Pot_FData1D = new real [ CUBE(FSize_CC ) ];
-// 1D array -> 3D array
+// 1D array -> 3D array for the coarse- and fine-grid potential arrays
    typedef real (*vla_PotC)[CSize_Pot][CSize_Pot];
    typedef real (*vla_PotF)[FSize_CC ][FSize_CC ];
-   vla_PotC Pot_CData = ( vla_PotC )Pot_CData1D;
-   vla_PotF Pot_FData = ( vla_PotF )Pot_FData1D;
 #  endif
 
 #  ifdef MHD
@@ -122,24 +129,12 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                                    { CSize_Mag_T, CSize_Mag_N, CSize_Mag_T },
                                    { CSize_Mag_T, CSize_Mag_T, CSize_Mag_N }  };
 
-// coarse- and fine-grid B field arrays for interpolation
-   real *Mag_CData1D = new real [ NCOMP_MAG*CSize_Mag_N*SQR(CSize_Mag_T) ];
-   real *Mag_FData1D = new real [ NCOMP_MAG*PS2P1*SQR(PS2) ];
-// 1D array -> 3D array
+// 1D array -> 3D array for the coarse- and fine-grid B field arrays
    typedef real (*vla_MagC)[ CSize_Mag_N*SQR(CSize_Mag_T) ];
    typedef real (*vla_MagF)[ PS2P1*SQR(PS2) ];
-   vla_MagC Mag_CData = ( vla_MagC )Mag_CData1D;
-   vla_MagF Mag_FData = ( vla_MagF )Mag_FData1D;
-
-   real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
 
    bool *JustRefined = new bool [ amr->num[lv] ];
    for (int PID=0; PID<amr->num[lv]; PID++)  JustRefined[PID] = false;
-
-// fine-grid, cell-centered B field for INT_REDUCE_MONO_COEFF
-   real (*Mag_FDataCC_IntIter)[NCOMP_MAG] = new real [ CUBE(FSize_CC) ][NCOMP_MAG];
 #  endif // #ifdef MHD
 
 
@@ -220,37 +215,85 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 // c. check the refinement flags for all real patches at level "lv"
 // ------------------------------------------------------------------------------------------------
 
-// (c1) construct new child patches (allocate one patch group at a time)
+// (c1) construct new child patches
 //      --> note that we must do this BEFORE deallocating any child patch to retain high-resolution
 //          B field on the boundaries of newly allocated patches
 // ================================================================================================
-//#  pragma omp parallel for private( ??? )
+// (c1.1) reserve the indices of all new child patches and construct relation : father -> child
+//        --> done sequentially so that the patch indices are the same as allocating one patch group at a time
+   NewFaPID = new int [ amr->NPatchComma[lv][1] ];
+
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
       patch_t *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
 
-      if ( Pedigree->flag  &&  Pedigree->son == -1 )
-      {
-//       (c1.1) construct relation : father -> child
-         Pedigree->son = amr->num[lv+1];
+      if ( Pedigree->flag  &&  Pedigree->son == -1 )  NewFaPID[ NNewFa ++ ] = PID;
+   }
 
+   const int NewSonPID0 = amr->preserve( lv+1, 8*NNewFa );
 
-//       (c1.2) allocate child patches and construct relation : child -> father
-         Cr = Pedigree->corner;
+   for (int t=0; t<NNewFa; t++)
+   {
+      const int PID = NewFaPID[t];
 
-         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
+      amr->patch[0][lv][PID]->son = NewSonPID0 + 8*t;
 
-//       record the newly refined father patches
-#        ifdef MHD
-         JustRefined[PID] = true;
-#        endif
+//    record the newly refined father patches
+#     ifdef MHD
+      JustRefined[PID] = true;
+#     endif
+   }
+
+
+// (c1.2) allocate child patches and assign data to them by spatial interpolation
+//        --> different patch groups are independent of each other and can thus be processed in parallel
+#  pragma omp parallel
+   {
+//    per-thread coarse- and fine-grid arrays for interpolation
+      real *Flu_CData1D = new real [ NCOMP_TOTAL*CUBE(CSize_Flu) ];
+      real *Flu_FData1D = new real [ NCOMP_TOTAL*CUBE(FSize_CC ) ];
+      vla_FluC Flu_CData = ( vla_FluC )Flu_CData1D;
+      vla_FluF Flu_FData = ( vla_FluF )Flu_FData1D;
+
+#     ifdef GRAVITY
+      real *Pot_CData1D = new real [ CUBE(CSize_Pot) ];
+      real *Pot_FData1D = new real [ CUBE(FSize_CC ) ];
+      vla_PotC Pot_CData = ( vla_PotC )Pot_CData1D;
+      vla_PotF Pot_FData = ( vla_PotF )Pot_FData1D;
+#     endif
+
+#     ifdef MHD
+      real *Mag_CData1D = new real [ NCOMP_MAG*CSize_Mag_N*SQR(CSize_Mag_T) ];
+      real *Mag_FData1D = new real [ NCOMP_MAG*PS2P1*SQR(PS2) ];
+      vla_MagC Mag_CData = ( vla_MagC )Mag_CData1D;
+      vla_MagF Mag_FData = ( vla_MagF )Mag_FData1D;
+
+      real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
+
+//    fine-grid, cell-centered B field for INT_REDUCE_MONO_COEFF
+      real (*Mag_FDataCC_IntIter)[NCOMP_MAG] = new real [ CUBE(FSize_CC) ][NCOMP_MAG];
+#     endif // #ifdef MHD
+
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NNewFa; t++)
+      {
+         const int PID        = NewFaPID[t];
+         patch_t  *Pedigree   = amr->patch[0][lv][PID];   // fixed to Sg=0 for the patch relation
+         const int SonPID0    = Pedigree->son;
+         const int *Cr        = Pedigree->corner;
+
+
+//       (c1.2.1) allocate child patches and construct relation : child -> father
+         amr->pnew_reserved( lv+1, SonPID0+0, Cr[0],       Cr[1],       Cr[2],       PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+1, Cr[0]+Width, Cr[1],       Cr[2],       PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+2, Cr[0],       Cr[1]+Width, Cr[2],       PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+3, Cr[0],       Cr[1],       Cr[2]+Width, PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+4, Cr[0]+Width, Cr[1]+Width, Cr[2],       PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+5, Cr[0],       Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+6, Cr[0]+Width, Cr[1],       Cr[2]+Width, PID, true, true, true );
+         amr->pnew_reserved( lv+1, SonPID0+7, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
 
 
 //       (c1.3) assign data to child patches by spatial interpolation
@@ -887,7 +930,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 //       (c1.3.5) copy data from XXX_FData[] to patch pointers
          for (int LocalID=0; LocalID<8; LocalID++)
          {
-            const int SonPID = amr->num[lv+1] - 8 + LocalID;
+            const int SonPID = SonPID0 + LocalID;
 
             offset_in[0] = TABLE_02( LocalID, 'x', 0, PS1 );
             offset_in[1] = TABLE_02( LocalID, 'y', 0, PS1 );
@@ -958,14 +1001,31 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
             }
 #           endif
          } // for (int LocalID=0; LocalID<8; LocalID++)
+      } // for (int t=0; t<NNewFa; t++)
+
+//    free per-thread arrays
+      delete [] Flu_CData1D;
+      delete [] Flu_FData1D;
+#     ifdef GRAVITY
+      delete [] Pot_CData1D;
+      delete [] Pot_FData1D;
+#     endif
+#     ifdef MHD
+      delete [] Mag_CData1D;
+      delete [] Mag_FData1D;
+      for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
+      delete [] Mag_FDataCC_IntIter;
+#     endif
+   } // OpenMP parallel region
+
+
+// (c1.4) pass particles from father to son
+//        --> done sequentially after all child patches have been allocated
+#  ifdef PARTICLE
+   for (int t=0; t<NNewFa; t++)  Par_PassParticle2Son_SinglePatch( lv, NewFaPID[t] );
+#  endif
 
-
-//       (c1.4) pass particles from father to son
-#        ifdef PARTICLE
-         Par_PassParticle2Son_SinglePatch( lv, PID );
-#        endif
-      } // if ( Pedigree->flag  &&  Pedigree->son == -1 )
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   delete [] NewFaPID;
 
 
 // (c2) remove unflagged child patches (deallocate one patch group at a time)
@@ -1030,18 +1090,8 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 
 // free memory
-   delete [] Flu_CData1D;
-   delete [] Flu_FData1D;
-#  ifdef GRAVITY
-   delete [] Pot_CData1D;
-   delete [] Pot_FData1D;
-#  endif
 #  ifdef MHD
-   delete [] Mag_CData1D;
-   delete [] Mag_FData1D;
-   for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
    delete [] JustRefined;
-   delete [] Mag_FDataCC_IntIter;
 #  endif
 
 // initialize the amr->NPatchComma list for the buffer patches
@@ -6,8 +6,14 @@
 
 static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const long RhoK_Size );
 static void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const long RhoK_Size );
+#if ( SUPPORT_FFTW == FFTW3 )
+static void FFT_Pencil( real *RhoK, real *Work, const real Poi_Coeff );
+#endif
 
 extern root_fftw::real_plan_nd     FFTW_Plan_Poi, FFTW_Plan_Poi_Inv;
+#if ( SUPPORT_FFTW == FFTW3 )
+extern FFTW_Pencil_t               FFTW_Pencil_Poi;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  FFT_Periodic
@@ -162,6 +168,121 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 } // FUNCTION : FFT_Isolated
 
 
+
+#if ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil
+// Description :  Evaluate the gravitational potential by FFT in the pencil decomposition (OPT__FFTW_PENCIL)
+//
+// Note        :  1. Work with both periodic and isolated BC's
+//                   --> Same k-space operations as FFT_Periodic() and FFT_Isolated()
+//                2. Input density and output potential are stored in the x-pencil layout, and the k-space data
+//                   are in the z-pencil layout [y][x][z] (see FFTW_Pencil_t)
+//
+// Parameter   :  RhoK      : Array storing the input density and output potential
+//                Work      : Work array for FFTW_Pencil_Forward/Backward()
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil( real *RhoK, real *Work, const real Poi_Coeff )
+{
+
+   const FFTW_Pencil_t &P = FFTW_Pencil_Poi;
+
+   const int  local_nx  = P.XC_Start[ P.Coord[0]+1 ] - P.XC_Start[ P.Coord[0] ];
+   const int  local_ny  = P.YK_Start[ P.Coord[1]+1 ] - P.YK_Start[ P.Coord[1] ];
+   const int  i_start   = P.XC_Start[ P.Coord[0] ];
+   const int  j_start   = P.YK_Start[ P.Coord[1] ];
+   const int  Nz        = P.N[2];
+   const long NCplx     = (long)local_ny*local_nx*Nz;
+
+   gamer_fftw::fft_complex *cdata = (gamer_fftw::fft_complex*) RhoK;
+
+
+// forward FFT
+   FFTW_Pencil_Forward( P, RhoK, Work );
+
+
+// periodic BC: divide the Rho_K by -k^2
+   if ( OPT__BC_POT == BC_POT_PERIODIC )
+   {
+      const int Nx = P.N[0];
+      const int Ny = P.N[1];
+      real kx[P.NxC], ky[Ny], kz[Nz];
+      real sinkx2[P.NxC], sinky2[Ny], sinkz2[Nz];
+
+      for (int i=0; i<P.NxC; i++) {  kx    [i] = 2.0*M_PI/Nx*i;
+                                     sinkx2[i] = SQR(  SIN( (real)0.5*kx[i] )  );    }
+      for (int j=0; j<Ny;    j++) {  ky    [j] = ( j <= Ny/2 ) ? 2.0*M_PI/Ny*j : 2.0*M_PI/Ny*(j-Ny);
+                                     sinky2[j] = SQR(  SIN( (real)0.5*ky[j] )  );    }
+      for (int k=0; k<Nz;    k++) {  kz    [k] = ( k <= Nz/2 ) ? 2.0*M_PI/Nz*k : 2.0*M_PI/Nz*(k-Nz);
+                                     sinkz2[k] = SQR(  SIN( (real)0.5*kz[k] )  );    }
+
+#     pragma omp parallel for collapse( 2 ) schedule( static )
+      for (int jj=0; jj<local_ny; jj++)
+      for (int ii=0; ii<local_nx; ii++)
+      for (int k=0; k<Nz; k++)
+      {
+         const long ID   = ( (long)jj*local_nx + ii )*Nz + k;
+         const real Deno = -4.0 * ( sinkx2[i_start+ii] + sinky2[j_start+jj] + sinkz2[k] );
+
+//       remove the DC mode
+         if ( Deno == 0.0 )
+         {
+            c_re(cdata[ID]) = 0.0;
+            c_im(cdata[ID]) = 0.0;
+         }
+
+         else
+         {
+            c_re(cdata[ID]) = c_re(cdata[ID]) * Poi_Coeff / Deno;
+            c_im(cdata[ID]) = c_im(cdata[ID]) * Poi_Coeff / Deno;
+         }
+      }
+   } // if ( OPT__BC_POT == BC_POT_PERIODIC )
+
+
+// isolated BC: multiply density and Green's function in the k space
+   else
+   {
+      const gamer_fftw::fft_complex *gFuncK_cplx = (gamer_fftw::fft_complex *)GreenFuncK;
+
+#     pragma omp parallel for schedule( static )
+      for (long t=0; t<NCplx; t++)
+      {
+         const real Re = c_re(cdata[t]);
+         const real Im = c_im(cdata[t]);
+
+         c_re(cdata[t]) = Re*c_re(gFuncK_cplx[t]) - Im*c_im(gFuncK_cplx[t]);
+         c_im(cdata[t]) = Re*c_im(gFuncK_cplx[t]) + Im*c_re(gFuncK_cplx[t]);
+      }
+   } // if ( OPT__BC_POT == BC_POT_PERIODIC ) ... else
+
+
+// backward FFT
+   FFTW_Pencil_Backward( P, RhoK, Work );
+
+
+// normalization
+// --> effect of "4*PI*NEWTON_G" and the FFT normalization have been included in gFuncK for the isolated BC,
+//     but the scale factor in the comoving frame hasn't
+   const real dh   = amr->dh[0];
+   real       Norm = (real)1.0;
+
+   if ( OPT__BC_POT == BC_POT_PERIODIC )  Norm = dh*dh / ( (real)P.N[0]*P.N[1]*P.N[2] );
+#  ifdef COMOVING
+   else                                   Norm = Poi_Coeff / ( 4.0*M_PI*NEWTON_G );
+#  endif
+
+   if ( Norm != (real)1.0 )
+   {
+#     pragma omp parallel for schedule( static )
+      for (long t=0; t<P.TotalSize; t++)  RhoK[t] *= Norm;
+   }
+
+} // FUNCTION : FFT_Pencil
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  CPU_PoissonSolver_FFT
 // Description :  Evaluate the base-level potential by FFT
@@ -175,6 +296,43 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const l
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime )
 {
 
+// pencil decomposition
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+   {
+      if ( OPT__BC_POT != BC_POT_PERIODIC  &&  OPT__BC_POT != BC_POT_ISOLATED )
+         Aux_Error( ERROR_INFO, "unsupported paramter %s = %d !!\n", "OPT__BC_POT", OPT__BC_POT );
+
+      const bool ForPoisson = true;
+
+      real *RhoK = (real*) root_fftw::fft_malloc( sizeof(real)*FFTW_Pencil_Poi.TotalSize );
+      real *Work = (real*) root_fftw::fft_malloc( sizeof(real)*FFTW_Pencil_Poi.TotalSize );
+      long *RecvBuf_PIdx = NULL;
+      int  *List_PID     [MPI_NRank];
+      int  *List_jk      [MPI_NRank];
+      long  List_NSendRow[MPI_NRank];
+      long  List_NRecvRow[MPI_NRank];
+
+//    initialize RhoK as zeros for the isolated BC where the zero-padding method is adopted
+      if ( OPT__BC_POT == BC_POT_ISOLATED )
+         for (long t=0; t<FFTW_Pencil_Poi.TotalSize; t++)   RhoK[t] = (real)0.0;
+
+      Patch2Pencil( RhoK, FFTW_Pencil_Poi, &RecvBuf_PIdx, List_PID, List_jk, List_NSendRow, List_NRecvRow,
+                    PrepTime, _TOTAL_DENS, ForPoisson, OPT__GRAVITY_EXTRA_MASS );
+
+      FFT_Pencil( RhoK, Work, Poi_Coeff );
+
+      Pencil2Patch( RhoK, FFTW_Pencil_Poi, RecvBuf_PIdx, List_PID, List_jk, List_NSendRow, List_NRecvRow,
+                    SaveSg, _POTE );
+
+      root_fftw::fft_free( RhoK );
+      root_fftw::fft_free( Work );
+
+      return;
+   } // if ( OPT__FFTW_PENCIL )
+#  endif // # if ( SUPPORT_FFTW == FFTW3 )
+
+
 // determine the FFT size (the zero-padding method is adopted for the isolated BC)
    int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
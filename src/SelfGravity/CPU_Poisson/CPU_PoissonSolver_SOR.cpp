@@ -6,6 +6,7 @@
 
 
 #define POT_NXT_INT  ( (POT_NXT-2)*2    )    // size of the array "Pot_Array_Int"
+#define POT_NXT_HALF ( POT_NXT_INT/2    )    // size of each color of the array "Pot_Half" along x
 #define POT_USELESS  ( POT_GHOST_SIZE%2 )    // # of useless cells in each side of the array "Pot_Array_Int"
 
 
@@ -17,6 +18,11 @@
 //
 // Note        :  1. Reference : Numerical Recipes, Chapter 20.5
 //                2. Typically, the number of iterations required to reach round-off errors is 20 ~ 25 (single precision)
+//                3. Red-black (odd-even) ordering with the odd and even cells along x stored separately
+//                   --> All cells of the same color in a row and all their neighbours are accessed with unit stride,
+//                       so that each row is updated by SIMD instructions
+//                   --> Cells are updated in the same order with the same arithmetic as the strided loop
+//                4. The total residual is evaluated only every SOR_CHECK_INTERVAL iterations
 //
 // Parameter   :  Rho_Array      : Array to store the input density
 //                Pot_Array_In   : Array to store the input "coarse-grid" potential for interpolation
@@ -50,13 +56,18 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
 #  pragma omp parallel
    {
-      int i_start, i_start_pass, i_start_k;     // i_start_(pass,k) : record the i_start in the (pass,k) loop
       int ip, jp, kp, im, jm, km, I, J, K, Ip, Jp, Kp, ii, jj, kk, Iter, x, y, z;
-      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total, Residual;
+      real Slope_x, Slope_y, Slope_z, C2_Slope[13], Residual_Total_Old, Residual_Total;
+      real Residual_Row[POT_NXT_HALF];
 
 //    array to store the interpolated "fine-grid" potential (as the initial guess and the B.C.)
       real (*Pot_Array_Int)[POT_NXT_INT][POT_NXT_INT] = new real [POT_NXT_INT][POT_NXT_INT][POT_NXT_INT];
 
+//    arrays to store the potential and Const*density with the odd and even cells along x separated
+//    --> Pot_Half[k][j][i%2][i/2] = Pot_Array_Int[k][j][i]
+      real (*Pot_Half )[POT_NXT_INT][2][POT_NXT_HALF] = new real [POT_NXT_INT][POT_NXT_INT][2][POT_NXT_HALF];
+      real (*CRho_Half)[POT_NXT_INT][2][POT_NXT_HALF] = new real [POT_NXT_INT][POT_NXT_INT][2][POT_NXT_HALF];
+
 
 //    loop over all patches
 #     pragma omp for schedule( runtime )
@@ -196,75 +207,95 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
 
 
-//       b. use the SOR scheme to evaluate potential (store in the Pot_Array_Int array)
+//       b. use the SOR scheme to evaluate potential (store in the Pot_Half array)
 // ------------------------------------------------------------------------------------------------------------
+//       b1. separate the odd and even cells along x
+         for (int k=0; k<POT_NXT_INT; k++)
+         for (int j=0; j<POT_NXT_INT; j++)
+         for (int i=0; i<POT_NXT_INT; i++)   Pot_Half[k][j][i&1][i>>1] = Pot_Array_Int[k][j][i];
+
+         for (int k=1+POT_USELESS; k<POT_NXT_INT-1-POT_USELESS; k++)    {  kk = k-1-POT_USELESS;
+         for (int j=1+POT_USELESS; j<POT_NXT_INT-1-POT_USELESS; j++)    {  jj = j-1-POT_USELESS;
+         for (int i=1+POT_USELESS; i<POT_NXT_INT-1-POT_USELESS; i++)    {  ii = i-1-POT_USELESS;
+
+            CRho_Half[k][j][i&1][i>>1] = Const*Rho_Array[P][kk][jj][ii];
+
+         }}}
+
+
+//       b2. SOR iterations
          Residual_Total_Old = __FLT_MAX__;
 
          for (Iter=0; Iter<Max_Iter; Iter++)
          {
+            const bool CheckResidual = ( (Iter+1)%SOR_CHECK_INTERVAL == 0 );
+
             Residual_Total = (real)0.0;
-            i_start_pass   = 1 + POT_USELESS;
 
 //          odd-even ordering
             for (int pass=0; pass<2; pass++)
             {
-               i_start_k = i_start_pass;
-
                for (int k=1+POT_USELESS; k<POT_NXT_INT-1-POT_USELESS; k++)
                {
-                  i_start = i_start_k;
-                  kp      = k+1;
-                  km      = k-1;
-                  kk      = k-1-POT_USELESS;
+                  kp = k+1;
+                  km = k-1;
 
                   for (int j=1+POT_USELESS; j<POT_NXT_INT-1-POT_USELESS; j++)
                   {
                      jp = j+1;
                      jm = j-1;
-                     jj = j-1-POT_USELESS;
 
-                     for (int i=i_start; i<POT_NXT_INT-1-POT_USELESS; i+=2)
+//                   target cells in this row are i = 2*n + Color for n0 <= n < n1
+                     const int i_start = 1 + POT_USELESS + ( (k+j+pass)&1 );
+                     const int Color   = i_start & 1;
+                     const int n0      = i_start >> 1;
+                     const int n1      = ( POT_NXT_INT - POT_USELESS - Color )/2;
+
+//                   Pot_X[n] and Pot_X[n-1] are the right and left neighbours of Pot_C[n], respectively
+                           real *Pot_C  = Pot_Half [k ][j ][  Color];
+                     const real *Pot_X  = Pot_Half [k ][j ][1-Color] + Color;
+                     const real *Pot_Yp = Pot_Half [k ][jp][  Color];
+                     const real *Pot_Ym = Pot_Half [k ][jm][  Color];
+                     const real *Pot_Zp = Pot_Half [kp][j ][  Color];
+                     const real *Pot_Zm = Pot_Half [km][j ][  Color];
+                     const real *CRho   = CRho_Half[k ][j ][  Color];
+
+#                    pragma omp simd
+                     for (int n=n0; n<n1; n++)
                      {
-                        ip = i+1;
-                        im = i-1;
-                        ii = i-1-POT_USELESS;
-
 //                      evaluate the residual of potential
-                        Residual = (             Pot_Array_Int[kp][j ][i ] + Pot_Array_Int[km][j ][i ]
-                                     +           Pot_Array_Int[k ][jp][i ] + Pot_Array_Int[k ][jm][i ]
-                                     +           Pot_Array_Int[k ][j ][ip] + Pot_Array_Int[k ][j ][im]
-                                     - (real)6.0*Pot_Array_Int[k ][j ][i ] - Const*Rho_Array[P][kk][jj][ii]  );
+                        const real Residual = (             Pot_Zp[n] + Pot_Zm[n]
+                                                +           Pot_Yp[n] + Pot_Ym[n]
+                                                +           Pot_X [n] + Pot_X [n-1]
+                                                - (real)6.0*Pot_C [n] - CRho  [n]  );
 
 //                      update potential
-                        Pot_Array_Int[k][j][i] += Omega_6*Residual;
-
-//                      sum up the 1-norm of all residuals
-                        Residual_Total += FABS( Residual );
+                        Pot_C[n] += Omega_6*Residual;
 
-                     } // i
+                        Residual_Row[n] = FABS( Residual );
+                     } // n
 
-                     i_start = 3 - i_start + 2*POT_USELESS;
+//                   sum up the 1-norm of all residuals
+                     if ( CheckResidual )
+                        for (int n=n0; n<n1; n++)  Residual_Total += Residual_Row[n];
 
                   } // j
-
-                  i_start_k = 3 - i_start_k + 2*POT_USELESS;
-
                } // k
-
-               i_start_pass = 3 - i_start_pass + 2*POT_USELESS;
-
             } // for (int pass=0; pass<2; pass++)
 
 
 //          terminate the SOR iteration if the total residual begins to grow
 //          we set the minimum number of iterations because usually the total residual will grow at the first step
-            if (  Iter+1 >= Min_Iter  &&  Residual_Total > Residual_Total_Old )
+            if ( CheckResidual )
             {
-               Iter++;
-               break;
-            }
+               if (  Iter+1 >= Min_Iter  &&  Residual_Total > Residual_Total_Old )
+               {
+                  Iter++;
+                  break;
+               }
 
-            Residual_Total_Old = Residual_Total;
+               Residual_Total_Old = Residual_Total;
+            }
 
          } // for (int Iter=0; Iter<Max_Iter; Iter++)
 
@@ -274,13 +305,13 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
                          MPI_Rank, P );
 
 
-//       c. copy data : Pot_Array_Int --> Pot_Array_Out
+//       c. copy data : Pot_Half --> Pot_Array_Out
 // ------------------------------------------------------------------------------------------------------------
          for (int k=0; k<GRA_NXT; k++)    {  K = k + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
          for (int j=0; j<GRA_NXT; j++)    {  J = j + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
          for (int i=0; i<GRA_NXT; i++)    {  I = i + POT_GHOST_SIZE + POT_USELESS - GRA_GHOST_SIZE;
 
-            Pot_Array_Out[P][k][j][i] = Pot_Array_Int[K][J][I];
+            Pot_Array_Out[P][k][j][i] = Pot_Half[K][J][I&1][I>>1];
 
          }}}
 
@@ -288,6 +319,8 @@ void CPU_PoissonSolver_SOR( const real Rho_Array    [][RHO_NXT][RHO_NXT][RHO_NXT
 
 
       delete [] Pot_Array_Int;
+      delete [] Pot_Half;
+      delete [] CRho_Half;
 
    } // OpenMP parallel region
 
@@ -17,12 +17,15 @@ extern Timer_t *Timer_Par_Collect[NLEVEL];
 //
 // Note        :  1. Poisson solver : lv = 0 : invoke CPU_PoissonSolver_FFT()
 //                                    lv > 0 : invoke InvokeSolver()
+//                                             --> invoke Poi_LevelSolver_MG() instead if OPT__POI_LEVEL_MG and
+//                                                 OPT__SELF_GRAVITY are enabled
 //                2. Gravity solver : invoke InvokeSolver()
 //                3. The updated potential and fluid variables will be stored in the same sandglass
-//                4. PotSg at lv=0 will be updated here, but PotSg at at lv>0 and FluSg at lv>=0 will NOT be updated
+//                4. PotSg at lv=0 (and at lv>0 when invoking Poi_LevelSolver_MG()) will be updated here, but PotSg at
+//                   lv>0 with the patch-group Poisson solvers and FluSg at lv>=0 will NOT be updated
 //                   (they will be updated in EvolveLevel instead)
-//                   --> It is because the lv-0 Poisson and Gravity solvers are invoked separately, and Gravity solver
-//                       needs to call Prepare_PatchData to get the updated potential
+//                   --> It is because the lv-0 and level-wide Poisson solvers and the Gravity solver are invoked
+//                       separately, and Gravity solver needs to call Prepare_PatchData to get the updated potential
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -157,6 +160,31 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    } // if ( lv == 0 )
 
 
+// solve the Poisson equation on all patches of a refined level together
+// --> similar to the base-level procedure above except that OPT__SELF_GRAVITY must be on
+   else if ( UsePot  &&  OPT__SELF_GRAVITY  &&  OPT__POI_LEVEL_MG )
+   {
+      TIMING_FUNC(   Poi_LevelSolver_MG( lv, TimeNew, Poi_Coeff, SaveSg_Pot ),
+                     Timer_Gra_Advance[lv],   Timing   );
+
+      amr->PotSg    [lv]             = SaveSg_Pot;
+      amr->PotSgTime[lv][SaveSg_Pot] = TimeNew;
+
+      TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON, _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
+                     Timer_GetBuf[lv][1],   Timing   );
+
+#     ifdef STORE_POT_GHOST
+      TIMING_FUNC(   Poi_StorePotWithGhostZone( lv, SaveSg_Pot, true ),
+                     Timer_Gra_Advance[lv],   Timing   );
+#     endif
+
+      if ( Gravity )
+      TIMING_FUNC(   InvokeSolver( GRAVITY_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, NULL_INT, NULL_INT,
+                                   OverlapMPI, Overlap_Sync ),
+                     Timer_Gra_Advance[lv],   Timing   );
+   } // else if ( UsePot  &&  OPT__SELF_GRAVITY  &&  OPT__POI_LEVEL_MG )
+
+
    else // lv > 0
    {
       if      (  Poisson  &&  !Gravity )
@@ -3,6 +3,9 @@
 #if ( defined GRAVITY  &&  defined SUPPORT_FFTW )
 
 extern root_fftw::real_plan_nd     FFTW_Plan_Poi;
+#if ( SUPPORT_FFTW == FFTW3 )
+extern FFTW_Pencil_t               FFTW_Pencil_Poi;
+#endif
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_GreenFuncK
@@ -11,6 +14,8 @@ extern root_fftw::real_plan_nd     FFTW_Plan_Poi;
 // Note        :  1. We only need to calculate it once during the initialization stage
 //                2. The zero-padding method is implemented
 //                3. Slab decomposition is assumed in FFTW
+//                   --> Pencil decomposition for OPT__FFTW_PENCIL, where GreenFuncK[] is stored in the z-pencil
+//                       layout (see FFTW_Pencil_t)
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -25,8 +30,56 @@ void Init_GreenFuncK()
       Aux_Message( stderr, "OPT__BC_POT != BC_POT_ISOLATED, why do you need to calculate the Green's function !?\n" );
 
 
+   const int    FFT_Size[3] = { 2*NX0_TOT[0], 2*NX0_TOT[1], 2*NX0_TOT[2] };
+   const double dh0         = amr->dh[0];
+   const double Coeff       = -NEWTON_G*CUBE(dh0)/( (double)FFT_Size[0]*FFT_Size[1]*FFT_Size[2] );
+
+
+// pencil decomposition
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_PENCIL )
+   {
+      const FFTW_Pencil_t &P = FFTW_Pencil_Poi;
+
+      const int j_start  = P.Y_Start[ P.Coord[0] ];
+      const int k_start  = P.Z_Start[ P.Coord[1] ];
+      const int local_ny = P.Y_Start[ P.Coord[0]+1 ] - j_start;
+      const int local_nz = P.Z_Start[ P.Coord[1]+1 ] - k_start;
+      const int local_nx = 2*P.NxC;
+
+      GreenFuncK = (real*) root_fftw::fft_malloc( sizeof(real)*P.TotalSize );
+      real *Work = (real*) root_fftw::fft_malloc( sizeof(real)*P.TotalSize );
+
+//    calculate the Green's function in the real space (x-pencil layout)
+      for (int k=0; k<local_nz; k++)   {  const int    kk = k + k_start;
+                                          const double z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
+      for (int j=0; j<local_ny; j++)   {  const int    jj = j + j_start;
+                                          const double y  = ( jj <= NX0_TOT[1] ) ? jj*dh0 : (FFT_Size[1]-jj)*dh0;
+      for (int i=0; i<local_nx; i++)   {  const double x  = ( i  <= NX0_TOT[0] ) ? i *dh0 : (FFT_Size[0]-i )*dh0;
+
+         const double r   = sqrt( x*x + y*y + z*z );
+         const long   idx = ( (long)k*local_ny + j )*local_nx + i;
+
+         GreenFuncK[idx] = real( Coeff / r );
+
+      }}}
+
+//    reset the Green's function at the origin
+      if ( j_start == 0  &&  k_start == 0  &&  local_ny > 0  &&  local_nz > 0 )   GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
+
+//    convert the Green's function to the k space
+      FFTW_Pencil_Forward( P, GreenFuncK, Work );
+
+      root_fftw::fft_free( Work );
+
+      if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+      return;
+   } // if ( OPT__FFTW_PENCIL )
+#  endif // # if ( SUPPORT_FFTW == FFTW3 )
+
+
 // 1. get the array indices used by FFTW
-   const int FFT_Size[3] = { 2*NX0_TOT[0], 2*NX0_TOT[1], 2*NX0_TOT[2] };
    mpi_index_int local_nx, local_ny, local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
 
 // note: total_local_size is NOT necessarily equal to local_nx*local_ny*local_nz
@@ -63,8 +116,6 @@ void Init_GreenFuncK()
 
 
 // 2. calculate the Green's function in the real space
-   const double dh0   = amr->dh[0];
-   const double Coeff = -NEWTON_G*CUBE(dh0)/( (double)FFT_Size[0]*FFT_Size[1]*FFT_Size[2] );
    double x, y, z, r;
    int    kk;
    long   idx;
@@ -0,0 +1,682 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+
+#define MAX_NLV         10    // maximum number of multigrid levels
+#define NBOTTOM_SMOOTH  8     // number of smoothing steps at the bottom level
+                              // --> the bottom-level problem still spans all patches on a level, and the patch-level
+                              //     smoother only propagates information by one patch per step
+
+static void ExchangeSol( const int lv, const int SaveSg, const int NReal, const int NGrid, const real *Sol );
+static void ResetSol( const int lv, const int SaveSg );
+static void GetSolWithGhost( const int lv, const int SaveSg, const int PID, const int NGrid, const real *Sol,
+                             const real *BC, real *Sol_G );
+static void Smoothing( const int lv, const int SaveSg, const int NReal, const int NGrid, const real dh,
+                       real *Sol, const real *RHS, const real *BC );
+static void ComputeDefect( const int lv, const int SaveSg, const int NReal, const int NGrid, const real dh,
+                           const real *Sol, const real *RHS, real *Def, const real *BC, const bool EstimateError,
+                           real &Error );
+static void Restrict( const int NReal, const int NGrid_F, const real *FData, real *CData );
+static void Prolongate_and_Correct( const int lv, const int SaveSg, const int NReal, const int NGrid_C,
+                                    const real *CData, real *FData );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_LevelSolver_MG
+// Description :  Solve the Poisson equation on all patches of a refined level simultaneously using the
+//                geometric multigrid scheme
+//
+// Note        :  1. Invoked by Gra_AdvanceDt() when OPT__POI_LEVEL_MG is enabled
+//                   --> Replace the independent patch-group solves of InvokeSolver( POISSON_SOLVER, ... ) so
+//                       that the solution is consistent across patch groups and MPI ranks
+//                2. All real patches at lv form a single composite grid
+//                   --> Multigrid levels coarsen each patch by a factor of 2 until it cannot be halved further
+//                       (e.g., 8^3 -> 4^3 -> 2^3 -> 1^3 cells per patch for PATCH_SIZE == 8)
+//                   --> Each smoothing step updates every patch with the red-black Gauss-Seidel method and fixed
+//                       ghost zones
+//                3. Ghost zones are exchanged by Buf_GetBufferData( POT_FOR_POISSON ) with ParaBuf = 1 using
+//                   patch->pot[SaveSg][] as the communication buffer
+//                   --> Only the face cells read by the sibling patches are copied to patch->pot[]
+//                   --> On the intermediate multigrid levels, exchange only once before all pre-smoothing steps
+//                       and once before all post-smoothing steps, so that the steps of a V-cycle leg share the same
+//                       ghost zones
+//                       --> The finest and the bottom levels still exchange before every smoothing step since
+//                           lagging their ghost zones slows down the convergence considerably
+//                   --> Corrections initialized to zero on the coarser multigrid levels need no exchange
+//                       (see ResetSol())
+//                4. The coarse-fine boundary conditions and the initial guess are interpolated from the lv-1
+//                   potential prepared by Poi_Prepare_Pot(), the same as the patch-group solvers
+//                   --> Corrections vanish on these boundaries on all coarser multigrid levels
+//                5. Stop when the error estimated as in CPU_PoissonSolver_MG() drops below POI_LEVEL_MG_TOLERATED_ERROR,
+//                   when it stops decreasing, or after POI_LEVEL_MG_MAX_ITER V-cycles
+//                6. External potential is added to the output potential if OPT__EXT_POT is enabled
+//                7. Potential in the buffer patches is NOT updated here
+//
+// Parameter   :  lv        : Target refinement level (>0)
+//                PrepTime  : Target physical time to prepare the density and the coarse-grid potential
+//                Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
+//                SaveSg    : Sandglass to store the updated potential
+//
+// Return      :  amr->patch->pot[SaveSg] of all real patches at lv
+//-------------------------------------------------------------------------------------------------------
+void Poi_LevelSolver_MG( const int lv, const double PrepTime, const real Poi_Coeff, const int SaveSg )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( lv == 0 )    Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
+
+   if ( SaveSg != 0  &&  SaveSg != 1 )
+      Aux_Error( ERROR_INFO, "incorrect SaveSg (%d) !!\n", SaveSg );
+
+   if ( !OPT__SELF_GRAVITY )
+      Aux_Error( ERROR_INFO, "OPT__SELF_GRAVITY must be enabled for %s !!\n", __FUNCTION__ );
+#  endif
+
+
+// nothing to do if there is no patch on this level
+// --> NPatchTotal[] is the same for all ranks so that all ranks return together
+   if ( NPatchTotal[lv] == 0 )   return;
+
+
+   const int  NReal = amr->NPatchComma[lv][1];
+   const int  NPG   = NReal/8;
+   const long PS1Sq = SQR( PS1 );
+
+
+// set the depth of the multigrid V-cycle
+   int  NLv=1, NGrid[MAX_NLV];
+   real dh[MAX_NLV];
+
+   NGrid[0] = PS1;
+   dh   [0] = amr->dh[lv];
+
+   while ( NGrid[NLv-1]%2 == 0  &&  NLv < MAX_NLV )
+   {
+      NGrid[NLv] = NGrid[NLv-1]/2;
+      dh   [NLv] = (real)2.0*dh[NLv-1];
+      NLv ++;
+   }
+
+   const int BottomLv = NLv - 1;
+
+
+// allocate memory
+   real *Sol[MAX_NLV], *RHS[MAX_NLV];
+
+   for (int Lv=0; Lv<NLv; Lv++)
+   {
+      Sol[Lv] = new real [ (long)NReal*CUBE(NGrid[Lv]) ];
+      RHS[Lv] = new real [ (long)NReal*CUBE(NGrid[Lv]) ];
+   }
+
+   real *Def       = new real [ (long)NReal*CUBE(PS1) ];
+   real *BC        = new real [ (long)NReal*6*PS1Sq ];
+   int  *PID0_List = new int  [ NPG ];
+
+   for (int TID=0; TID<NPG; TID++)  PID0_List[TID] = 8*TID;
+
+
+// 1. prepare the RHS at the finest multigrid level
+// ------------------------------------------------------------------------------------------------------------
+   Poi_Prepare_Rho( lv, PrepTime, RHS[0], 0, NPG, PID0_List );
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<(long)NReal*CUBE(PS1); t++)    RHS[0][t] *= Poi_Coeff;
+
+
+// 2. interpolate the lv-1 potential to get the initial guess and the coarse-fine boundary conditions
+// ------------------------------------------------------------------------------------------------------------
+// interpolate one coarse cell beyond the patch on each side to get one fine ghost cell
+   const int  CGhost                = (POT_GHOST_SIZE+1)/2 + 1;
+   const int  CSize[3]              = { POT_NXT, POT_NXT, POT_NXT };
+   const int  CStart[3]             = { CGhost-1, CGhost-1, CGhost-1 };
+   const int  CRange[3]             = { PS1/2+2, PS1/2+2, PS1/2+2 };
+   const int  FN                    = PS1 + 4;
+   const int  FSize[3]              = { FN, FN, FN };
+   const int  FStart[3]             = { 0, 0, 0 };
+   const bool PhaseUnwrapping_No    = false;
+   const bool Monotonicity_No       = false;
+   const bool IntOppSign0thOrder_No = false;
+   const int  NPG_Max               = ( POT_GPU_NPGROUP > 0 ) ? POT_GPU_NPGROUP : MAX( NPG, 1 );
+
+   real (*Pot_In)[POT_NXT][POT_NXT][POT_NXT] = new real [ 8*NPG_Max ][POT_NXT][POT_NXT][POT_NXT];
+
+   for (int PG_Start=0; PG_Start<NPG; PG_Start+=NPG_Max)
+   {
+      const int NPG_Now = MIN( NPG_Max, NPG-PG_Start );
+
+      Poi_Prepare_Pot( lv, PrepTime, Pot_In, NPG_Now, PID0_List+PG_Start );
+
+#     pragma omp parallel
+      {
+         real *FPot = new real [ CUBE(FN) ];
+         int   Idx[3];
+
+#        pragma omp for schedule( runtime )
+         for (int P=0; P<8*NPG_Now; P++)
+         {
+            const int PID = 8*PG_Start + P;
+
+            Interpolate( &Pot_In[P][0][0][0], CSize, CStart, CRange, FPot, FSize, FStart, 1, OPT__POT_INT_SCHEME,
+                         PhaseUnwrapping_No, &Monotonicity_No, IntOppSign0thOrder_No, ALL_CONS_NO, INT_PRIM_NO,
+                         INT_FIX_MONO_COEFF, NULL, NULL );
+
+//          initial guess
+            real *SolPtr = Sol[0] + (long)PID*CUBE(PS1);
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+               SolPtr[ (k*PS1 + j)*PS1 + i ] = FPot[ ( (k+2)*FN + (j+2) )*FN + (i+2) ];
+
+//          boundary conditions on the six faces
+//          --> BC[PID][s][q][p], where p/q are the cell indices along the directions (d+1)%3/(d+2)%3
+            for (int s=0; s<6; s++)
+            {
+               const int d  = s/2;
+               const int d1 = (d+1)%3;
+               const int d2 = (d+2)%3;
+
+               Idx[d] = ( s%2 == 0 ) ? 1 : PS1+2;
+
+               for (int q=0; q<PS1; q++)  {  Idx[d2] = q + 2;
+               for (int p=0; p<PS1; p++)  {  Idx[d1] = p + 2;
+                  BC[ (long)PID*6*PS1Sq + s*PS1Sq + q*PS1 + p ] = FPot[ ( Idx[2]*FN + Idx[1] )*FN + Idx[0] ];
+               }}
+            }
+         } // for (int P=0; P<8*NPG_Now; P++)
+
+         delete [] FPot;
+      } // OpenMP parallel region
+   } // for (int PG_Start=0; PG_Start<NPG; PG_Start+=NPG_Max)
+
+   delete [] Pot_In;
+
+
+// 3. multigrid V-cycles
+// ------------------------------------------------------------------------------------------------------------
+   int  Iter       = 0;
+   real Error      = __FLT_MAX__;
+   real Error_Prev = __FLT_MAX__;
+   bool Sync       = false;   // whether the ghost zones in patch->pot[] match the solution to be smoothed next
+
+   while ( Iter < POI_LEVEL_MG_MAX_ITER  &&  Error > POI_LEVEL_MG_TOLERATED_ERROR )
+   {
+//    V-cycle : finer --> coarser grids
+      for (int Lv=0; Lv<BottomLv; Lv++)
+      {
+//       pre-smoothing
+//       --> exchange the ghost zones only once for all steps except on the finest multigrid level
+         for (int PreStep=0; PreStep<POI_LEVEL_MG_NPRE_SMOOTH; PreStep++)
+         {
+            if ( !Sync  &&  ( PreStep == 0  ||  Lv == 0 ) )
+               ExchangeSol( lv, SaveSg, NReal, NGrid[Lv], Sol[Lv] );
+
+            Smoothing( lv, SaveSg, NReal, NGrid[Lv], dh[Lv], Sol[Lv], RHS[Lv], (Lv==0)?BC:NULL );
+            Sync = false;
+         }
+
+//       compute defect and restrict it as the RHS at the next level
+         if ( !Sync )   ExchangeSol( lv, SaveSg, NReal, NGrid[Lv], Sol[Lv] );
+         ComputeDefect( lv, SaveSg, NReal, NGrid[Lv], dh[Lv], Sol[Lv], RHS[Lv], Def, (Lv==0)?BC:NULL, false, Error );
+         Restrict( NReal, NGrid[Lv], Def, RHS[Lv+1] );
+
+//       initialize the correction at the next level to zero
+         for (long t=0; t<(long)NReal*CUBE(NGrid[Lv+1]); t++)  Sol[Lv+1][t] = (real)0.0;
+
+         ResetSol( lv, SaveSg );
+         Sync = true;
+      }
+
+
+//    smooth the correction at the bottom level
+      for (int BottomStep=0; BottomStep<NBOTTOM_SMOOTH; BottomStep++)
+      {
+         if ( !Sync )   ExchangeSol( lv, SaveSg, NReal, NGrid[BottomLv], Sol[BottomLv] );
+         Smoothing( lv, SaveSg, NReal, NGrid[BottomLv], dh[BottomLv], Sol[BottomLv], RHS[BottomLv],
+                    (BottomLv==0)?BC:NULL );
+         Sync = false;
+      }
+
+
+//    V-cycle : coarser --> finer grids
+      for (int Lv=BottomLv-1; Lv>=0; Lv--)
+      {
+//       prolongate correction (from Lv+1 to Lv) and correct solution/correction at Lv
+         ExchangeSol( lv, SaveSg, NReal, NGrid[Lv+1], Sol[Lv+1] );
+         Prolongate_and_Correct( lv, SaveSg, NReal, NGrid[Lv+1], Sol[Lv+1], Sol[Lv] );
+
+//       post-smoothing
+//       --> exchange the ghost zones only once for all steps except on the finest multigrid level
+         for (int PostStep=0; PostStep<POI_LEVEL_MG_NPOST_SMOOTH; PostStep++)
+         {
+            if ( PostStep == 0  ||  Lv == 0 )
+               ExchangeSol( lv, SaveSg, NReal, NGrid[Lv], Sol[Lv] );
+
+            Smoothing( lv, SaveSg, NReal, NGrid[Lv], dh[Lv], Sol[Lv], RHS[Lv], (Lv==0)?BC:NULL );
+         }
+
+         Sync = false;
+      }
+
+
+//    estimate error
+      ExchangeSol( lv, SaveSg, NReal, NGrid[0], Sol[0] );
+      ComputeDefect( lv, SaveSg, NReal, NGrid[0], dh[0], Sol[0], RHS[0], Def, BC, true, Error );
+      Sync = true;
+      Iter ++;
+
+//    stop if the error no longer decreases (e.g., when reaching the round-off level)
+      if ( Error >= Error_Prev )   break;
+
+      Error_Prev = Error;
+   } // while ( Iter < POI_LEVEL_MG_MAX_ITER  &&  Error > POI_LEVEL_MG_TOLERATED_ERROR )
+
+
+   if ( Error > POI_LEVEL_MG_TOLERATED_ERROR  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : lv %d exceeds the maximum tolerated error in %s (error = %13.7e, iter = %d) !!\n",
+                   lv, __FUNCTION__, Error, Iter );
+
+
+// 4. store the solution (plus the external potential)
+// ------------------------------------------------------------------------------------------------------------
+   const double dh_2 = 0.5*amr->dh[lv];
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real  *SolPtr = Sol[0] + (long)PID*CUBE(PS1);
+      const double x0     = amr->patch[0][lv][PID]->EdgeL[0] + dh_2;
+      const double y0     = amr->patch[0][lv][PID]->EdgeL[1] + dh_2;
+      const double z0     = amr->patch[0][lv][PID]->EdgeL[2] + dh_2;
+
+      for (int k=0; k<PS1; k++)  {  const double z = z0 + k*amr->dh[lv];
+      for (int j=0; j<PS1; j++)  {  const double y = y0 + j*amr->dh[lv];
+      for (int i=0; i<PS1; i++)  {  const double x = x0 + i*amr->dh[lv];
+
+         real Pot = SolPtr[ (k*PS1 + j)*PS1 + i ];
+
+         if ( OPT__EXT_POT )
+            Pot += CPUExtPot_Ptr( x, y, z, PrepTime, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                  EXT_POT_USAGE_ADD, h_ExtPotTable, h_ExtPotGenePtr );
+
+         amr->patch[SaveSg][lv][PID]->pot[k][j][i] = Pot;
+      }}}
+   }
+
+
+// free memory
+   for (int Lv=0; Lv<NLv; Lv++)
+   {
+      delete [] Sol[Lv];
+      delete [] RHS[Lv];
+   }
+   delete [] Def;
+   delete [] BC;
+   delete [] PID0_List;
+
+} // FUNCTION : Poi_LevelSolver_MG
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ExchangeSol
+// Description :  Copy the face cells of the solution of all real patches to patch->pot[] and fill the potential
+//                of the sibling buffer patches
+//
+// Note        :  1. Coarse-grid data are stored as piecewise-constant blocks of (PS1/NGrid)^3 cells
+//                   --> Only the first cell of each block on the six patch faces is set, which are the only cells
+//                       read by GetSolWithGhost()
+//                   --> Other cells in patch->pot[] are left unchanged
+//                   --> The cells adjacent to each patch face always belong to the coarse cells adjacent to
+//                       that face, so exchanging a single layer of cells is sufficient for all multigrid levels
+//                2. Must be called by all ranks
+//
+// Parameter   :  lv     : Target refinement level
+//                SaveSg : Sandglass of patch->pot[] used as the communication buffer
+//                NReal  : Number of real patches at lv
+//                NGrid  : Number of cells in each spatial direction of each patch at the target multigrid level
+//                Sol    : Solution array to be copied
+//-------------------------------------------------------------------------------------------------------
+void ExchangeSol( const int lv, const int SaveSg, const int NReal, const int NGrid, const real *Sol )
+{
+
+   const int Scale = PS1/NGrid;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *SolPtr = Sol + (long)PID*CUBE(NGrid);
+      real (*Pot)[PS1][PS1] = amr->patch[SaveSg][lv][PID]->pot;
+
+      int Idx[3], CIdx[3];
+
+      for (int s=0; s<6; s++)
+      {
+         const int d  = s/2;
+         const int d1 = (d+1)%3;
+         const int d2 = (d+2)%3;
+
+         Idx [d] = ( s%2 == 0 ) ? 0 : PS1-1;
+         CIdx[d] = ( s%2 == 0 ) ? 0 : NGrid-1;
+
+         for (int q=0; q<NGrid; q++)  {  Idx[d2] = q*Scale;  CIdx[d2] = q;
+         for (int p=0; p<NGrid; p++)  {  Idx[d1] = p*Scale;  CIdx[d1] = p;
+            Pot[ Idx[2] ][ Idx[1] ][ Idx[0] ] = SolPtr[ ( CIdx[2]*NGrid + CIdx[1] )*NGrid + CIdx[0] ];
+         }}
+      }
+   }
+
+   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg, POT_FOR_POISSON, _POTE, _NONE, 1, USELB_YES );
+
+} // FUNCTION : ExchangeSol
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ResetSol
+// Description :  Set patch->pot[] of all real and buffer patches to zero
+//
+// Note        :  1. Equivalent to ExchangeSol() for a solution that is zero everywhere (e.g., the initial
+//                   corrections on the coarser multigrid levels) but does not require any MPI communication
+//                2. Work on all patches at lv so that each rank can call it independently
+//
+// Parameter   :  lv     : Target refinement level
+//                SaveSg : Sandglass of patch->pot[] used as the communication buffer
+//-------------------------------------------------------------------------------------------------------
+void ResetSol( const int lv, const int SaveSg )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->num[lv]; PID++)
+   {
+      real (*Pot)[PS1][PS1] = amr->patch[SaveSg][lv][PID]->pot;
+
+//    skip buffer patches without potential data, which are not used by GetSolWithGhost()
+      if ( Pot != NULL )   memset( Pot, 0, CUBE(PS1)*sizeof(real) );
+   }
+
+} // FUNCTION : ResetSol
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetSolWithGhost
+// Description :  Copy the solution of a single patch to an array with one ghost cell on each side
+//
+// Note        :  1. Ghost cells are taken from the sibling patches at lv (which must have been filled by
+//                   ExchangeSol()) or from the Dirichlet boundary conditions BC[] if the sibling patch does
+//                   not exist
+//                2. Ghost cells are set to zero if the sibling patch does not exist and BC == NULL
+//                   --> For the corrections on the coarser multigrid levels
+//                3. Edge and corner ghost cells are not set since they are useless for the 7-point stencil
+//
+// Parameter   :  lv     : Target refinement level
+//                SaveSg : Sandglass of patch->pot[] storing the exchanged solution
+//                PID    : Target patch index
+//                NGrid  : Number of cells in each spatial direction of each patch at the target multigrid level
+//                Sol    : Solution array of all patches
+//                BC     : Boundary conditions on the finest multigrid level (or NULL)
+//                Sol_G  : Output array with the size (NGrid+2)^3
+//-------------------------------------------------------------------------------------------------------
+void GetSolWithGhost( const int lv, const int SaveSg, const int PID, const int NGrid, const real *Sol,
+                      const real *BC, real *Sol_G )
+{
+
+   const int   NG     = NGrid + 2;
+   const int   Scale  = PS1/NGrid;
+   const real *SolPtr = Sol + (long)PID*CUBE(NGrid);
+
+   int Idx[3], FIdx[3];
+
+   for (int k=0; k<NGrid; k++)
+   for (int j=0; j<NGrid; j++)
+   for (int i=0; i<NGrid; i++)
+      Sol_G[ ( (k+1)*NG + (j+1) )*NG + (i+1) ] = SolPtr[ (k*NGrid + j)*NGrid + i ];
+
+   for (int s=0; s<6; s++)
+   {
+      const int d      = s/2;
+      const int d1     = (d+1)%3;
+      const int d2     = (d+2)%3;
+      const int SibPID = amr->patch[0][lv][PID]->sibling[s];
+
+      Idx [d] = ( s%2 == 0 ) ? 0     : NGrid+1;
+      FIdx[d] = ( s%2 == 0 ) ? PS1-1 : 0;
+
+      for (int q=0; q<NGrid; q++)  {  Idx[d2] = q + 1;  FIdx[d2] = q*Scale;
+      for (int p=0; p<NGrid; p++)  {  Idx[d1] = p + 1;  FIdx[d1] = p*Scale;
+
+         real Ghost;
+
+         if      ( SibPID >= 0 )   Ghost = amr->patch[SaveSg][lv][SibPID]->pot[ FIdx[2] ][ FIdx[1] ][ FIdx[0] ];
+         else if ( BC != NULL )    Ghost = BC[ (long)PID*6*SQR(PS1) + s*SQR(PS1) + q*PS1 + p ];
+         else                      Ghost = (real)0.0;
+
+         Sol_G[ ( Idx[2]*NG + Idx[1] )*NG + Idx[0] ] = Ghost;
+      }}
+   } // for (int s=0; s<6; s++)
+
+} // FUNCTION : GetSolWithGhost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Smoothing
+// Description :  Apply one red-black Gauss-Seidel sweep to every real patch with fixed ghost zones
+//
+// Note        :  Ghost zones of Sol[] must have been exchanged by ExchangeSol()
+//
+// Parameter   :  lv     : Target refinement level
+//                SaveSg : Sandglass of patch->pot[] storing the exchanged solution
+//                NReal  : Number of real patches at lv
+//                NGrid  : Number of cells in each spatial direction of each patch at the target multigrid level
+//                dh     : Cell size at the target multigrid level
+//                Sol    : Solution array to be updated
+//                RHS    : RHS of the Poisson equation
+//                BC     : Boundary conditions on the finest multigrid level (or NULL)
+//-------------------------------------------------------------------------------------------------------
+void Smoothing( const int lv, const int SaveSg, const int NReal, const int NGrid, const real dh,
+                real *Sol, const real *RHS, const real *BC )
+{
+
+   const int  NG      = NGrid + 2;
+   const real dh2     = dh*dh;
+   const real One_Six = (real)1.0/(real)6.0;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+            real  Sol_G[ CUBE(PS1+2) ];
+            real *SolPtr = Sol + (long)PID*CUBE(NGrid);
+      const real *RHSPtr = RHS + (long)PID*CUBE(NGrid);
+
+      GetSolWithGhost( lv, SaveSg, PID, NGrid, Sol, BC, Sol_G );
+
+//    odd-even ordering
+      for (int pass=0; pass<2; pass++)
+      for (int k=1; k<=NGrid; k++)
+      for (int j=1; j<=NGrid; j++)
+      for (int i=1+((k+j+pass)&1); i<=NGrid; i+=2)
+      {
+         const int t = ( k*NG + j )*NG + i;
+
+         Sol_G[t] = One_Six*(   Sol_G[t+NG*NG] + Sol_G[t-NG*NG] + Sol_G[t+NG] + Sol_G[t-NG]
+                              + Sol_G[t+1    ] + Sol_G[t-1    ] - dh2*RHSPtr[ ( (k-1)*NGrid + (j-1) )*NGrid + (i-1) ]  );
+      }
+
+      for (int k=0; k<NGrid; k++)
+      for (int j=0; j<NGrid; j++)
+      for (int i=0; i<NGrid; i++)
+         SolPtr[ (k*NGrid + j)*NGrid + i ] = Sol_G[ ( (k+1)*NG + (j+1) )*NG + (i+1) ];
+   } // for (int PID=0; PID<NReal; PID++)
+
+} // FUNCTION : Smoothing
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ComputeDefect
+// Description :  Compute the negative defect "-(Laplacian(Sol)-RHS)" of every real patch
+//
+// Note        :  1. Ghost zones of Sol[] must have been exchanged by ExchangeSol()
+//                2. Error is estimated in the same way as CPU_PoissonSolver_MG() but summed over all patches
+//                   of all ranks
+//                   --> All ranks must call this function together when EstimateError is on
+//
+// Parameter   :  lv            : Target refinement level
+//                SaveSg        : Sandglass of patch->pot[] storing the exchanged solution
+//                NReal         : Number of real patches at lv
+//                NGrid         : Number of cells in each spatial direction of each patch at the target multigrid level
+//                dh            : Cell size at the target multigrid level
+//                Sol           : Solution array
+//                RHS           : RHS of the Poisson equation
+//                Def           : Output defect array
+//                BC            : Boundary conditions on the finest multigrid level (or NULL)
+//                EstimateError : Estimate the L1 error
+//                Error         : L1 error to be returned
+//-------------------------------------------------------------------------------------------------------
+void ComputeDefect( const int lv, const int SaveSg, const int NReal, const int NGrid, const real dh,
+                    const real *Sol, const real *RHS, real *Def, const real *BC, const bool EstimateError,
+                    real &Error )
+{
+
+   const int  NG   = NGrid + 2;
+   const real _dh2 = (real)-1.0/(dh*dh);
+
+   double SumDef = 0.0, SumSol = 0.0;
+
+#  pragma omp parallel for schedule( runtime ) reduction( +:SumDef, SumSol )
+   for (int PID=0; PID<NReal; PID++)
+   {
+            real  Sol_G[ CUBE(PS1+2) ];
+      const real *RHSPtr = RHS + (long)PID*CUBE(NGrid);
+            real *DefPtr = Def + (long)PID*CUBE(NGrid);
+
+      GetSolWithGhost( lv, SaveSg, PID, NGrid, Sol, BC, Sol_G );
+
+      for (int k=1; k<=NGrid; k++)
+      for (int j=1; j<=NGrid; j++)
+      for (int i=1; i<=NGrid; i++)
+      {
+         const int t = ( k*NG + j )*NG + i;
+         const int n = ( (k-1)*NGrid + (j-1) )*NGrid + (i-1);
+
+         DefPtr[n] = _dh2*(   Sol_G[t+NG*NG] + Sol_G[t-NG*NG] + Sol_G[t+NG] + Sol_G[t-NG]
+                            + Sol_G[t+1    ] + Sol_G[t-1    ] - (real)6.0*Sol_G[t]  ) + RHSPtr[n];
+
+         if ( EstimateError )
+         {
+            SumDef += FABS( DefPtr[n] );
+            SumSol += FABS( Sol_G[t] );
+         }
+      }
+   } // for (int PID=0; PID<NReal; PID++)
+
+
+// estimate the L1 error over all ranks
+   if ( EstimateError )
+   {
+      double SumDefSol[2] = { SumDef, SumSol }, SumDefSol_AllRank[2];
+
+      MPI_Allreduce( SumDefSol, SumDefSol_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      Error = ( SumDefSol_AllRank[1] > 0.0 ) ? real( dh*dh*SumDefSol_AllRank[0]/SumDefSol_AllRank[1] ) : (real)0.0;
+   }
+
+} // FUNCTION : ComputeDefect
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Restrict
+// Description :  Restrict the fine-grid data of every real patch by averaging over 2^3 cells
+//
+// Parameter   :  NReal   : Number of real patches at lv
+//                NGrid_F : Number of fine-grid cells in each spatial direction of each patch
+//                FData   : Input fine-grid array
+//                CData   : Output coarse-grid array
+//-------------------------------------------------------------------------------------------------------
+void Restrict( const int NReal, const int NGrid_F, const real *FData, real *CData )
+{
+
+   const int  NGrid_C = NGrid_F/2;
+   const real Const_8 = (real)1.0/(real)8.0;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *FPtr = FData + (long)PID*CUBE(NGrid_F);
+            real *CPtr = CData + (long)PID*CUBE(NGrid_C);
+
+      for (int k=0; k<NGrid_C; k++)  {  const int K = 2*k;
+      for (int j=0; j<NGrid_C; j++)  {  const int J = 2*j;
+      for (int i=0; i<NGrid_C; i++)  {  const int I = 2*i;
+
+         real Sum = (real)0.0;
+
+         for (int dk=0; dk<2; dk++)
+         for (int dj=0; dj<2; dj++)
+         for (int di=0; di<2; di++)
+            Sum += FPtr[ ( (K+dk)*NGrid_F + (J+dj) )*NGrid_F + (I+di) ];
+
+         CPtr[ (k*NGrid_C + j)*NGrid_C + i ] = Const_8*Sum;
+      }}}
+   }
+
+} // FUNCTION : Restrict
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prolongate_and_Correct
+// Description :  Prolongate the coarse-grid correction of every real patch and add it to the fine-grid data
+//
+// Note        :  1. Ghost zones of CData[] must have been exchanged by ExchangeSol()
+//                2. Use linear interpolation along each direction, which only requires the face ghost cells:
+//                      F = C + 1/4*[ (C_x-C) + (C_y-C) + (C_z-C) ],
+//                   where C_x/y/z are the coarse-grid neighbours on the same side as the fine cell
+//
+// Parameter   :  lv      : Target refinement level
+//                SaveSg  : Sandglass of patch->pot[] storing the exchanged correction
+//                NReal   : Number of real patches at lv
+//                NGrid_C : Number of coarse-grid cells in each spatial direction of each patch
+//                CData   : Input coarse-grid correction
+//                FData   : Fine-grid array to be corrected
+//-------------------------------------------------------------------------------------------------------
+void Prolongate_and_Correct( const int lv, const int SaveSg, const int NReal, const int NGrid_C,
+                             const real *CData, real *FData )
+{
+
+   const int  NGrid_F = 2*NGrid_C;
+   const int  NG      = NGrid_C + 2;
+   const real Const_4 = (real)1.0/(real)4.0;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      real  C_G[ CUBE(PS1+2) ];
+      real *FPtr = FData + (long)PID*CUBE(NGrid_F);
+
+      GetSolWithGhost( lv, SaveSg, PID, NGrid_C, CData, NULL, C_G );
+
+      for (int k=0; k<NGrid_F; k++)  {  const int K = k/2 + 1;  const int sk = ( k%2 == 0 ) ? -NG*NG : +NG*NG;
+      for (int j=0; j<NGrid_F; j++)  {  const int J = j/2 + 1;  const int sj = ( j%2 == 0 ) ? -NG    : +NG;
+      for (int i=0; i<NGrid_F; i++)  {  const int I = i/2 + 1;  const int si = ( i%2 == 0 ) ? -1     : +1;
+
+         const int t = ( K*NG + J )*NG + I;
+
+         FPtr[ (k*NGrid_F + j)*NGrid_F + i ] += Const_4*( C_G[t] + C_G[t+si] + C_G[t+sj] + C_G[t+sk] );
+      }}}
+   }
+
+} // FUNCTION : Prolongate_and_Correct
+
+
+
+#endif // #ifdef GRAVITY
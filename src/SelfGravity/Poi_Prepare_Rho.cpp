@@ -11,6 +11,8 @@
 //
 // Note        :  1. Invoke Prepare_PatchData()
 //                2. Minimum density threshold (MIN_DENS) is applied
+//                3. Prepare RHO_GHOST_SIZE ghost zones on each side
+//                   --> Use the overloaded version below to specify a different number of ghost zones
 //
 // Parameter   :  lv            : Target refinement level
 //                PrepTime      : Target physical time to prepare the coarse-grid data
@@ -22,6 +24,31 @@ void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][
                       const int NPG, const int *PID0_List )
 {
 
+   Poi_Prepare_Rho( lv, PrepTime, &h_Rho_Array_P[0][0][0][0], RHO_GHOST_SIZE, NPG, PID0_List );
+
+} // FUNCTION : Poi_Prepare_Rho
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_Prepare_Rho
+// Description :  Prepare the density array for the Poisson solver with an arbitrary number of ghost zones
+//
+// Note        :  1. Invoked by Poi_Prepare_Rho() above with NGhost == RHO_GHOST_SIZE and by
+//                   Poi_LevelSolver_MG() with NGhost == 0
+//                2. h_Rho_Array_P[] has the size [8*NPG][PS1+2*NGhost][PS1+2*NGhost][PS1+2*NGhost]
+//
+// Parameter   :  lv            : Target refinement level
+//                PrepTime      : Target physical time to prepare the coarse-grid data
+//                h_Rho_Array_P : Host array to store the prepared data
+//                NGhost        : Number of ghost zones on each side
+//                NPG           : Number of patch groups to be prepared at a time
+//                PID0_List     : List recording the patch indices with LocalID==0 to be udpated
+//-------------------------------------------------------------------------------------------------------
+void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[], const int NGhost,
+                      const int NPG, const int *PID0_List )
+{
+
 // check
 #  ifdef GAMER_DEBUG
    if ( OPT__GRAVITY_EXTRA_MASS  &&  Poi_AddExtraMassForGravity_Ptr == NULL )
@@ -35,7 +62,10 @@ void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][
    const real MinTemp_No        = -1.0;
    const real MinEntr_No        = -1.0;
 
-   Prepare_PatchData( lv, PrepTime, &h_Rho_Array_P[0][0][0][0], NULL, RHO_GHOST_SIZE, NPG, PID0_List, _TOTAL_DENS, _NONE,
+   const int  NX                = PS1 + 2*NGhost;
+   const long NXCube            = (long)CUBE( NX );
+
+   Prepare_PatchData( lv, PrepTime, h_Rho_Array_P, NULL, NGhost, NPG, PID0_List, _TOTAL_DENS, _NONE,
                       OPT__RHO_INT_SCHEME, INT_NONE, UNIT_PATCH, NSIDE_26, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
                       MIN_DENS, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
 
@@ -57,17 +87,18 @@ void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][
          {
             const int    PID = PID0 + LocalID;
             const int    N   = 8*TID + LocalID;
-            const double x0  = amr->patch[0][lv][PID]->EdgeL[0] + (0.5-RHO_GHOST_SIZE)*dh;
-            const double y0  = amr->patch[0][lv][PID]->EdgeL[1] + (0.5-RHO_GHOST_SIZE)*dh;
-            const double z0  = amr->patch[0][lv][PID]->EdgeL[2] + (0.5-RHO_GHOST_SIZE)*dh;
+            const double x0  = amr->patch[0][lv][PID]->EdgeL[0] + (0.5-NGhost)*dh;
+            const double y0  = amr->patch[0][lv][PID]->EdgeL[1] + (0.5-NGhost)*dh;
+            const double z0  = amr->patch[0][lv][PID]->EdgeL[2] + (0.5-NGhost)*dh;
 
+            real *Rho = h_Rho_Array_P + N*NXCube;
             double x, y, z;
 
-            for (int k=0; k<RHO_NXT; k++)  {  z = z0 + k*dh;  if ( Periodic[2] )  z = fmod( z+L[2], L[2] );
-            for (int j=0; j<RHO_NXT; j++)  {  y = y0 + j*dh;  if ( Periodic[1] )  y = fmod( y+L[1], L[1] );
-            for (int i=0; i<RHO_NXT; i++)  {  x = x0 + i*dh;  if ( Periodic[0] )  x = fmod( x+L[0], L[0] );
+            for (int k=0; k<NX; k++)  {  z = z0 + k*dh;  if ( Periodic[2] )  z = fmod( z+L[2], L[2] );
+            for (int j=0; j<NX; j++)  {  y = y0 + j*dh;  if ( Periodic[1] )  y = fmod( y+L[1], L[1] );
+            for (int i=0; i<NX; i++)  {  x = x0 + i*dh;  if ( Periodic[0] )  x = fmod( x+L[0], L[0] );
 
-               h_Rho_Array_P[N][k][j][i] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[lv], lv, NULL );
+               Rho[ ( (long)k*NX + j )*NX + i ] += Poi_AddExtraMassForGravity_Ptr( x, y, z, Time[lv], lv, NULL );
 
             }}}
          } // for (int LocalID=0; LocalID<8; LocalID++)
@@ -95,10 +126,8 @@ void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][
    {
 #     pragma omp parallel for schedule( static )
       for (int TID=0; TID<8*NPG; TID++)
-      for (int k=0; k<RHO_NXT; k++)
-      for (int j=0; j<RHO_NXT; j++)
-      for (int i=0; i<RHO_NXT; i++)
-         h_Rho_Array_P[TID][k][j][i] -= RhoSubtract;
+      for (long t=TID*NXCube; t<(TID+1)*NXCube; t++)
+         h_Rho_Array_P[t] -= RhoSubtract;
    }
 
 } // FUNCTION : Poi_Prepare_Rho
@@ -3,7 +3,6 @@
 
 #ifdef MASSIVE_PARTICLES
 
-static RandomNumber_t *RNG = NULL;
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -48,56 +47,56 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
-// define the particle attribute arrays
-   real_par *ParData_AllRank[PAR_NATT_TOTAL];
-   for (int v=0; v<PAR_NATT_TOTAL; v++)   ParData_AllRank[v] = NULL;
+// get the global index of the first particle in this rank
+   long *NPar_EachRank = new long [MPI_NRank];
+   long  ParGID0_ThisRank = 0;
 
+   MPI_Allgather( &NPar_ThisRank, 1, MPI_LONG, NPar_EachRank, 1, MPI_LONG, MPI_COMM_WORLD );
 
-// define the particle IC constructor
-   Par_EquilibriumIC Filename_Loader;
+   for (int r=0; r<MPI_Rank; r++)   ParGID0_ThisRank += NPar_EachRank[r];
 
+   delete [] NPar_EachRank;
 
-// only the master rank will construct the initial condition
-   if ( MPI_Rank == 0 ) {
 
-//    allocate memory for particle attribute arrays
-      ParData_AllRank[PAR_MASS] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_POSX] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_POSY] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_POSZ] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_VELX] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_VELY] = new real_par [NPar_AllRank];
-      ParData_AllRank[PAR_VELZ] = new real_par [NPar_AllRank];
+// define the particle IC constructor
+   Par_EquilibriumIC Filename_Loader;
+
 
-//    input filenames as parameters into Filename_Loader
-      Filename_Loader.Read_Filenames( "Input__TestProb" );
-      long Par_Idx0 = 0;
+// input filenames as parameters into Filename_Loader
+// --> all ranks construct the tables of each cloud and set only the particles with global indices
+//     [ParGID0_ThisRank, ParGID0_ThisRank+NPar_ThisRank), which avoids constructing all particles on
+//     the master rank and scattering them
+   Filename_Loader.Read_Filenames( "Input__TestProb" );
+   long Par_Idx0 = 0;
 
-      for (int k=0; k<Filename_Loader.filenames.Cloud_Num; k++) {
+   for (int k=0; k<Filename_Loader.filenames.Cloud_Num; k++) {
 
-//       initialize Par_EquilibriumIC for each cloud
-         Par_EquilibriumIC Cloud_Constructor;
-         Cloud_Constructor.Load_Physical_Params( Filename_Loader.filenames, k, NPar_AllRank );
-         Cloud_Constructor.Init();
+//    initialize Par_EquilibriumIC for each cloud
+      Par_EquilibriumIC Cloud_Constructor;
+      Cloud_Constructor.Load_Physical_Params( Filename_Loader.filenames, k, NPar_AllRank );
+      Cloud_Constructor.Init();
 
-//       check whether the particle number of each cloud is reasonable
-         if ( (Par_Idx0 + Cloud_Constructor.params.Cloud_Par_Num) > NPar_AllRank ) {
-            Aux_Error( ERROR_INFO, "particle number doesn't match (%ld + %ld = %ld > %ld) !!\n",
-                        Par_Idx0, Cloud_Constructor.params.Cloud_Par_Num, Par_Idx0+Cloud_Constructor.params.Cloud_Par_Num, NPar_AllRank );
-         }
+//    check whether the particle number of each cloud is reasonable
+      if ( (Par_Idx0 + Cloud_Constructor.params.Cloud_Par_Num) > NPar_AllRank ) {
+         Aux_Error( ERROR_INFO, "particle number doesn't match (%ld + %ld = %ld > %ld) !!\n",
+                     Par_Idx0, Cloud_Constructor.params.Cloud_Par_Num, Par_Idx0+Cloud_Constructor.params.Cloud_Par_Num, NPar_AllRank );
+      }
 
-//       set an equilibrium initial condition for each cloud
-         Cloud_Constructor.Par_SetEquilibriumIC( ParData_AllRank[PAR_MASS], ParData_AllRank+PAR_POSX, ParData_AllRank+PAR_VELX, Par_Idx0 );
+//    set the particles of this cloud owned by this rank
+      const long GID_Start = MAX( Par_Idx0, ParGID0_ThisRank );
+      const long GID_End   = MIN( Par_Idx0+Cloud_Constructor.params.Cloud_Par_Num, ParGID0_ThisRank+NPar_ThisRank );
+      const long NPar      = MAX( GID_End-GID_Start, 0L );
+      const long Offset    = GID_Start - ParGID0_ThisRank;
 
-//       update the particle index offset for the next cloud
-         Par_Idx0 += Cloud_Constructor.params.Cloud_Par_Num;
+      real_par *Pos_ThisRank[3] = { ParPosX+Offset, ParPosY+Offset, ParPosZ+Offset };
+      real_par *Vel_ThisRank[3] = { ParVelX+Offset, ParVelY+Offset, ParVelZ+Offset };
 
-      } // for (int k=0; k<Filename_Loader.filenames.Cloud_Num; k++)
-   } // if ( MPI_Rank == 0 )
+      Cloud_Constructor.Par_SetEquilibriumIC( ParMass+Offset, Pos_ThisRank, Vel_ThisRank, GID_Start-Par_Idx0, NPar );
 
+//    update the particle index offset for the next cloud
+      Par_Idx0 += Cloud_Constructor.params.Cloud_Par_Num;
 
-// send particle attributes from the master rank to all ranks
-   Par_ScatterParticleData( NPar_ThisRank, NPar_AllRank, _PAR_MASS|_PAR_POS|_PAR_VEL, ParData_AllRank, AllAttribute );
+   } // for (int k=0; k<Filename_Loader.filenames.Cloud_Num; k++)
 
 
 // synchronize all particles to the physical time on the base level
@@ -108,14 +107,6 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
    }
 
 
-// free resource
-   if ( MPI_Rank == 0 )
-   {
-      delete RNG;
-      for (int v=0; v<PAR_NATT_TOTAL; v++)   delete [] ParData_AllRank[v];
-   }
-
-
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : Par_Init_ByFunction_ParEqmIC
@@ -31,7 +31,10 @@ void YT_AddLocalGrid( int NField, yt_field *FieldList, LB_PatchCount& pc)
    LB_LocalPatchExchangeList lel;
 
 // sync load balance ids
+// --> not required for LOAD_BALANCE, for which the GIDs of remote patches are resolved by their home ranks
+#  ifndef LOAD_BALANCE
    LB_AllgatherLBIdx( pc, lel );
+#  endif
    LB_FillLocalPatchExchangeList( pc, lel );
 
 // loop over local patches at all levels
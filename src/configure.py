@@ -672,7 +672,7 @@ def load_arguments():
     parser.add_argument( "--overlap_mpi", type=str2bool, metavar="BOOLEAN", gamer_name="OVERLAP_MPI",
                          default=False,
                          constraint={ True:{"mpi":True} },
-                         help="Overlap MPI communication with computation. Not supported yet. Must enable <--mpi>.\n"
+                         help="Overlap MPI communication with the fluid solver. Must enable <--mpi>. Must also enable <--openmp> and set OPT__OVERLAP_MPI=1 in Input__Parameter to take effect.\n"
                        )
 
     parser.add_argument( "--gpu", type=str2bool, metavar="BOOLEAN", gamer_name="GPU",
@@ -680,6 +680,11 @@ def load_arguments():
                          help="Enable GPU. Must set <GPU_COMPUTE_CAPABILITY> in your machine *.config file as well.\n"
                        )
 
+    parser.add_argument( "--simd", type=str, metavar="TYPE", gamer_name="SIMD",
+                         default=NONE_STR, choices=[NONE_STR, "PORTABLE", "AVX2", "AVX512"],
+                         help="Enable the SIMD-vectorized CPU kernels (e.g., the batched Riemann solvers) with the target instruction set (PORTABLE: compiler auto-vectorization, AVX2, AVX512). For AVX2/AVX512, also enable the instruction set in CXXFLAG (e.g., -mavx2 -mfma, -mavx512f, or -march=native).\n"
+                       )
+
     args, name_table, depends, constraints = parser.parse_args()
     args = vars( args )
 
@@ -796,6 +801,8 @@ def set_sims( name_table, depends, **kwargs ):
         if not store: continue
         if opt == "eos":        # special string prefix of EOS
             opt_str = add_option( opt_str, name=gamer_name, val="EOS_"+kwargs[opt] )
+        elif opt == "simd" and kwargs[opt] != NONE_STR:     # special string prefix of SIMD
+            opt_str = add_option( opt_str, name=gamer_name, val="SIMD_"+kwargs[opt] )
         else:
             opt_str = add_option( opt_str, name=gamer_name, val=kwargs[opt] )
 
@@ -900,10 +907,6 @@ def validation( paths, depends, constraints, **kwargs ):
         LOGGER.error("<--patch_size> should be an even number greater than or equal to 8. Current: %d"%kwargs["patch_size"])
         success = False
 
-    if kwargs["overlap_mpi"]:
-        LOGGER.error("<--overlap_mpi> is not supported yet.")
-        success = False
-
     if not success: raise BaseException( "The above vaildation failed." )
     return
 
@@ -916,7 +919,11 @@ def warning( paths, **kwargs ):
     if kwargs["model"] == "ELBDM" and kwargs["passive"] != 0:
         LOGGER.warning("Not supported yet and can only be used as auxiliary fields.")
 
-    # 3. Path
+    # 3. Parallelization
+    if kwargs["simd"] != NONE_STR and not kwargs["openmp"]:
+        LOGGER.warning("<--simd> relies on \"#pragma omp simd\" --> add the OpenMP SIMD flag (e.g., -fopenmp-simd) to CXXFLAG when <--openmp> is disabled.")
+
+    # 4. Path
     path_links = { "gpu":{True:"CUDA_PATH"}, "fftw":{"FFTW2":"FFTW2_PATH", "FFTW3":"FFTW3_PATH"},
                    "mpi":{True:"MPI_PATH"}, "hdf5":{True:"HDF5_PATH"}, "grackle":{True:"GRACKLE_PATH"},
                    "gsl":{True:"GSL_PATH"}, "libyt":{True:"LIBYT_PATH"} }